@@ -6,6 +6,7 @@
 #include "plugin/Plugin.h"
 #include "misc/PlayPosition.h"
 #include "misc/PlayWatcher.h"
+#include "misc/EngineHealth.h"
 #include "misc/Renderer.h"
 #include "misc/Device.h"
 #include "misc/AudioLock.h"
@@ -85,6 +86,9 @@ AudioCore::AudioCore() {
 
 	/** Start Play Watcher */
 	PlayWatcher::getInstance()->startTimer(1000);
+
+	/** Start Engine Health */
+	EngineHealth::getInstance()->startTimer(100);
 }
 
 AudioCore::~AudioCore() {
@@ -93,6 +97,7 @@ AudioCore::~AudioCore() {
 	Device::releaseInstance();
 	this->mainGraphPlayer->setProcessor(nullptr);
 	PlayWatcher::releaseInstance();
+	EngineHealth::releaseInstance();
 	PlayPosition::releaseInstance();
 	Plugin::releaseInstance();
 	ARADataIOThread::releaseInstance();
@@ -245,10 +250,12 @@ void AudioCore::setIsolation(bool isolation) {
 
 bool AudioCore::renderNow(const juce::Array<int>& tracks, const juce::String& path,
 	const juce::String& name, const juce::String& extension,
-	const juce::StringPairArray& metaData, int bitDepth, int quality) {
+	const juce::StringPairArray& metaData, int bitDepth, int quality,
+	double startTime, double endTime, double preRollTime, bool snapToBlocks) {
 	return Renderer::getInstance()->start(
 		tracks, path, name, extension,
-		metaData, bitDepth, quality);
+		metaData, bitDepth, quality,
+		startTime, endTime, preRollTime, snapToBlocks);
 }
 
 bool AudioCore::isRendering() const {
@@ -282,11 +289,21 @@ bool AudioCore::save(const juce::String& name) {
 	config.projectFileName = projFile.getFileName();
 	config.projectDir = projDir.getFullPathName();
 	config.araDir = utils::getARADataDir(config.projectDir, config.projectFileName).getFullPathName();
+	config.freezeDir = utils::getFreezeDataDir(config.projectDir, config.projectFileName).getFullPathName();
+	config.automationDir = utils::getAutomationDataDir(config.projectDir, config.projectFileName).getFullPathName();
 
 	/** Clear ARA Data Dir */
 	juce::File araDir(config.araDir);
 	araDir.deleteRecursively();
 
+	/** Clear Freeze Data Dir */
+	juce::File freezeDir(config.freezeDir);
+	freezeDir.deleteRecursively();
+
+	/** Clear Automation Data Dir */
+	juce::File automationDir(config.automationDir);
+	automationDir.deleteRecursively();
+
 	/** Get Project Data */
 	auto mes = this->serialize(config);
 	if (!dynamic_cast<vsp4::Project*>(mes.get())) { ProjectInfoData::getInstance()->pop(); return false; };
@@ -377,6 +394,8 @@ bool AudioCore::load(const juce::String& path) {
 	config.projectFileName = projFile.getFileName();
 	config.projectDir = projDir.getFullPathName();
 	config.araDir = utils::getARADataDir(config.projectDir, config.projectFileName).getFullPathName();
+	config.freezeDir = utils::getFreezeDataDir(config.projectDir, config.projectFileName).getFullPathName();
+	config.automationDir = utils::getAutomationDataDir(config.projectDir, config.projectFileName).getFullPathName();
 
 	/** Change Graph */
 	if (this->parse(proj.get(), config)) {
@@ -51,7 +51,8 @@ public:
 
 	bool renderNow(const juce::Array<int>& tracks, const juce::String& path,
 		const juce::String& name, const juce::String& extension,
-		const juce::StringPairArray& metaData, int bitDepth, int quality);
+		const juce::StringPairArray& metaData, int bitDepth, int quality,
+		double startTime = 0, double endTime = -1, double preRollTime = 0, bool snapToBlocks = false);
 	bool isRendering() const;
 
 	MainGraph* getGraph() const;
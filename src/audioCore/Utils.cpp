@@ -918,6 +918,30 @@ namespace utils {
 		return juce::File{ araDir }.getChildFile("./" + id + ".dat");
 	}
 
+	juce::File getFreezeDataDir(const juce::String& projectDir, const juce::String& projectFileName) {
+		return juce::File{ projectDir }.getChildFile("./" + projectFileName + ".freeze/");
+	}
+
+	juce::File getFreezeDataFile(const juce::String& freezeDir, int index) {
+		return juce::File{ freezeDir }.getChildFile("./" + juce::String{ index } + ".wav");
+	}
+
+	juce::File getAutomationDataDir(const juce::String& projectDir, const juce::String& projectFileName) {
+		return juce::File{ projectDir }.getChildFile("./" + projectFileName + ".automation/");
+	}
+
+	juce::File getAutomationDataFile(const juce::String& automationDir, int index) {
+		return juce::File{ automationDir }.getChildFile("./" + juce::String{ index } + ".json");
+	}
+
+	juce::File getRenderCacheDir(const juce::String& projectDir) {
+		return juce::File{ projectDir }.getChildFile("./.render-cache/");
+	}
+
+	juce::File getRenderCacheFile(const juce::String& cacheDir, int index, const juce::String& extension) {
+		return juce::File{ cacheDir }.getChildFile("./" + juce::String{ index } + extension);
+	}
+
 	const juce::StringArray getProjectFormatsSupported(bool /*isWrite*/) {
 		return juce::StringArray{ "*.vsp4" };
 	}
@@ -133,6 +133,12 @@ namespace utils {
 
 	juce::File getARADataDir(const juce::String& projectDir, const juce::String& projectFileName);
 	juce::File getARADataFile(const juce::String& araDir, const juce::String& id);
+	juce::File getFreezeDataDir(const juce::String& projectDir, const juce::String& projectFileName);
+	juce::File getFreezeDataFile(const juce::String& freezeDir, int index);
+	juce::File getAutomationDataDir(const juce::String& projectDir, const juce::String& projectFileName);
+	juce::File getAutomationDataFile(const juce::String& automationDir, int index);
+	juce::File getRenderCacheDir(const juce::String& projectDir);
+	juce::File getRenderCacheFile(const juce::String& cacheDir, int index, const juce::String& extension);
 
 	const juce::StringArray getProjectFormatsSupported(bool isWrite);
 	const juce::StringArray getPluginFormatsSupported();
@@ -766,3 +766,143 @@ bool ActionAddTempoBeat::undo() {
 	PlayPosition::getInstance()->removeTempoLabel(ACTION_DATA(index));
 	ACTION_RESULT(true);
 }
+
+ActionAddMixerTrackAutomationPoint::ActionAddMixerTrackAutomationPoint(
+	int track, int type, double time, float value)
+	: ACTION_DB{ track, type, time, value } {}
+
+bool ActionAddMixerTrackAutomationPoint::doAction() {
+	ACTION_CHECK_RENDERING(
+		"Don't do this while rendering.");
+
+	ACTION_UNSAVE_PROJECT();
+
+	ACTION_WRITE_TYPE(ActionAddMixerTrackAutomationPoint);
+	ACTION_WRITE_DB();
+
+	if (ACTION_DATA(type) < 0 || ACTION_DATA(type) >= (int)Track::AutomationType::TypeNum) {
+		ACTION_RESULT(false);
+	}
+	auto type = static_cast<Track::AutomationType>(ACTION_DATA(type));
+
+	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		if (auto track = graph->getTrackProcessor(ACTION_DATA(track))) {
+			/** Adding At The Time Of A Point Replaces Its Value */
+			ACTION_DATA(replaced) = false;
+			for (int i = 0; i < track->getAutomationPointNum(type); i++) {
+				auto point = track->getAutomationPoint(type, i);
+				if (point.time == ACTION_DATA(time)) {
+					ACTION_DATA(replaced) = true;
+					ACTION_DATA(oldValue) = point.value;
+					break;
+				}
+			}
+
+			ACTION_DATA(index) = track->addAutomationPoint(
+				type, ACTION_DATA(time), ACTION_DATA(value));
+
+			this->output("Add Mixer Track Automation Point: [" + juce::String(ACTION_DATA(track)) + ", " + juce::String(ACTION_DATA(type)) + "] " + juce::String(ACTION_DATA(index)) + "\n");
+			ACTION_RESULT(true);
+		}
+	}
+	ACTION_RESULT(false);
+}
+
+bool ActionAddMixerTrackAutomationPoint::undo() {
+	ACTION_CHECK_RENDERING(
+		"Don't do this while rendering.");
+
+	ACTION_UNSAVE_PROJECT();
+
+	ACTION_WRITE_TYPE_UNDO(ActionAddMixerTrackAutomationPoint);
+	ACTION_WRITE_DB();
+
+	auto type = static_cast<Track::AutomationType>(ACTION_DATA(type));
+
+	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		if (auto track = graph->getTrackProcessor(ACTION_DATA(track))) {
+			if (ACTION_DATA(replaced)) {
+				track->addAutomationPoint(
+					type, ACTION_DATA(time), ACTION_DATA(oldValue));
+			}
+			else {
+				track->removeAutomationPoint(type, ACTION_DATA(index));
+			}
+
+			this->output("Undo Add Mixer Track Automation Point: [" + juce::String(ACTION_DATA(track)) + ", " + juce::String(ACTION_DATA(type)) + "] " + juce::String(ACTION_DATA(index)) + "\n");
+			ACTION_RESULT(true);
+		}
+	}
+	ACTION_RESULT(false);
+}
+
+ActionAddEffectAutomationPoint::ActionAddEffectAutomationPoint(
+	int track, int effect, int param, double time, float value)
+	: ACTION_DB{ track, effect, param, time, value } {}
+
+bool ActionAddEffectAutomationPoint::doAction() {
+	ACTION_CHECK_RENDERING(
+		"Don't do this while rendering.");
+
+	ACTION_UNSAVE_PROJECT();
+
+	ACTION_WRITE_TYPE(ActionAddEffectAutomationPoint);
+	ACTION_WRITE_DB();
+
+	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		if (auto track = graph->getTrackProcessor(ACTION_DATA(track))) {
+			if (auto pluginDock = track->getPluginDock()) {
+				if (auto effect = pluginDock->getPluginProcessor(ACTION_DATA(effect))) {
+					/** Adding At The Time Of A Point Replaces Its Value */
+					ACTION_DATA(replaced) = false;
+					for (int i = 0; i < effect->getParamAutomationPointNum(ACTION_DATA(param)); i++) {
+						auto point = effect->getParamAutomationPoint(ACTION_DATA(param), i);
+						if (point.time == ACTION_DATA(time)) {
+							ACTION_DATA(replaced) = true;
+							ACTION_DATA(oldValue) = point.value;
+							break;
+						}
+					}
+
+					ACTION_DATA(index) = effect->addParamAutomationPoint(
+						ACTION_DATA(param), ACTION_DATA(time), ACTION_DATA(value));
+					if (ACTION_DATA(index) < 0) { ACTION_RESULT(false); }
+
+					this->output("Add Effect Automation Point: [" + juce::String(ACTION_DATA(track)) + ", " + juce::String(ACTION_DATA(effect)) + ", " + juce::String(ACTION_DATA(param)) + "] " + juce::String(ACTION_DATA(index)) + "\n");
+					ACTION_RESULT(true);
+				}
+			}
+		}
+	}
+	ACTION_RESULT(false);
+}
+
+bool ActionAddEffectAutomationPoint::undo() {
+	ACTION_CHECK_RENDERING(
+		"Don't do this while rendering.");
+
+	ACTION_UNSAVE_PROJECT();
+
+	ACTION_WRITE_TYPE_UNDO(ActionAddEffectAutomationPoint);
+	ACTION_WRITE_DB();
+
+	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		if (auto track = graph->getTrackProcessor(ACTION_DATA(track))) {
+			if (auto pluginDock = track->getPluginDock()) {
+				if (auto effect = pluginDock->getPluginProcessor(ACTION_DATA(effect))) {
+					if (ACTION_DATA(replaced)) {
+						effect->addParamAutomationPoint(
+							ACTION_DATA(param), ACTION_DATA(time), ACTION_DATA(oldValue));
+					}
+					else {
+						effect->removeParamAutomationPoint(ACTION_DATA(param), ACTION_DATA(index));
+					}
+
+					this->output("Undo Add Effect Automation Point: [" + juce::String(ACTION_DATA(track)) + ", " + juce::String(ACTION_DATA(effect)) + ", " + juce::String(ACTION_DATA(param)) + "] " + juce::String(ACTION_DATA(index)) + "\n");
+					ACTION_RESULT(true);
+				}
+			}
+		}
+	}
+	ACTION_RESULT(false);
+}
@@ -377,3 +377,53 @@ private:
 
 	JUCE_LEAK_DETECTOR(ActionAddTempoBeat)
 };
+
+class ActionAddMixerTrackAutomationPoint final : public ActionUndoableBase {
+public:
+	ActionAddMixerTrackAutomationPoint() = delete;
+	ActionAddMixerTrackAutomationPoint(
+		int track, int type, double time, float value);
+
+	bool doAction() override;
+	bool undo() override;
+	const juce::String getName() override {
+		return "Add Mixer Track Automation Point";
+	};
+
+private:
+	ACTION_DATABLOCK{
+		const int track, type;
+		const double time;
+		const float value;
+		int index = -1;
+		bool replaced = false;
+		float oldValue = 0;
+	} ACTION_DB;
+
+	JUCE_LEAK_DETECTOR(ActionAddMixerTrackAutomationPoint)
+};
+
+class ActionAddEffectAutomationPoint final : public ActionUndoableBase {
+public:
+	ActionAddEffectAutomationPoint() = delete;
+	ActionAddEffectAutomationPoint(
+		int track, int effect, int param, double time, float value);
+
+	bool doAction() override;
+	bool undo() override;
+	const juce::String getName() override {
+		return "Add Effect Automation Point";
+	};
+
+private:
+	ACTION_DATABLOCK{
+		const int track, effect, param;
+		const double time;
+		const float value;
+		int index = -1;
+		bool replaced = false;
+		float oldValue = 0;
+	} ACTION_DB;
+
+	JUCE_LEAK_DETECTOR(ActionAddEffectAutomationPoint)
+};
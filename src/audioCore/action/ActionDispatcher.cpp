@@ -1,6 +1,7 @@
 ﻿#include "ActionDispatcher.h"
 #include "ActionUndoableBase.h"
 #include "../recovery/DataControl.hpp"
+#include "../AudioCore.h"
 
 ActionDispatcher::ActionDispatcher() {
 	/** Undo Manager */
@@ -25,8 +26,10 @@ bool ActionDispatcher::dispatch(std::unique_ptr<ActionBase> action) {
 	if (dynamic_cast<ActionUndoableBase*>(action.get())) {
 		juce::String name = action->getName();
 		//this->manager->beginNewTransaction(action->getName());
-		return this->manager->perform(
+		bool result = this->manager->perform(
 			dynamic_cast<ActionUndoableBase*>(action.release()), name);
+		this->invalidateRenderAhead();
+		return result;
 	}
 	return action->doAction();
 }
@@ -36,11 +39,15 @@ void ActionDispatcher::clearUndoList() {
 }
 
 bool ActionDispatcher::performUndo() {
-	return this->manager->undo();
+	bool result = this->manager->undo();
+	this->invalidateRenderAhead();
+	return result;
 }
 
 bool ActionDispatcher::performRedo() {
-	return this->manager->redo();
+	bool result = this->manager->redo();
+	this->invalidateRenderAhead();
+	return result;
 }
 
 void ActionDispatcher::setOutput(
@@ -62,6 +69,15 @@ void ActionDispatcher::errorInternal(const juce::String& mes) {
 	this->error(mes);
 }
 
+void ActionDispatcher::invalidateRenderAhead() {
+	/** Edits Make The Blocks Rendered Ahead Outdated */
+	if (auto core = AudioCore::getInstanceWithoutCreate()) {
+		if (auto graph = core->getGraph()) {
+			graph->invalidateRenderAhead();
+		}
+	}
+}
+
 ActionDispatcher* ActionDispatcher::getInstance() {
 	return ActionDispatcher::instance ? ActionDispatcher::instance : (ActionDispatcher::instance = new ActionDispatcher);
 }
@@ -25,6 +25,8 @@ private:
 	void outputInternal(const juce::String& mes);
 	void errorInternal(const juce::String& mes);
 
+	void invalidateRenderAhead();
+
 private:
 	std::unique_ptr<juce::UndoManager> manager = nullptr;
 	OutputCallback output = [](const juce::String&) {};
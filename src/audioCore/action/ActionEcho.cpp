@@ -2,6 +2,8 @@
 
 #include "../AudioCore.h"
 #include "../misc/Device.h"
+#include "../misc/EngineHealth.h"
+#include "../misc/Renderer.h"
 #include "../Utils.h"
 
 ActionEchoDeviceAudio::ActionEchoDeviceAudio() {}
@@ -436,3 +438,61 @@ bool ActionEchoEffectCCParam::doAction() {
 	}
 	return false;
 }
+
+ActionEchoPluginSleep::ActionEchoPluginSleep() {}
+
+bool ActionEchoPluginSleep::doAction() {
+	juce::String result;
+
+	result += "Sleeping Plugins: " + juce::String(PluginDecorator::getSleepingNum()) + "\n";
+	result += "Skipped Plugin Blocks: " + juce::String(PluginDecorator::getSleptBlockNum()) + "\n";
+
+	this->output(result);
+	return true;
+}
+
+ActionEchoEngineHealth::ActionEchoEngineHealth() {}
+
+bool ActionEchoEngineHealth::doAction() {
+	juce::String result;
+	auto health = EngineHealth::getInstance();
+
+	result += "========================================================================\n";
+	result += "Engine Health\n";
+	result += "========================================================================\n";
+	for (int i = 0; i < (int)EngineHealth::EventType::TypeNum; i++) {
+		auto type = static_cast<EngineHealth::EventType>(i);
+		result += EngineHealth::getTypeName(type) + ": " + juce::String(health->getCount(type)) + "\n";
+	}
+	result += "========================================================================\n";
+	for (auto& i : health->getEvents()) {
+		result += EngineHealth::toString(i) + "\n";
+	}
+	result += "========================================================================\n";
+
+	this->output(result);
+	return true;
+}
+
+ActionEchoRenderInfo::ActionEchoRenderInfo() {}
+
+bool ActionEchoRenderInfo::doAction() {
+	juce::String result;
+	auto renderer = Renderer::getInstance();
+	auto [length, cost] = renderer->getLastRenderTime();
+
+	result += "========================================================================\n";
+	result += "Last Render\n";
+	result += "========================================================================\n";
+	result += "Block Size: " + juce::String(renderer->getLastRenderBlockSize()) + "\n";
+	result += "Threads: " + juce::String(renderer->getLastRenderThreadNum()) + "\n";
+	result += "Audio Length: " + juce::String(length, 3) + " seconds\n";
+	result += "Time Spent: " + juce::String(cost, 3) + " seconds\n";
+	result += "Realtime Factor: " + juce::String(renderer->getLastRealtimeFactor(), 2) + "x\n";
+	result += "Cached Stems: " + juce::String(renderer->getLastCachedStemNum())
+		+ (renderer->getRenderCacheEnabled() ? "" : " (cache disabled)") + "\n";
+	result += "========================================================================\n";
+
+	this->output(result);
+	return true;
+}
@@ -253,3 +253,42 @@ private:
 
 	JUCE_LEAK_DETECTOR(ActionEchoEffectCCParam)
 };
+
+class ActionEchoPluginSleep final : public ActionBase {
+public:
+	ActionEchoPluginSleep();
+
+	bool doAction() override;
+	const juce::String getName() override {
+		return "Echo Plugin Sleep";
+	};
+
+private:
+	JUCE_LEAK_DETECTOR(ActionEchoPluginSleep)
+};
+
+class ActionEchoEngineHealth final : public ActionBase {
+public:
+	ActionEchoEngineHealth();
+
+	bool doAction() override;
+	const juce::String getName() override {
+		return "Echo Engine Health";
+	};
+
+private:
+	JUCE_LEAK_DETECTOR(ActionEchoEngineHealth)
+};
+
+class ActionEchoRenderInfo final : public ActionBase {
+public:
+	ActionEchoRenderInfo();
+
+	bool doAction() override;
+	const juce::String getName() override {
+		return "Echo Render Info";
+	};
+
+private:
+	JUCE_LEAK_DETECTOR(ActionEchoRenderInfo)
+};
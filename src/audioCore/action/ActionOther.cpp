@@ -116,9 +116,12 @@ bool ActionStopRecord::doAction() {
 ActionRenderNow::ActionRenderNow(
 	const juce::String& path, const juce::String& name,
 	const juce::String& extension, const juce::Array<int>& tracks,
-	const juce::StringPairArray& metaData, int bitDepth, int quality)
+	const juce::StringPairArray& metaData, int bitDepth, int quality,
+	double startTime, double endTime, double preRollTime, bool snapToBlocks)
 	: path(path), name(name), extension(extension), tracks(tracks),
-	metaData(metaData), bitDepth(bitDepth), quality(quality) {}
+	metaData(metaData), bitDepth(bitDepth), quality(quality),
+	startTime(startTime), endTime(endTime), preRollTime(preRollTime),
+	snapToBlocks(snapToBlocks) {}
 
 bool ActionRenderNow::doAction() {
 	ACTION_CHECK_RENDERING(
@@ -130,7 +133,8 @@ bool ActionRenderNow::doAction() {
 
 	if (AudioCore::getInstance()->renderNow(
 		this->tracks, this->path, this->name, this->extension,
-		this->metaData, this->bitDepth, this->quality)) {
+		this->metaData, this->bitDepth, this->quality,
+		this->startTime, this->endTime, this->preRollTime, this->snapToBlocks)) {
 		juce::String result;
 
 		result += "Start rendering:\n";
@@ -142,6 +146,10 @@ bool ActionRenderNow::doAction() {
 			result += juce::String(i) + " ";
 		}
 		result += "\n";
+		result += "    Range: " + juce::String(this->startTime) + " - "
+			+ (this->endTime < 0 ? juce::String("end") : juce::String(this->endTime))
+			+ (this->snapToBlocks ? " (snap to blocks)" : "") + "\n";
+		result += "    Pre-Roll: " + juce::String(this->preRollTime) + " s\n";
 
 		this->output(result);
 		return true;
@@ -481,3 +489,42 @@ bool ActionSavePluginState::doAction() {
 	this->output("Can't save plugin state: [" + this->plugin->getName() + "] " + this->path);
 	ACTION_RESULT(false);
 }
+
+ActionBeginGraphEdit::ActionBeginGraphEdit() {}
+
+bool ActionBeginGraphEdit::doAction() {
+	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		graph->beginEdit();
+
+		this->output("Begin graph edit.");
+		return true;
+	}
+	return false;
+}
+
+ActionCommitGraphEdit::ActionCommitGraphEdit() {}
+
+bool ActionCommitGraphEdit::doAction() {
+	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		if (!graph->commitEdit()) {
+			this->output("No graph edit to commit.");
+			return false;
+		}
+
+		this->output("Commit graph edit.");
+		return true;
+	}
+	return false;
+}
+
+ActionAbortGraphEdit::ActionAbortGraphEdit() {}
+
+bool ActionAbortGraphEdit::doAction() {
+	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		int num = graph->abortEdit();
+
+		this->output("Abort graph edit: " + juce::String(num) + " level(s) closed.");
+		return true;
+	}
+	return false;
+}
@@ -114,7 +114,8 @@ public:
 	ActionRenderNow(
 		const juce::String& path, const juce::String& name,
 		const juce::String& extension, const juce::Array<int>& tracks,
-		const juce::StringPairArray& metaData, int bitDepth, int quality);
+		const juce::StringPairArray& metaData, int bitDepth, int quality,
+		double startTime = 0, double endTime = -1, double preRollTime = 0, bool snapToBlocks = false);
 
 	bool doAction() override;
 	const juce::String getName() override {
@@ -127,6 +128,8 @@ private:
 	const juce::StringPairArray metaData;
 	const int bitDepth;
 	const int quality;
+	const double startTime, endTime, preRollTime;
+	const bool snapToBlocks;
 
 	JUCE_LEAK_DETECTOR(ActionRenderNow)
 };
@@ -360,3 +363,42 @@ private:
 
 	JUCE_LEAK_DETECTOR(ActionSavePluginState)
 };
+
+class ActionBeginGraphEdit final : public ActionBase {
+public:
+	ActionBeginGraphEdit();
+
+	bool doAction() override;
+	const juce::String getName() override {
+		return "Begin Graph Edit";
+	};
+
+private:
+	JUCE_LEAK_DETECTOR(ActionBeginGraphEdit)
+};
+
+class ActionCommitGraphEdit final : public ActionBase {
+public:
+	ActionCommitGraphEdit();
+
+	bool doAction() override;
+	const juce::String getName() override {
+		return "Commit Graph Edit";
+	};
+
+private:
+	JUCE_LEAK_DETECTOR(ActionCommitGraphEdit)
+};
+
+class ActionAbortGraphEdit final : public ActionBase {
+public:
+	ActionAbortGraphEdit();
+
+	bool doAction() override;
+	const juce::String getName() override {
+		return "Abort Graph Edit";
+	};
+
+private:
+	JUCE_LEAK_DETECTOR(ActionAbortGraphEdit)
+};
@@ -42,6 +42,12 @@ bool ActionRemovePluginSearchPath::doAction() {
 ActionRemoveMixerTrack::ActionRemoveMixerTrack(int index)
 	: ACTION_DB{ index } {}
 
+ActionRemoveMixerTrack::~ActionRemoveMixerTrack() {
+	/** Automation Data Kept For Undo Goes Away With The Action */
+	auto config = Serializable::createSerializeConfigQuickly(ACTION_DATA(sidecarID));
+	juce::File{ config.automationDir }.deleteRecursively();
+}
+
 bool ActionRemoveMixerTrack::doAction() {
 	ACTION_CHECK_RENDERING(
 		"Don't do this while rendering.");
@@ -129,7 +135,7 @@ bool ActionRemoveMixerTrack::doAction() {
 		/** Save Track State */
 		auto track = graph->getTrackProcessor(ACTION_DATA(index));
 		if (!track) { ACTION_RESULT(false); }
-		auto state = track->serialize(Serializable::createSerializeConfigQuickly());
+		auto state = track->serialize(Serializable::createSerializeConfigQuickly(ACTION_DATA(sidecarID)));
 
 		auto statePtr = dynamic_cast<vsp4::MixerTrack*>(state.get());
 		if (!statePtr) { ACTION_RESULT(false); }
@@ -221,6 +227,9 @@ bool ActionRemoveMixerTrack::undo() {
 	writeRecoveryDataBlockValue((const char*)(ACTION_DATA(data).getData()), ACTION_DATA(data).getSize());
 
 	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		/** Rebuild Once After Recovering */
+		MainGraph::ScopedTransaction transaction{ graph };
+
 		/** Prepare Track State */
 		auto state = std::make_unique<vsp4::MixerTrack>();
 		if (!state->ParseFromArray(ACTION_DATA(data).getData(), ACTION_DATA(data).getSize())) {
@@ -234,7 +243,7 @@ bool ActionRemoveMixerTrack::undo() {
 		/** Recover Track State */
 		auto track = graph->getTrackProcessor(ACTION_DATA(index));
 		graph->setTrackBypass(ACTION_DATA(index), state->bypassed());
-		track->parse(state.get(), Serializable::createParseConfigQuickly());
+		track->parse(state.get(), Serializable::createParseConfigQuickly(ACTION_DATA(sidecarID)));
 
 		/** Recover Connections */
 		for (auto [src, srcc, dst, dstc] : ACTION_DATA(audioT2Trk)) {
@@ -546,6 +555,9 @@ bool ActionRemoveEffect::doAction() {
 				ACTION_DATA(data).setSize(state->ByteSizeLong());
 				state->SerializeToArray(ACTION_DATA(data).getData(), ACTION_DATA(data).getSize());
 
+				/** Plugin State Doesn't Carry Automation */
+				ACTION_DATA(automation) = effect->getAutomationData();
+
 				/** Remove Effect */
 				dock->removePlugin(ACTION_DATA(effect));
 
@@ -572,6 +584,9 @@ bool ActionRemoveEffect::undo() {
 	writeRecoveryDataBlockValue((const char*)(ACTION_DATA(data).getData()), ACTION_DATA(data).getSize());
 
 	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		/** Rebuild Once After Recovering */
+		MainGraph::ScopedTransaction transaction{ graph };
+
 		if (auto track = graph->getTrackProcessor(ACTION_DATA(track))) {
 			if (auto dock = track->getPluginDock()) {
 				/** Prepare Effect State */
@@ -587,6 +602,7 @@ bool ActionRemoveEffect::undo() {
 				auto effect = dock->getPluginProcessor(ACTION_DATA(effect));
 				dock->setPluginBypass(ACTION_DATA(effect), state->bypassed());
 				effect->parse(state.get(), Serializable::createParseConfigQuickly());
+				effect->setAutomationData(ACTION_DATA(automation));
 
 				this->output("Undo Remove Plugin: [" + juce::String(ACTION_DATA(track)) + ", " + juce::String(ACTION_DATA(effect)) + "]" + "\n");
 				ACTION_RESULT(true);
@@ -650,6 +666,9 @@ bool ActionRemoveInstr::undo() {
 	writeRecoveryDataBlockValue((const char*)(ACTION_DATA(data).getData()), ACTION_DATA(data).getSize());
 
 	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		/** Rebuild Once After Recovering */
+		MainGraph::ScopedTransaction transaction{ graph };
+
 		if (auto track = graph->getSourceProcessor(ACTION_DATA(index))) {
 			/** Prepare Instr State */
 			auto state = std::make_unique<vsp4::Plugin>();
@@ -909,6 +928,12 @@ bool ActionRemoveMixerTrackMidiOutput::undo() {
 ActionRemoveSequencerTrack::ActionRemoveSequencerTrack(int index)
 	: ACTION_DB{ index } {}
 
+ActionRemoveSequencerTrack::~ActionRemoveSequencerTrack() {
+	/** Freeze Data Kept For Undo Goes Away With The Action */
+	auto config = Serializable::createSerializeConfigQuickly(ACTION_DATA(sidecarID));
+	juce::File{ config.freezeDir }.deleteRecursively();
+}
+
 bool ActionRemoveSequencerTrack::doAction() {
 	ACTION_CHECK_RENDERING(
 		"Don't do this while rendering.");
@@ -946,7 +971,7 @@ bool ActionRemoveSequencerTrack::doAction() {
 		/** Save Track State */
 		auto track = graph->getSourceProcessor(ACTION_DATA(index));
 		if (!track) { ACTION_RESULT(false); }
-		auto state = track->serialize(Serializable::createSerializeConfigQuickly());
+		auto state = track->serialize(Serializable::createSerializeConfigQuickly(ACTION_DATA(sidecarID)));
 
 		auto statePtr = dynamic_cast<vsp4::SeqTrack*>(state.get());
 		if (!statePtr) { ACTION_RESULT(false); }
@@ -994,6 +1019,9 @@ bool ActionRemoveSequencerTrack::undo() {
 	writeRecoveryDataBlockValue((const char*)(ACTION_DATA(data).getData()), ACTION_DATA(data).getSize());
 
 	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		/** Rebuild Once After Recovering */
+		MainGraph::ScopedTransaction transaction{ graph };
+
 		/** Prepare Track State */
 		auto state = std::make_unique<vsp4::SeqTrack>();
 		if (!state->ParseFromArray(ACTION_DATA(data).getData(), ACTION_DATA(data).getSize())) {
@@ -1007,7 +1035,7 @@ bool ActionRemoveSequencerTrack::undo() {
 		/** Recover Track State */
 		auto track = graph->getSourceProcessor(ACTION_DATA(index));
 		graph->setSourceBypass(ACTION_DATA(index), state->bypassed());
-		track->parse(state.get(), Serializable::createParseConfigQuickly());
+		track->parse(state.get(), Serializable::createParseConfigQuickly(ACTION_DATA(sidecarID)));
 
 		/** Recover Connections */
 		for (auto [src, srcc, dst, dstc] : ACTION_DATA(audioSrc2Trk)) {
@@ -1219,3 +1247,119 @@ bool ActionRemoveTempo::undo() {
 	}
 	ACTION_RESULT(true);
 }
+
+ActionRemoveMixerTrackAutomationPoint::ActionRemoveMixerTrackAutomationPoint(
+	int track, int type, int index)
+	: ACTION_DB{ track, type, index } {}
+
+bool ActionRemoveMixerTrackAutomationPoint::doAction() {
+	ACTION_CHECK_RENDERING(
+		"Don't do this while rendering.");
+
+	ACTION_UNSAVE_PROJECT();
+
+	ACTION_WRITE_TYPE(ActionRemoveMixerTrackAutomationPoint);
+	ACTION_WRITE_DB();
+
+	if (ACTION_DATA(type) < 0 || ACTION_DATA(type) >= (int)Track::AutomationType::TypeNum) {
+		ACTION_RESULT(false);
+	}
+	auto type = static_cast<Track::AutomationType>(ACTION_DATA(type));
+
+	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		if (auto track = graph->getTrackProcessor(ACTION_DATA(track))) {
+			if (ACTION_DATA(index) >= 0 && ACTION_DATA(index) < track->getAutomationPointNum(type)) {
+				auto point = track->getAutomationPoint(type, ACTION_DATA(index));
+				ACTION_DATA(time) = point.time;
+				ACTION_DATA(value) = point.value;
+
+				track->removeAutomationPoint(type, ACTION_DATA(index));
+
+				this->output("Remove Mixer Track Automation Point: [" + juce::String(ACTION_DATA(track)) + ", " + juce::String(ACTION_DATA(type)) + "] " + juce::String(ACTION_DATA(index)) + "\n");
+				ACTION_RESULT(true);
+			}
+		}
+	}
+	ACTION_RESULT(false);
+}
+
+bool ActionRemoveMixerTrackAutomationPoint::undo() {
+	ACTION_CHECK_RENDERING(
+		"Don't do this while rendering.");
+
+	ACTION_UNSAVE_PROJECT();
+
+	ACTION_WRITE_TYPE_UNDO(ActionRemoveMixerTrackAutomationPoint);
+	ACTION_WRITE_DB();
+
+	auto type = static_cast<Track::AutomationType>(ACTION_DATA(type));
+
+	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		if (auto track = graph->getTrackProcessor(ACTION_DATA(track))) {
+			track->addAutomationPoint(type, ACTION_DATA(time), ACTION_DATA(value));
+
+			this->output("Undo Remove Mixer Track Automation Point: [" + juce::String(ACTION_DATA(track)) + ", " + juce::String(ACTION_DATA(type)) + "] " + juce::String(ACTION_DATA(index)) + "\n");
+			ACTION_RESULT(true);
+		}
+	}
+	ACTION_RESULT(false);
+}
+
+ActionRemoveEffectAutomationPoint::ActionRemoveEffectAutomationPoint(
+	int track, int effect, int param, int index)
+	: ACTION_DB{ track, effect, param, index } {}
+
+bool ActionRemoveEffectAutomationPoint::doAction() {
+	ACTION_CHECK_RENDERING(
+		"Don't do this while rendering.");
+
+	ACTION_UNSAVE_PROJECT();
+
+	ACTION_WRITE_TYPE(ActionRemoveEffectAutomationPoint);
+	ACTION_WRITE_DB();
+
+	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		if (auto track = graph->getTrackProcessor(ACTION_DATA(track))) {
+			if (auto pluginDock = track->getPluginDock()) {
+				if (auto effect = pluginDock->getPluginProcessor(ACTION_DATA(effect))) {
+					if (ACTION_DATA(index) >= 0 && ACTION_DATA(index) < effect->getParamAutomationPointNum(ACTION_DATA(param))) {
+						auto point = effect->getParamAutomationPoint(ACTION_DATA(param), ACTION_DATA(index));
+						ACTION_DATA(time) = point.time;
+						ACTION_DATA(value) = point.value;
+
+						effect->removeParamAutomationPoint(ACTION_DATA(param), ACTION_DATA(index));
+
+						this->output("Remove Effect Automation Point: [" + juce::String(ACTION_DATA(track)) + ", " + juce::String(ACTION_DATA(effect)) + ", " + juce::String(ACTION_DATA(param)) + "] " + juce::String(ACTION_DATA(index)) + "\n");
+						ACTION_RESULT(true);
+					}
+				}
+			}
+		}
+	}
+	ACTION_RESULT(false);
+}
+
+bool ActionRemoveEffectAutomationPoint::undo() {
+	ACTION_CHECK_RENDERING(
+		"Don't do this while rendering.");
+
+	ACTION_UNSAVE_PROJECT();
+
+	ACTION_WRITE_TYPE_UNDO(ActionRemoveEffectAutomationPoint);
+	ACTION_WRITE_DB();
+
+	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		if (auto track = graph->getTrackProcessor(ACTION_DATA(track))) {
+			if (auto pluginDock = track->getPluginDock()) {
+				if (auto effect = pluginDock->getPluginProcessor(ACTION_DATA(effect))) {
+					effect->addParamAutomationPoint(
+						ACTION_DATA(param), ACTION_DATA(time), ACTION_DATA(value));
+
+					this->output("Undo Remove Effect Automation Point: [" + juce::String(ACTION_DATA(track)) + ", " + juce::String(ACTION_DATA(effect)) + ", " + juce::String(ACTION_DATA(param)) + "] " + juce::String(ACTION_DATA(index)) + "\n");
+					ACTION_RESULT(true);
+				}
+			}
+		}
+	}
+	ACTION_RESULT(false);
+}
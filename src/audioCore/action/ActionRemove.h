@@ -40,6 +40,7 @@ class ActionRemoveMixerTrack final : public ActionUndoableBase {
 public:
 	ActionRemoveMixerTrack() = delete;
 	ActionRemoveMixerTrack(int index);
+	~ActionRemoveMixerTrack() override;
 
 	bool doAction() override;
 	bool undo() override;
@@ -60,6 +61,7 @@ private:
 		utils::MidiConnectionList midiI2Trk;
 		utils::MidiConnectionList midiTrk2O;
 		juce::MemoryBlock data;
+		const juce::String sidecarID = juce::Uuid{}.toDashedString();
 	} ACTION_DB;
 
 	JUCE_LEAK_DETECTOR(ActionRemoveMixerTrack)
@@ -180,6 +182,7 @@ private:
 	ACTION_DATABLOCK{
 		const int track, effect;
 		juce::MemoryBlock data;
+		juce::var automation;
 	} ACTION_DB;
 
 	JUCE_LEAK_DETECTOR(ActionRemoveEffect)
@@ -308,6 +311,7 @@ class ActionRemoveSequencerTrack final : public ActionUndoableBase {
 public:
 	ActionRemoveSequencerTrack() = delete;
 	ActionRemoveSequencerTrack(int index);
+	~ActionRemoveSequencerTrack() override;
 
 	bool doAction() override;
 	bool undo() override;
@@ -322,6 +326,7 @@ private:
 		utils::AudioConnectionList audioSrc2Trk;
 		utils::MidiConnectionList midiSrc2Trk;
 		juce::MemoryBlock data;
+		const juce::String sidecarID = juce::Uuid{}.toDashedString();
 	} ACTION_DB;
 
 	JUCE_LEAK_DETECTOR(ActionRemoveSequencerTrack)
@@ -409,3 +414,45 @@ private:
 
 	JUCE_LEAK_DETECTOR(ActionRemoveTempo)
 };
+
+class ActionRemoveMixerTrackAutomationPoint final : public ActionUndoableBase {
+public:
+	ActionRemoveMixerTrackAutomationPoint() = delete;
+	ActionRemoveMixerTrackAutomationPoint(int track, int type, int index);
+
+	bool doAction() override;
+	bool undo() override;
+	const juce::String getName() override {
+		return "Remove Mixer Track Automation Point";
+	};
+
+private:
+	ACTION_DATABLOCK{
+		const int track, type, index;
+		double time = 0;
+		float value = 0;
+	} ACTION_DB;
+
+	JUCE_LEAK_DETECTOR(ActionRemoveMixerTrackAutomationPoint)
+};
+
+class ActionRemoveEffectAutomationPoint final : public ActionUndoableBase {
+public:
+	ActionRemoveEffectAutomationPoint() = delete;
+	ActionRemoveEffectAutomationPoint(int track, int effect, int param, int index);
+
+	bool doAction() override;
+	bool undo() override;
+	const juce::String getName() override {
+		return "Remove Effect Automation Point";
+	};
+
+private:
+	ACTION_DATABLOCK{
+		const int track, effect, param, index;
+		double time = 0;
+		float value = 0;
+	} ACTION_DB;
+
+	JUCE_LEAK_DETECTOR(ActionRemoveEffectAutomationPoint)
+};
@@ -1209,6 +1209,60 @@ bool ActionSetEffectMidiCCIntercept::undo() {
 	ACTION_RESULT(false);
 }
 
+ActionSetEffectNeverSleep::ActionSetEffectNeverSleep(
+	int track, int effect, bool neverSleep)
+	: ACTION_DB{ track, effect, neverSleep } {}
+
+bool ActionSetEffectNeverSleep::doAction() {
+	ACTION_CHECK_RENDERING(
+		"Don't do this while rendering.");
+
+	ACTION_UNSAVE_PROJECT();
+
+	ACTION_WRITE_TYPE(ActionSetEffectNeverSleep);
+	ACTION_WRITE_DB();
+
+	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		if (auto track = graph->getTrackProcessor(ACTION_DATA(track))) {
+			if (auto pluginDock = track->getPluginDock()) {
+				if (auto effect = pluginDock->getPluginProcessor(ACTION_DATA(effect))) {
+					ACTION_DATA(oldNeverSleep) = effect->getNeverSleep();
+
+					effect->setNeverSleep(ACTION_DATA(neverSleep));
+
+					this->output("Set Effect Never Sleep: [" + juce::String(ACTION_DATA(track)) + ", " + juce::String(ACTION_DATA(effect)) + "] " + juce::String(effect->getNeverSleep() ? "ON" : "OFF") + "\n");
+					ACTION_RESULT(true);
+				}
+			}
+		}
+	}
+	ACTION_RESULT(false);
+}
+
+bool ActionSetEffectNeverSleep::undo() {
+	ACTION_CHECK_RENDERING(
+		"Don't do this while rendering.");
+
+	ACTION_UNSAVE_PROJECT();
+
+	ACTION_WRITE_TYPE_UNDO(ActionSetEffectNeverSleep);
+	ACTION_WRITE_DB();
+
+	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		if (auto track = graph->getTrackProcessor(ACTION_DATA(track))) {
+			if (auto pluginDock = track->getPluginDock()) {
+				if (auto effect = pluginDock->getPluginProcessor(ACTION_DATA(effect))) {
+					effect->setNeverSleep(ACTION_DATA(oldNeverSleep));
+
+					this->output("Undo Set Effect Never Sleep: [" + juce::String(ACTION_DATA(track)) + ", " + juce::String(ACTION_DATA(effect)) + "] " + juce::String(effect->getNeverSleep() ? "ON" : "OFF") + "\n");
+					ACTION_RESULT(true);
+				}
+			}
+		}
+	}
+	ACTION_RESULT(false);
+}
+
 ActionSetEffectMidiCCInterceptByPtr::ActionSetEffectMidiCCInterceptByPtr(
 	quickAPI::PluginHolder effect, bool intercept)
 	: ACTION_DB{ effect, intercept } {}
@@ -1884,6 +1938,65 @@ bool ActionSetInstrOffline::undo() {
 	ACTION_RESULT(false);
 }
 
+ActionSetInstrFrozen::ActionSetInstrFrozen(
+	int instr, bool frozen)
+	: ACTION_DB{ instr, frozen } {}
+
+bool ActionSetInstrFrozen::doAction() {
+	ACTION_CHECK_RENDERING(
+		"Don't do this while rendering.");
+
+	ACTION_UNSAVE_PROJECT();
+
+	ACTION_WRITE_TYPE(ActionSetInstrFrozen);
+	ACTION_WRITE_DB();
+
+	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		if (auto track = graph->getSourceProcessor(ACTION_DATA(instr))) {
+			ACTION_DATA(oldFrozen) = track->getFrozen();
+
+			if (ACTION_DATA(frozen)) {
+				if (!track->freeze()) {
+					this->error("Can't Freeze Instrument: [" + juce::String(ACTION_DATA(instr)) + "]\n");
+					ACTION_RESULT(false);
+				}
+			}
+			else {
+				track->unfreeze();
+			}
+
+			this->output("Instr Frozen: [" + juce::String(ACTION_DATA(instr)) + "] " + juce::String{ track->getFrozen() ? "ON" : (track->isFreezing() ? "FREEZING" : "OFF") } + "\n");
+			ACTION_RESULT(true);
+		}
+	}
+	ACTION_RESULT(false);
+}
+
+bool ActionSetInstrFrozen::undo() {
+	ACTION_CHECK_RENDERING(
+		"Don't do this while rendering.");
+
+	ACTION_UNSAVE_PROJECT();
+
+	ACTION_WRITE_TYPE_UNDO(ActionSetInstrFrozen);
+	ACTION_WRITE_DB();
+
+	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		if (auto track = graph->getSourceProcessor(ACTION_DATA(instr))) {
+			if (ACTION_DATA(oldFrozen)) {
+				track->freeze();
+			}
+			else {
+				track->unfreeze();
+			}
+
+			this->output("Undo Instr Frozen: [" + juce::String(ACTION_DATA(instr)) + "] " + juce::String{ track->getFrozen() ? "ON" : (track->isFreezing() ? "FREEZING" : "OFF") } + "\n");
+			ACTION_RESULT(true);
+		}
+	}
+	ACTION_RESULT(false);
+}
+
 ActionSetTempoTime::ActionSetTempoTime(
 	int index, double time)
 	: ACTION_DB{ index, time } {}
@@ -2035,6 +2148,9 @@ bool ActionSetEffect::doAction() {
 					ACTION_DATA(data).setSize(state->ByteSizeLong());
 					state->SerializeToArray(ACTION_DATA(data).getData(), ACTION_DATA(data).getSize());
 
+					/** Plugin State Doesn't Carry Automation */
+					ACTION_DATA(automation) = effect->getAutomationData();
+
 					/** Remove Effect */
 					pluginDock->removePlugin(ACTION_DATA(effect));
 
@@ -2091,6 +2207,7 @@ bool ActionSetEffect::undo() {
 				auto effect = pluginDock->getPluginProcessor(ACTION_DATA(effect));
 				pluginDock->setPluginBypass(ACTION_DATA(effect), state->bypassed());
 				effect->parse(state.get(), Serializable::createParseConfigQuickly());
+				effect->setAutomationData(ACTION_DATA(automation));
 
 				this->output("Undo Set Plugin: [" + juce::String(ACTION_DATA(track)) + ", " + juce::String(ACTION_DATA(effect)) + "]" + "\n");
 				ACTION_RESULT(true);
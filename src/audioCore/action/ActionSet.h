@@ -787,6 +787,29 @@ private:
 	JUCE_LEAK_DETECTOR(ActionSetEffectMidiCCIntercept)
 };
 
+class ActionSetEffectNeverSleep final : public ActionUndoableBase {
+public:
+	ActionSetEffectNeverSleep() = delete;
+	ActionSetEffectNeverSleep(
+		int track, int effect, bool neverSleep);
+
+	bool doAction() override;
+	bool undo() override;
+	const juce::String getName() override {
+		return "Set Effect Never Sleep";
+	};
+
+private:
+	ACTION_DATABLOCK{
+		const int track, effect;
+		const bool neverSleep;
+
+		bool oldNeverSleep = false;
+	} ACTION_DB;
+
+	JUCE_LEAK_DETECTOR(ActionSetEffectNeverSleep)
+};
+
 class ActionSetEffectMidiCCInterceptByPtr final : public ActionUndoableBase {
 public:
 	ActionSetEffectMidiCCInterceptByPtr() = delete;
@@ -1034,6 +1057,29 @@ private:
 	JUCE_LEAK_DETECTOR(ActionSetInstrOffline)
 };
 
+class ActionSetInstrFrozen final : public ActionUndoableBase {
+public:
+	ActionSetInstrFrozen() = delete;
+	ActionSetInstrFrozen(
+		int instr, bool frozen);
+
+	bool doAction() override;
+	bool undo() override;
+	const juce::String getName() override {
+		return "Set Instrument Frozen";
+	};
+
+private:
+	ACTION_DATABLOCK{
+		const int instr;
+		const bool frozen;
+
+		bool oldFrozen = false;
+	} ACTION_DB;
+
+	JUCE_LEAK_DETECTOR(ActionSetInstrFrozen)
+};
+
 class ActionSetTempoTime final : public ActionUndoableBase {
 public:
 	ActionSetTempoTime() = delete;
@@ -1122,6 +1168,7 @@ private:
 		const juce::String pid;
 
 		juce::MemoryBlock data;
+		juce::var automation;
 	} ACTION_DB;
 
 	JUCE_LEAK_DETECTOR(ActionSetEffect)
@@ -28,8 +28,23 @@ const AudioCommand::CommandResult AudioCommand::processCommand(const juce::Strin
 	lua_setglobal(this->cState.get(), "res");
 
 	/** Do Command */
-	if (luaL_dostring(this->cState.get(), command.toStdString().c_str())) {
-		return AudioCommand::CommandResult{ false, command, juce::String::fromUTF8(luaL_checkstring(this->cState.get(), -1))};
+	bool failed = luaL_dostring(this->cState.get(), command.toStdString().c_str());
+
+	/** Graph Edits Stay Open Across Commands, Tell The Caller Until They Are Committed */
+	juce::String editInfo;
+	if (auto graph = AudioCore::getInstance()->getGraph()) {
+		if (int editNum = graph->getEditDepth()) {
+			editInfo = "Graph edit still open: " + juce::String(editNum)
+				+ " level(s), call AC.commitGraphEdit() or AC.abortGraphEdit().";
+		}
+	}
+
+	if (failed) {
+		juce::String error = juce::String::fromUTF8(luaL_checkstring(this->cState.get(), -1));
+		if (editInfo.isNotEmpty()) {
+			error += "\n" + editInfo;
+		}
+		return AudioCommand::CommandResult{ false, command, error };
 	}
 
 	/** Check Result */
@@ -43,6 +58,10 @@ const AudioCommand::CommandResult AudioCommand::processCommand(const juce::Strin
 	}
 	lua_pop(this->cState.get(), 2);
 
+	if (editInfo.isNotEmpty()) {
+		res += "\n" + editInfo;
+	}
+
 	return AudioCommand::CommandResult{ state, command, res };
 }
 
@@ -121,6 +121,23 @@ AUDIOCORE_FUNC(addSequencerBlock) {
 	return CommandFuncResult{ true, "" };
 }
 
+AUDIOCORE_FUNC(addMixerTrackAutomationPoint) {
+	auto action = std::unique_ptr<ActionBase>(new ActionAddMixerTrackAutomationPoint{
+		(int)luaL_checkinteger(L, 1), (int)luaL_checkinteger(L, 2),
+		(double)luaL_checknumber(L, 3), (float)luaL_checknumber(L, 4) });
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+	return CommandFuncResult{ true, "" };
+}
+
+AUDIOCORE_FUNC(addEffectAutomationPoint) {
+	auto action = std::unique_ptr<ActionBase>(new ActionAddEffectAutomationPoint{
+		(int)luaL_checkinteger(L, 1), (int)luaL_checkinteger(L, 2),
+		(int)luaL_checkinteger(L, 3), (double)luaL_checknumber(L, 4),
+		(float)luaL_checknumber(L, 5) });
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+	return CommandFuncResult{ true, "" };
+}
+
 void regCommandAdd(lua_State* L) {
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, addPluginBlackList);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, addPluginSearchPath);
@@ -138,4 +155,6 @@ void regCommandAdd(lua_State* L) {
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, addSequencerTrackInputFromDevice);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, addSequencerTrackMidiInput);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, addSequencerBlock);
+	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, addMixerTrackAutomationPoint);
+	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, addEffectAutomationPoint);
 }
@@ -112,6 +112,24 @@ AUDIOCORE_FUNC(echoEffectCCParam) {
 	return CommandFuncResult{ true, "" };
 }
 
+AUDIOCORE_FUNC(echoPluginSleep) {
+	auto action = std::unique_ptr<ActionBase>(new ActionEchoPluginSleep);
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+	return CommandFuncResult{ true, "" };
+}
+
+AUDIOCORE_FUNC(echoEngineHealth) {
+	auto action = std::unique_ptr<ActionBase>(new ActionEchoEngineHealth);
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+	return CommandFuncResult{ true, "" };
+}
+
+AUDIOCORE_FUNC(echoRenderInfo) {
+	auto action = std::unique_ptr<ActionBase>(new ActionEchoRenderInfo);
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+	return CommandFuncResult{ true, "" };
+}
+
 void regCommandEcho(lua_State* L) {
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, echoDeviceAudio);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, echoDeviceMIDI);
@@ -129,4 +147,7 @@ void regCommandEcho(lua_State* L) {
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, echoEffectParamCC);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, echoInstrCCParam);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, echoEffectCCParam);
+	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, echoPluginSleep);
+	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, echoEngineHealth);
+	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, echoRenderInfo);
 }
@@ -76,8 +76,14 @@ AUDIOCORE_FUNC(renderNow) {
 	int bitDepth = luaL_checkinteger(L, 6);
 	int quality = luaL_checkinteger(L, 7);
 
+	double startTime = luaL_optnumber(L, 8, 0);
+	double endTime = luaL_optnumber(L, 9, -1);
+	double preRollTime = luaL_optnumber(L, 10, 0);
+	bool snapToBlocks = lua_toboolean(L, 11);
+
 	auto action = std::unique_ptr<ActionBase>(new ActionRenderNow{
-		path, name, extension, tracks, metaData, bitDepth, quality });
+		path, name, extension, tracks, metaData, bitDepth, quality,
+		startTime, endTime, preRollTime, snapToBlocks });
 	ActionDispatcher::getInstance()->dispatch(std::move(action));
 	return CommandFuncResult{ true, "" };
 }
@@ -151,6 +157,24 @@ AUDIOCORE_FUNC(saveMIDI) {
 	return CommandFuncResult{ true, "" };
 }
 
+AUDIOCORE_FUNC(beginGraphEdit) {
+	auto action = std::unique_ptr<ActionBase>(new ActionBeginGraphEdit);
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+	return CommandFuncResult{ true, "" };
+}
+
+AUDIOCORE_FUNC(commitGraphEdit) {
+	auto action = std::unique_ptr<ActionBase>(new ActionCommitGraphEdit);
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+	return CommandFuncResult{ true, "" };
+}
+
+AUDIOCORE_FUNC(abortGraphEdit) {
+	auto action = std::unique_ptr<ActionBase>(new ActionAbortGraphEdit);
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+	return CommandFuncResult{ true, "" };
+}
+
 void regCommandOther(lua_State* L) {
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, clearPlugin);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, searchPlugin);
@@ -170,4 +194,7 @@ void regCommandOther(lua_State* L) {
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, loadMIDI);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, saveAudio);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, saveMIDI);
+	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, beginGraphEdit);
+	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, commitGraphEdit);
+	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, abortGraphEdit);
 }
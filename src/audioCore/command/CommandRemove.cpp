@@ -132,6 +132,22 @@ AUDIOCORE_FUNC(removeSequencerBlock) {
 	return CommandFuncResult{ true, "" };
 }
 
+AUDIOCORE_FUNC(removeMixerTrackAutomationPoint) {
+	auto action = std::unique_ptr<ActionBase>(new ActionRemoveMixerTrackAutomationPoint{
+		(int)luaL_checkinteger(L, 1), (int)luaL_checkinteger(L, 2),
+		(int)luaL_checkinteger(L, 3) });
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+	return CommandFuncResult{ true, "" };
+}
+
+AUDIOCORE_FUNC(removeEffectAutomationPoint) {
+	auto action = std::unique_ptr<ActionBase>(new ActionRemoveEffectAutomationPoint{
+		(int)luaL_checkinteger(L, 1), (int)luaL_checkinteger(L, 2),
+		(int)luaL_checkinteger(L, 3), (int)luaL_checkinteger(L, 4) });
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+	return CommandFuncResult{ true, "" };
+}
+
 void regCommandRemove(lua_State* L) {
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, removePluginBlackList);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, removePluginSearchPath);
@@ -151,4 +167,6 @@ void regCommandRemove(lua_State* L) {
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, removeSequencerTrackInputFromDevice);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, removeSequencerTrackMidiInput);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, removeSequencerBlock);
+	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, removeMixerTrackAutomationPoint);
+	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, removeEffectAutomationPoint);
 }
@@ -165,6 +165,14 @@ AUDIOCORE_FUNC(setEffectMIDICCIntercept) {
 	return CommandFuncResult{ true, "" };
 }
 
+AUDIOCORE_FUNC(setEffectNeverSleep) {
+	auto action = std::unique_ptr<ActionBase>(new ActionSetEffectNeverSleep{
+		(int)luaL_checkinteger(L, 1), (int)luaL_checkinteger(L, 2),
+		(bool)lua_toboolean(L, 3) });
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+	return CommandFuncResult{ true, "" };
+}
+
 AUDIOCORE_FUNC(setSequencerTrackBypass) {
 	auto action = std::unique_ptr<ActionBase>(new ActionSetSequencerTrackBypass{
 		(int)luaL_checkinteger(L, 1), (bool)lua_toboolean(L, 2) });
@@ -234,6 +242,13 @@ AUDIOCORE_FUNC(setInstrOffline) {
 	return CommandFuncResult{ true, "" };
 }
 
+AUDIOCORE_FUNC(setInstrFrozen) {
+	auto action = std::unique_ptr<ActionBase>(new ActionSetInstrFrozen{
+		(int)luaL_checkinteger(L, 1), (bool)lua_toboolean(L, 2) });
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+	return CommandFuncResult{ true, "" };
+}
+
 void regCommandSet(lua_State* L) {
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, setDeviceAudioType);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, setDeviceAudioInput);
@@ -256,6 +271,7 @@ void regCommandSet(lua_State* L) {
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, setEffectParamConnectToCC);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, setInstrMIDICCIntercept);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, setEffectMIDICCIntercept);
+	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, setEffectNeverSleep);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, setSequencerTrackBypass);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, setPlayPosition);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, setReturnToStart);
@@ -264,4 +280,5 @@ void regCommandSet(lua_State* L) {
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, setAudioSaveQualityOptionIndex);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, setSequencerTrackRecording);
 	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, setInstrOffline);
+	LUA_ADD_AUDIOCORE_FUNC_DEFAULT_NAME(L, setInstrFrozen);
 }
@@ -1,6 +1,7 @@
 ﻿#include "AudioDebugger.h"
 #include "../AudioCore.h"
 #include "../misc/Device.h"
+#include "../misc/EngineHealth.h"
 #include "../command/AudioCommand.h"
 
 AudioDebugger::AudioDebugger() {
@@ -10,6 +11,16 @@ AudioDebugger::AudioDebugger() {
 	this->deviceSelector = Device::createDeviceSelector();
 	this->addAndMakeVisible(this->deviceSelector.get());
 
+	/** Engine Health */
+	this->healthOutput = std::make_unique<juce::TextEditor>();
+	this->healthOutput->setMultiLine(true);
+	this->healthOutput->setReadOnly(true);
+	this->healthOutput->setScrollbarsShown(true);
+	this->healthOutput->setCaretVisible(false);
+	this->healthOutput->setPopupMenuEnabled(true);
+	this->addAndMakeVisible(this->healthOutput.get());
+	this->startTimer(500);
+
 	/** Command */
 	this->commandOutput = std::make_unique<CommandOutputComponent>();
 	this->addAndMakeVisible(this->commandOutput.get());
@@ -46,7 +57,9 @@ AudioDebugger::AudioDebugger() {
 
 void AudioDebugger::resized() {
 	this->deviceSelector->setBounds(
-		this->getLocalBounds().withTrimmedRight(this->getWidth() / 2));
+		this->getLocalBounds().withTrimmedRight(this->getWidth() / 2).withTrimmedBottom(this->getHeight() * 0.35));
+	this->healthOutput->setBounds(
+		this->getLocalBounds().withTrimmedRight(this->getWidth() / 2).withTrimmedTop(this->getHeight() * 0.65));
 	this->commandInput->setBounds(
 		this->getLocalBounds().withTrimmedLeft(this->getWidth() / 2).withHeight(this->getHeight() * 0.05));
 	this->commandOutput->setBounds(
@@ -66,3 +79,27 @@ void AudioDebugger::userTriedToCloseWindow() {
 void AudioDebugger::output(const juce::String& mes) {
 	this->commandOutput->add(mes);
 }
+
+void AudioDebugger::timerCallback() {
+	if (!this->isShowing()) { return; }
+
+	auto health = EngineHealth::getInstance();
+	juce::String result;
+
+	/** Counters */
+	for (int i = 0; i < (int)EngineHealth::EventType::TypeNum; i++) {
+		auto type = static_cast<EngineHealth::EventType>(i);
+		result += EngineHealth::getTypeName(type) + ": " + juce::String{ health->getCount(type) } + "\n";
+	}
+
+	/** Latest Events */
+	result += "\n";
+	auto events = health->getEvents();
+	for (int i = events.size() - 1; i >= 0 && i >= events.size() - 100; i--) {
+		result += EngineHealth::toString(events.getReference(i)) + "\n";
+	}
+
+	if (result != this->healthOutput->getText()) {
+		this->healthOutput->setText(result, false);
+	}
+}
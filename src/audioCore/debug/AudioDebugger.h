@@ -5,7 +5,8 @@
 
 class AudioCore;
 
-class AudioDebugger final : public juce::Component {
+class AudioDebugger final : public juce::Component,
+	private juce::Timer {
 public:
 	AudioDebugger();
 
@@ -16,8 +17,12 @@ public:
 
 	void output(const juce::String& mes);
 
+private:
+	void timerCallback() override;
+
 private:
 	std::unique_ptr<juce::AudioDeviceSelectorComponent> deviceSelector = nullptr;
+	std::unique_ptr<juce::TextEditor> healthOutput = nullptr;
 	std::unique_ptr<juce::TextEditor> commandInput = nullptr;
 	std::unique_ptr<CommandOutputComponent> commandOutput = nullptr;
 
@@ -0,0 +1,100 @@
+﻿#include "GraphTransaction.h"
+
+void GraphTransaction::beginTransaction() {
+	if (this->transactionDepth++ == 0) {
+		this->transactionBegan();
+	}
+}
+
+void GraphTransaction::commitTransaction() {
+	if (this->transactionDepth <= 0) { jassertfalse; return; }
+	if (--(this->transactionDepth) > 0) { return; }
+
+	/** Rebuild */
+	this->transactionCommitted();
+
+	/** Callback */
+	auto callbacks = std::move(this->pendingCallbacks);
+	auto pairCallbacks = std::move(this->pendingPairCallbacks);
+	this->pendingCallbacks.clear();
+	this->pendingPairCallbacks.clear();
+
+	int index = this->getTransactionIndex();
+	for (auto type : callbacks) {
+		UICallbackAPI<int>::invoke(type, index);
+	}
+	for (auto type : pairCallbacks) {
+		UICallbackAPI<int, int>::invoke(type, index, -1);
+	}
+}
+
+bool GraphTransaction::isInTransaction() const {
+	return this->transactionDepth > 0;
+}
+
+void GraphTransaction::beginEdit() {
+	this->editDepth++;
+	this->lastEditTimeMs = juce::Time::getMillisecondCounterHiRes();
+	this->beginTransaction();
+}
+
+bool GraphTransaction::commitEdit() {
+	if (this->editDepth <= 0) { return false; }
+
+	this->editDepth--;
+	this->lastEditTimeMs = juce::Time::getMillisecondCounterHiRes();
+	this->commitTransaction();
+	return true;
+}
+
+int GraphTransaction::abortEdit() {
+	int num = 0;
+	while (this->commitEdit()) {
+		num++;
+	}
+	return num;
+}
+
+int GraphTransaction::getEditDepth() const {
+	return this->editDepth;
+}
+
+bool GraphTransaction::isEditTimedOut() const {
+	return this->editDepth > 0
+		&& (juce::Time::getMillisecondCounterHiRes() - this->lastEditTimeMs) > GraphTransaction::editTimeoutMs;
+}
+
+GraphTransaction::ScopedTransaction::ScopedTransaction(GraphTransaction* graph)
+	: graph(graph) {
+	if (this->graph) {
+		this->graph->beginTransaction();
+	}
+}
+
+GraphTransaction::ScopedTransaction::~ScopedTransaction() {
+	if (this->graph) {
+		this->graph->commitTransaction();
+	}
+}
+
+juce::AudioProcessorGraph::UpdateKind GraphTransaction::getUpdateKind() const {
+	return this->isInTransaction()
+		? juce::AudioProcessorGraph::UpdateKind::none
+		: juce::AudioProcessorGraph::UpdateKind::sync;
+}
+
+void GraphTransaction::invokeCallback(UICallbackType type, int index) {
+	if (this->isInTransaction()) {
+		this->pendingCallbacks.insert(type);
+		return;
+	}
+	UICallbackAPI<int>::invoke(type, index);
+}
+
+void GraphTransaction::invokeCallback(UICallbackType type, int index, int subIndex) {
+	if (this->isInTransaction()) {
+		this->pendingPairCallbacks.insert(type);
+		return;
+	}
+	UICallbackAPI<int, int>::invoke(type, index, subIndex);
+}
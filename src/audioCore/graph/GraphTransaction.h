@@ -0,0 +1,70 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+#include "../uiCallback/UICallback.h"
+
+/**
+ * Nested begin/commit pairs for editing a graph in bulk.
+ * While a transaction is open, nodes and connections change without rebuilding the render
+ * sequence and UI callbacks are only collected. The outermost commit rebuilds once and
+ * invokes every collected callback type once.
+ */
+class GraphTransaction {
+public:
+	GraphTransaction() = default;
+	virtual ~GraphTransaction() = default;
+
+	void beginTransaction();
+	void commitTransaction();
+	bool isInTransaction() const;
+
+	/**
+	 * @brief	Levels opened from the command API. They stay open across commands and only close
+	 *			levels opened the same way, so an edit can span several commands.
+	 */
+	void beginEdit();
+	bool commitEdit();
+	/**
+	 * @brief	Close every level opened from the command API and return the number of levels closed.
+	 * @attention	Edits made so far take effect, they are not rolled back.
+	 */
+	int abortEdit();
+	int getEditDepth() const;
+	/**
+	 * @brief	No level opened or committed from the command API within editTimeoutMs.
+	 */
+	bool isEditTimedOut() const;
+	static constexpr double editTimeoutMs = 60000;
+
+	class ScopedTransaction final {
+	public:
+		ScopedTransaction() = delete;
+		explicit ScopedTransaction(GraphTransaction* graph);
+		~ScopedTransaction();
+
+	private:
+		GraphTransaction* const graph;
+
+		JUCE_DECLARE_NON_COPYABLE(ScopedTransaction)
+	};
+
+protected:
+	juce::AudioProcessorGraph::UpdateKind getUpdateKind() const;
+
+	/**
+	 * @brief	Invoke the callback now, or collect it until the transaction is committed.
+	 * @attention	Collected callbacks are invoked with the index from getTransactionIndex().
+	 */
+	void invokeCallback(UICallbackType type, int index);
+	void invokeCallback(UICallbackType type, int index, int subIndex);
+
+	virtual int getTransactionIndex() const { return -1; };
+	virtual void transactionBegan() {};
+	virtual void transactionCommitted() = 0;
+
+private:
+	int transactionDepth = 0;
+	int editDepth = 0;
+	double lastEditTimeMs = 0;
+	std::set<UICallbackType> pendingCallbacks, pendingPairCallbacks;
+};
@@ -3,6 +3,7 @@
 #include "../misc/PlayPosition.h"
 #include "../misc/Renderer.h"
 #include "../misc/AudioLock.h"
+#include "../misc/EngineHealth.h"
 #include "../misc/VMath.h"
 #include "../uiCallback/UICallback.h"
 #include "../AudioCore.h"
@@ -12,7 +13,8 @@
 
 using namespace org::vocalsharp::vocalshaper;
 
-MainGraph::MainGraph() {
+MainGraph::MainGraph()
+	: scheduler(std::make_unique<ParallelScheduler>()) {
 	/** The Main Audio IO Node */
 	this->audioInputNode = this->addNode(
 		std::make_unique<juce::AudioProcessorGraph::AudioGraphIOProcessor>(
@@ -31,9 +33,22 @@ MainGraph::MainGraph() {
 
 	/** The Source Recorder Node */
 	this->recorder = std::make_unique<SourceRecordProcessor>(this);
+
+	/** Schedule */
+	this->updateSchedule();
+
+	/** MIDI Event Queues */
+	this->startTimer(20);
+
+	/** Render Ahead */
+	this->aheadThread = std::make_unique<RenderAheadThread>(this);
+	this->aheadThread->startThread(juce::Thread::Priority::high);
 }
 
 MainGraph::~MainGraph() {
+	this->aheadThread->stop();
+	this->stopTimer();
+	this->cancelPendingUpdate();
 	this->clearGraph();
 }
 
@@ -65,26 +80,44 @@ void MainGraph::setAudioLayout(int inputChannelNum, int outputChannelNum) {
 	this->getRecorder()->setBusesLayout(inputLayout);
 
 	/** Set Level Size */
-	{
-		juce::ScopedWriteLock locker(audioLock::getLevelMeterLock());
-		this->outputLevels.resize(outputChannelNum);
-	}
+	this->outputMeter.setChannelNum(outputChannelNum);
 }
 
-void MainGraph::setMIDIMessageHook(
-	const std::function<void(const juce::MidiMessage&, bool)> hook) {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
-	this->midiHook = hook;
+void MainGraph::setMIDIMessageHook(const MIDIMessageHook hook) {
+	this->midiHook.publish(std::make_unique<MIDIMessageHook>(hook));
 }
 
 void MainGraph::setMIDICCListener(const MIDICCListener& listener) {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
-	this->ccListener = listener;
+	this->ccListener.publish(std::make_unique<MIDICCListener>(listener));
 }
 
 void MainGraph::clearMIDICCListener() {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
-	this->ccListener = MIDICCListener{};
+	this->ccListener.publish(std::make_unique<MIDICCListener>());
+}
+
+uint64_t MainGraph::getMIDIEventOverflowNum() const {
+	uint64_t result = this->midiHookEvents.getOverflowNum() + this->ccEvents.getOverflowNum();
+
+	for (auto& i : this->audioSourceNodeList) {
+		if (auto source = dynamic_cast<SeqSourceProcessor*>(i->getProcessor())) {
+			if (auto instr = source->getInstrProcessor()) {
+				result += instr->getMIDIEventOverflowNum();
+			}
+		}
+	}
+	for (auto& i : this->trackNodeList) {
+		if (auto track = dynamic_cast<Track*>(i->getProcessor())) {
+			if (auto dock = track->getPluginDock()) {
+				for (int j = 0; j < dock->getPluginNum(); j++) {
+					if (auto plugin = dock->getPluginProcessor(j)) {
+						result += plugin->getMIDIEventOverflowNum();
+					}
+				}
+			}
+		}
+	}
+
+	return result;
 }
 
 void MainGraph::prepareToPlay(double sampleRate, int maximumExpectedSamplesPerBlock) {
@@ -104,6 +137,21 @@ void MainGraph::prepareToPlay(double sampleRate, int maximumExpectedSamplesPerBl
 	/** Current Graph */
 	this->juce::AudioProcessorGraph::prepareToPlay(
 		sampleRate, maximumExpectedSamplesPerBlock);
+
+	/** Conceal Buffer */
+	{
+		juce::SpinLock::ScopedLockType locker(this->concealLock);
+		this->concealBuffer.setSize(
+			std::max(this->getTotalNumInputChannels(), this->getTotalNumOutputChannels()),
+			maximumExpectedSamplesPerBlock, false, true, true);
+		this->concealValid = false;
+	}
+
+	/** Note Close Buffer */
+	this->noteCloseTemp.ensureSize(4096);
+
+	/** Schedule Buffers */
+	this->updateSchedule();
 }
 
 void MainGraph::setPlayHead(juce::AudioPlayHead* newPlayHead) {
@@ -145,69 +193,127 @@ void MainGraph::clearGraph() {
 	juce::ScopedWriteLock locker(audioLock::getSourceLock());
 
 	for (auto& i : this->midiI2SrcConnectionList) {
-		this->removeConnection(i);
+		this->removeConnection(i, this->getUpdateKind());
 	}
 	this->midiI2SrcConnectionList.clear();
 
 	for (auto& i : this->audioI2SrcConnectionList) {
-		this->removeConnection(i);
+		this->removeConnection(i, this->getUpdateKind());
 	}
 	this->audioI2SrcConnectionList.clear();
 
 	for (auto& i : this->midiSrc2TrkConnectionList) {
-		this->removeConnection(i);
+		this->removeConnection(i, this->getUpdateKind());
 	}
 	this->midiSrc2TrkConnectionList.clear();
 
 	for (auto& i : this->audioSrc2TrkConnectionList) {
-		this->removeConnection(i);
+		this->removeConnection(i, this->getUpdateKind());
 	}
 	this->audioSrc2TrkConnectionList.clear();
 
 	for (auto& i : this->midiI2TrkConnectionList) {
-		this->removeConnection(i);
+		this->removeConnection(i, this->getUpdateKind());
 	}
 	this->midiI2TrkConnectionList.clear();
 
 	for (auto& i : this->audioI2TrkConnectionList) {
-		this->removeConnection(i);
+		this->removeConnection(i, this->getUpdateKind());
 	}
 	this->audioI2TrkConnectionList.clear();
 
 	for (auto& i : this->audioTrk2TrkConnectionList) {
-		this->removeConnection(i);
+		this->removeConnection(i, this->getUpdateKind());
 	}
 	this->audioTrk2TrkConnectionList.clear();
 
 	for (auto& i : this->audioTrk2OConnectionList) {
-		this->removeConnection(i);
+		this->removeConnection(i, this->getUpdateKind());
 	}
 	this->audioTrk2OConnectionList.clear();
 
 	for (auto& i : this->midiTrk2OConnectionList) {
-		this->removeConnection(i);
+		this->removeConnection(i, this->getUpdateKind());
 	}
 	this->midiTrk2OConnectionList.clear();
 
 	for (auto& i : this->trackNodeList) {
-		this->removeNode(i->nodeID);
+		this->removeNode(i->nodeID, this->getUpdateKind());
 	}
 	this->trackNodeList.clear();
 
 	for (auto& i : this->audioSourceNodeList) {
-		this->removeNode(i->nodeID);
+		this->removeNode(i->nodeID, this->getUpdateKind());
 	}
 	this->audioSourceNodeList.clear();
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::InstrChanged, -1);
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, -1);
-	UICallbackAPI<int>::invoke(UICallbackType::SeqChanged, -1);
+	this->invokeCallback(UICallbackType::InstrChanged, -1);
+	this->invokeCallback(UICallbackType::TrackChanged, -1);
+	this->invokeCallback(UICallbackType::SeqChanged, -1);
 }
 
 const juce::Array<float> MainGraph::getOutputLevels() const {
-	juce::ScopedReadLock locker(audioLock::getLevelMeterLock());
-	return this->outputLevels;
+	return this->outputMeter.getRMSLevels();
+}
+
+const juce::Array<float> MainGraph::getOutputPeakLevels() const {
+	return this->outputMeter.getPeakLevels();
+}
+
+const juce::Array<float> MainGraph::getOutputTruePeakLevels() const {
+	return this->outputMeter.getTruePeakLevels();
+}
+
+uint64_t MainGraph::getFallbackBlockNum() const {
+	return this->fallbackBlockNum;
+}
+
+void MainGraph::setParallelThreadNum(int num) {
+	this->scheduler->setThreadNum(num);
+}
+
+int MainGraph::getParallelThreadNum() const {
+	return this->scheduler->getThreadNum();
+}
+
+void MainGraph::transactionBegan() {
+	/** Sources And Tracks Join The Transaction */
+	for (auto& i : this->audioSourceNodeList) {
+		if (auto source = dynamic_cast<SeqSourceProcessor*>(i->getProcessor())) {
+			source->beginTransaction();
+		}
+	}
+	for (auto& i : this->trackNodeList) {
+		if (auto track = dynamic_cast<Track*>(i->getProcessor())) {
+			track->beginTransaction();
+		}
+	}
+}
+
+void MainGraph::transactionCommitted() {
+	/** Commit Sources And Tracks */
+	for (auto& i : this->audioSourceNodeList) {
+		if (auto source = dynamic_cast<SeqSourceProcessor*>(i->getProcessor())) {
+			if (source->isInTransaction()) {
+				source->commitTransaction();
+			}
+		}
+	}
+	for (auto& i : this->trackNodeList) {
+		if (auto track = dynamic_cast<Track*>(i->getProcessor())) {
+			if (track->isInTransaction()) {
+				track->commitTransaction();
+			}
+		}
+	}
+
+	/** Rebuild Once */
+	this->rebuild();
+	this->updateSchedule();
 }
 
 void MainGraph::updateARAContext() {
@@ -250,6 +356,9 @@ bool MainGraph::parse(
 	auto mes = dynamic_cast<const vsp4::MainGraph*>(data);
 	if (!mes) { return false; }
 
+	/** Rebuild Once After Parsing */
+	GraphTransaction::ScopedTransaction transaction{ this };
+
 	this->clearGraph();
 
 	auto& seqTracks = mes->seqtracks();
@@ -479,31 +588,49 @@ std::unique_ptr<google::protobuf::Message> MainGraph::serialize(
 }
 
 void MainGraph::processBlock(juce::AudioBuffer<float>& audio, juce::MidiBuffer& midi) {
-	/** Lock */
-	juce::ScopedWriteLock levelLocker(audioLock::getLevelMeterLock());
+	int64_t position = this->getCurrentPositionInSamples();
+	auto startTicks = juce::Time::getHighResolutionTicks();
+
+	this->processBlockInternal(audio, midi);
+
+	/** Callback Missed Its Deadline */
+	if (!Renderer::getInstance()->getRendering()) {
+		double sampleRate = this->getSampleRate();
+		double costSeconds = juce::Time::highResolutionTicksToSeconds(
+			juce::Time::getHighResolutionTicks() - startTicks);
+		if (sampleRate > 0 && costSeconds > audio.getNumSamples() / sampleRate) {
+			EngineHealth::getInstance()->report(EngineHealth::EventType::Overrun, position);
+		}
+	}
+}
+
+void MainGraph::processBlockInternal(juce::AudioBuffer<float>& audio, juce::MidiBuffer& midi) {
+	/** Lock Graph Structure */
 	juce::ScopedTryReadLock audioLocker(audioLock::getAudioLock());
-	juce::ScopedTryWriteLock sourceLocker(audioLock::getSourceLock());
+	juce::ScopedTryReadLock sourceLocker(audioLock::getSourceLock());
 	juce::ScopedTryReadLock pluginLocker(audioLock::getPluginLock());
+
+	/** Nodes Read Transport And Tempo Without Locking, Keep Message Thread Writes Out Of The Block */
 	juce::ScopedTryWriteLock positionLocker(audioLock::getPositionLock());
-	juce::ScopedTryReadLock controlLocker(audioLock::getAudioControlLock());
-	if (!(audioLocker.isLocked() && pluginLocker.isLocked() 
-		&& sourceLocker.isLocked()  && positionLocker.isLocked() && controlLocker.isLocked())) {
-		vMath::zeroAllAudioData(audio);
-		midi.clear();
+
+	if (!(audioLocker.isLocked() && sourceLocker.isLocked()
+		&& pluginLocker.isLocked() && positionLocker.isLocked())) {
+		this->processFallbackBlock(audio, midi);
 		return;
 	}
 
 	/** Render State */
 	bool isRendering = Renderer::getInstance()->getRendering();
 
+	/** Get Hooks */
+	AudioSnapshot<MIDIMessageHook>::Reader midiHook{ this->midiHook };
+	AudioSnapshot<MIDICCListener>::Reader ccListener{ this->ccListener };
+
 	/** Call MIDI Hook */
 	if(!isRendering) {
-		if (this->midiHook) {
+		if (*midiHook) {
 			for (auto m : midi) {
-				juce::MessageManager::callAsync(
-					[mes = m.getMessage(), hook = this->midiHook] {
-						hook(mes, true);
-					});
+				this->pushMIDIHookEvent(m, true);
 			}
 		}
 	}
@@ -522,9 +649,11 @@ void MainGraph::processBlock(juce::AudioBuffer<float>& audio, juce::MidiBuffer&
 		}
 
 		/** Send Auto Connect */
-		if ((lastCCChannel > -1) && this->ccListener) {
-			juce::MessageManager::callAsync(
-				std::bind(this->ccListener, lastCCChannel));
+		if ((lastCCChannel > -1) && *ccListener) {
+			if (!this->ccEvents.push(lastCCChannel)) {
+				EngineHealth::getInstance()->report(
+					EngineHealth::EventType::MIDIOverflow, this->getCurrentPositionInSamples());
+			}
 		}
 	}
 
@@ -569,7 +698,18 @@ void MainGraph::processBlock(juce::AudioBuffer<float>& audio, juce::MidiBuffer&
 	/** Process Audio Block */
 	{
 		this->recorder->processBlock(audio, midi);
-		this->juce::AudioProcessorGraph::processBlock(audio, midi);
+		if (!this->processScheduledBlock(audio, midi)) {
+			/** The Render Ahead Thread Shares The Processors */
+			juce::SpinLock::ScopedTryLockType aheadLocker(this->aheadLock);
+			if (!aheadLocker.isLocked()) {
+				this->processFallbackBlock(audio, midi);
+				return;
+			}
+
+			this->juce::AudioProcessorGraph::processBlock(audio, midi);
+			this->restartRenderAhead(
+				this->getCurrentPositionInSamples(), audio.getNumSamples());
+		}
 	}
 
 	/** Truncate Output */
@@ -578,29 +718,133 @@ void MainGraph::processBlock(juce::AudioBuffer<float>& audio, juce::MidiBuffer&
 		midi.clear();
 	}
 
-	/** Get Level */
-	for (int i = 0; i < audio.getNumChannels() && i < this->outputLevels.size(); i++) {
-		this->outputLevels.getReference(i) =
-			audio.getRMSLevel(i, 0, audio.getNumSamples());
+	/** Close Notes On The MIDI Output Held Before This Block */
+	if (this->noteCloseFlag.exchange(false)) {
+		this->outputNotes.closeAllAhead(midi, this->noteCloseTemp);
 	}
+	this->outputNotes.update(midi);
+
+	/** Get Level */
+	this->outputMeter.process(audio, this->getSampleRate());
+
+	/** Save Output For Fallback */
+	this->saveConcealBlock(audio);
 
 	/** MIDI Output */
 	if (!isRendering) {
-		if (this->midiHook) {
+		if (*midiHook) {
 			for (auto m : midi) {
-				juce::MessageManager::callAsync(
-					[mes = m.getMessage(), hook = this->midiHook] {
-						hook(mes, false);
-					});
+				this->pushMIDIHookEvent(m, false);
 			}
 		}
 	}
 
 	/** Add Position */
+	this->updatePosition(audio.getNumSamples());
+}
+
+void MainGraph::pushMIDIHookEvent(const juce::MidiMessageMetadata& message, bool isInput) {
+	/** Long SysEx Doesn't Fit In The Queue */
+	MIDIHookEvent event;
+	if (message.numBytes <= 0 || message.numBytes > event.data.size()) {
+		this->midiHookEvents.addOverflow();
+		EngineHealth::getInstance()->report(
+			EngineHealth::EventType::MIDIOverflow, this->getCurrentPositionInSamples());
+		return;
+	}
+
+	std::memcpy(event.data.data(), message.data, message.numBytes);
+	event.size = message.numBytes;
+	event.samplePosition = message.samplePosition;
+	event.isInput = isInput;
+	if (!this->midiHookEvents.push(event)) {
+		EngineHealth::getInstance()->report(
+			EngineHealth::EventType::MIDIOverflow, this->getCurrentPositionInSamples());
+	}
+}
+
+void MainGraph::timerCallback() {
+	/** Graph Edit Left Open By A Script */
+	if (this->isEditTimedOut()) {
+		int num = this->abortEdit();
+		UICallbackAPI<const juce::String&>::invoke(UICallbackType::ErrorMessage,
+			"Graph edit timed out, " + juce::String(num) + " level(s) closed.");
+	}
+
+	/** Direct MIDI, Monitoring And Recording Decide Which Sources Play Live */
+	this->updateLiveSources();
+
+	/** MIDI Hook */
+	auto hook = this->midiHook.getLatest();
+	this->midiHookEvents.drain([&hook](const MIDIHookEvent& event) {
+		if (hook) {
+			hook(juce::MidiMessage{ event.data.data(), event.size, (double)event.samplePosition }, event.isInput);
+		}
+		});
+
+	/** CC Listener Only Needs The Last CC */
+	int lastCCChannel = -1;
+	this->ccEvents.drain([&lastCCChannel](int channel) {
+		lastCCChannel = channel;
+		});
+	if (lastCCChannel > -1) {
+		auto listener = this->ccListener.getLatest();
+		if (listener) {
+			listener(lastCCChannel);
+		}
+	}
+}
+
+void MainGraph::saveConcealBlock(const juce::AudioBuffer<float>& audio) {
+	juce::SpinLock::ScopedTryLockType locker(this->concealLock);
+	if (!locker.isLocked()) { return; }
+
+	int channels = std::min(audio.getNumChannels(), this->concealBuffer.getNumChannels());
+	int samples = audio.getNumSamples();
+	if (channels <= 0 || samples > this->concealBuffer.getNumSamples()) {
+		this->concealValid = false;
+		return;
+	}
+
+	for (int i = 0; i < channels; i++) {
+		vMath::copyAudioData(this->concealBuffer, audio, 0, 0, i, i, samples);
+	}
+	this->concealValid = true;
+}
+
+void MainGraph::processFallbackBlock(juce::AudioBuffer<float>& audio, juce::MidiBuffer& midi) {
+	/** Count */
+	this->fallbackBlockNum++;
+	EngineHealth::getInstance()->report(
+		EngineHealth::EventType::MissedLock, this->getCurrentPositionInSamples());
+
+	/** Clear Output */
+	midi.clear();
+	vMath::zeroAllAudioData(audio);
+
+	/** Mirror And Fade Out The Last Block To Avoid A Click */
+	juce::SpinLock::ScopedTryLockType locker(this->concealLock);
+	if (!locker.isLocked()) { return; }
+	if (!this->concealValid) { return; }
+	this->concealValid = false;
+
+	int channels = std::min(audio.getNumChannels(), this->concealBuffer.getNumChannels());
+	int samples = audio.getNumSamples();
+	if (samples > this->concealBuffer.getNumSamples()) { return; }
+
+	for (int i = 0; i < channels; i++) {
+		auto src = this->concealBuffer.getReadPointer(i);
+		auto dst = audio.getWritePointer(i);
+		for (int j = 0; j < samples; j++) {
+			dst[j] = src[samples - 1 - j] * (1.f - (float)j / samples);
+		}
+	}
+}
+
+void MainGraph::updatePosition(int clipSize) {
 	if (auto position = dynamic_cast<PlayPosition*>(this->getPlayHead())) {
 		/** Current Time */
 		int currentPos = position->getPosition()->getTimeInSamples().orFallback(0);
-		int clipSize = audio.getNumSamples();
 
 		/** Check Loop */
 		if (position->getLooping()) {
@@ -625,3 +869,12 @@ void MainGraph::processBlock(juce::AudioBuffer<float>& audio, juce::MidiBuffer&
 		}
 	}
 }
+
+int64_t MainGraph::getCurrentPositionInSamples() const {
+	if (auto playHead = this->getPlayHead()) {
+		if (auto position = playHead->getPosition()) {
+			return position->getTimeInSamples().orFallback(0);
+		}
+	}
+	return 0;
+}
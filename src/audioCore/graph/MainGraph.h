@@ -5,11 +5,20 @@
 #include "PluginDecorator.h"
 #include "SeqSourceProcessor.h"
 #include "SourceRecordProcessor.h"
+#include "GraphTransaction.h"
 #include "../project/Serializable.h"
+#include "../misc/AudioSnapshot.h"
+#include "../misc/ActiveNoteTable.h"
+#include "../misc/LevelMeter.h"
+#include "../misc/RealtimeFifo.h"
+#include "../misc/ParallelScheduler.h"
 #include "../Utils.h"
 
 class MainGraph final : public juce::AudioProcessorGraph,
-	public Serializable {
+	public GraphTransaction,
+	public Serializable,
+	private juce::AsyncUpdater,
+	private juce::Timer {
 public:
 	MainGraph();
 	~MainGraph() override;
@@ -81,12 +90,18 @@ public:
 	/**
 	 * @brief	Set the MIDI Message Hook.
 	 */
-	void setMIDIMessageHook(const std::function<void(const juce::MidiMessage&, bool)> hook);
+	using MIDIMessageHook = std::function<void(const juce::MidiMessage&, bool)>;
+	void setMIDIMessageHook(const MIDIMessageHook hook);
 
 	using MIDICCListener = std::function<void(int)>;
 	void setMIDICCListener(const MIDICCListener& listener);
 	void clearMIDICCListener();
 
+	/**
+	 * @brief	Get the number of MIDI hook and CC listener events dropped because the queues were full.
+	 */
+	uint64_t getMIDIEventOverflowNum() const;
+
 	void closeAllNote();
 
 	void prepareToPlay(double sampleRate, int maximumExpectedSamplesPerBlock) override;
@@ -99,6 +114,33 @@ public:
 
 	void updateARAContext();
 	const juce::Array<float> getOutputLevels() const;
+	const juce::Array<float> getOutputPeakLevels() const;
+	const juce::Array<float> getOutputTruePeakLevels() const;
+
+	/**
+	 * @brief	Get the number of blocks that could not be processed normally because the graph was being rebuilt.
+	 */
+	uint64_t getFallbackBlockNum() const;
+
+	/**
+	 * @brief	Set the number of worker threads processing sources and tracks besides the audio thread.
+	 */
+	void setParallelThreadNum(int num);
+	int getParallelThreadNum() const;
+
+	/**
+	 * @brief	Set the number of blocks rendered ahead of the transport for sources and tracks without live input. 0 to disable.
+	 * @attention	Input monitored, record armed or device fed chains always run live.
+	 */
+	void setRenderAheadBlockNum(int num);
+	int getRenderAheadBlockNum() const;
+
+	/**
+	 * @brief	Drop the blocks rendered ahead after an edit, the ring is refilled from the current position.
+	 */
+	void invalidateRenderAhead();
+
+	static constexpr int maxRenderAheadBlockNum = 16;
 
 	void writeRecordingDataToSource(
 		double startTime, double currentTime, double sampleRate,
@@ -150,14 +192,109 @@ private:
 	juce::Array<juce::AudioProcessorGraph::Connection> audioTrk2OConnectionList;
 	juce::Array<juce::AudioProcessorGraph::Connection> midiTrk2OConnectionList;
 
-	std::function<void(const juce::MidiMessage&, bool)> midiHook;
+	AudioSnapshot<MIDIMessageHook> midiHook;
+	AudioSnapshot<MIDICCListener> ccListener;
+
+	struct MIDIHookEvent final {
+		std::array<juce::uint8, 16> data;
+		int size = 0;
+		int samplePosition = 0;
+		bool isInput = false;
+	};
+	RealtimeFifo<MIDIHookEvent, 4096> midiHookEvents;
+	RealtimeFifo<int, 256> ccEvents;
 
-	MIDICCListener ccListener;
+	LevelMeter outputMeter;
 
-	juce::Array<float> outputLevels;
+	juce::AudioBuffer<float> concealBuffer;
+	bool concealValid = false;
+	juce::SpinLock concealLock;
+	std::atomic_uint64_t fallbackBlockNum = 0;
+
+	ActiveNoteTable outputNotes;
+	std::atomic_bool noteCloseFlag = false;
+	juce::MidiBuffer noteCloseTemp;
 
 	mutable double totalLengthTemp = 0;
 
+	struct ScheduleLink final {
+		int srcTask = -1;
+		int srcChannel = 0;
+		int dstChannel = 0;
+	};
+	struct ScheduleNode final {
+		juce::AudioProcessorGraph::Node::Ptr node;
+		juce::Array<ScheduleLink> audioInputs;
+		juce::Array<int> midiInputs;
+		int bufferChannels = 0, bufferSamples = 0;
+		bool anticipative = false, aheadOutput = false;
+	};
+	struct TaskBuffers final {
+		juce::Array<juce::AudioBuffer<float>*> audio;
+		juce::Array<juce::MidiBuffer*> midi;
+	};
+	struct AheadBlock final {
+		int64_t position = -1;
+		int numSamples = 0;
+		uint64_t generation = 0;
+		TaskBuffers buffers;
+		juce::OwnedArray<juce::AudioBuffer<float>> audioStorage;
+		juce::OwnedArray<juce::MidiBuffer> midiStorage;
+	};
+	struct AheadRing final {
+		explicit AheadRing(int capacity) : fifo(capacity) {};
+
+		juce::AbstractFifo fifo;
+		juce::OwnedArray<AheadBlock> blocks;
+	};
+	struct Schedule final {
+		bool valid = false;
+		juce::OwnedArray<ScheduleNode> nodes;
+		juce::OwnedArray<juce::AudioBuffer<float>> audioSlots;
+		juce::OwnedArray<juce::MidiBuffer> midiSlots;
+		TaskBuffers buffers;
+		ParallelScheduler::TaskGraph taskGraph;
+		juce::Array<ScheduleLink> audioOutputs;
+		juce::Array<int> midiOutputs;
+		juce::Array<int> aheadOrder;
+		std::unique_ptr<AheadRing> ahead;
+	};
+	AudioSnapshot<Schedule> schedule;
+	std::unique_ptr<ParallelScheduler> scheduler;
+
+	class RenderAheadThread final : public juce::Thread {
+	public:
+		RenderAheadThread() = delete;
+		explicit RenderAheadThread(MainGraph* parent);
+
+		void wakeUp();
+		void stop();
+
+		void run() override;
+
+	private:
+		MainGraph* const parent;
+		std::binary_semaphore wakeUpSemaphore{ 0 };
+		std::atomic_bool wakeUpRequested = false;
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RenderAheadThread)
+	};
+	std::unique_ptr<RenderAheadThread> aheadThread;
+	std::atomic_int renderAheadBlockNum = 0;
+	/** Sources Kept Live By The Current Schedule, Message Thread Only */
+	juce::BigInteger liveSources;
+
+	/** Held By Whichever Thread Processes The Anticipative Tasks, Guards The Cursor */
+	juce::SpinLock aheadLock;
+	int64_t aheadCursor = -1;
+	std::atomic_uint64_t aheadGeneration = 0;
+	std::atomic_int64_t aheadLivePosition = 0;
+	std::atomic_int aheadBlockSize = 0;
+	std::atomic_bool aheadResetRequested = false;
+	std::atomic<const Schedule*> aheadSchedule = nullptr;
+	juce::AudioBuffer<float> aheadAudioTemp;
+	juce::MidiBuffer aheadMIDITemp;
+
 	void removeIllegalAudioI2SrcConnections();
 	void removeIllegalAudioI2TrkConnections();
 	void removeIllegalAudioTrk2OConnections();
@@ -165,9 +302,33 @@ private:
 	int findSource(const SeqSourceProcessor* ptr) const;
 	int findTrack(const Track* ptr) const;
 
+	void saveConcealBlock(const juce::AudioBuffer<float>& audio);
+	void processFallbackBlock(juce::AudioBuffer<float>& audio, juce::MidiBuffer& midi);
+	void updatePosition(int clipSize);
+	int64_t getCurrentPositionInSamples() const;
+
+	void pushMIDIHookEvent(const juce::MidiMessageMetadata& message, bool isInput);
+	void timerCallback() override;
+
+	void transactionBegan() override;
+	void transactionCommitted() override;
+
+	void updateSchedule();
+	void handleAsyncUpdate() override;
+	const juce::BigInteger getLiveSources() const;
+	void updateLiveSources();
+	bool processScheduledBlock(juce::AudioBuffer<float>& audio, juce::MidiBuffer& midi);
+	static void processScheduleTask(const ScheduleNode& task, int index, const TaskBuffers& buffers,
+		const juce::AudioBuffer<float>& audio, const juce::MidiBuffer& midi, int numSamples);
+
+	int64_t getNextPosition(int64_t current, int clipSize) const;
+	void restartRenderAhead(int64_t position, int clipSize);
+	bool renderAheadBlock();
+
 	friend class Renderer;
 	friend class RenderThread;
 	void processBlock(juce::AudioBuffer<float>& audio, juce::MidiBuffer& midi) override;
+	void processBlockInternal(juce::AudioBuffer<float>& audio, juce::MidiBuffer& midi);
 
 	JUCE_DECLARE_WEAK_REFERENCEABLE(MainGraph)
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MainGraph)
@@ -3,7 +3,7 @@
 
 void MainGraph::insertTrack(int index, const juce::AudioChannelSet& type) {
 	/** Add Node To Graph */
-	if (auto ptrNode = this->addNode(std::make_unique<Track>(type))) {
+	if (auto ptrNode = this->addNode(std::make_unique<Track>(type), {}, this->getUpdateKind())) {
 		/** Limit Index */
 		if (index < 0 || index > this->trackNodeList.size()) {
 			index = this->trackNodeList.size();
@@ -12,10 +12,15 @@ void MainGraph::insertTrack(int index, const juce::AudioChannelSet& type) {
 		/** Add Node To List */
 		this->trackNodeList.insert(index, ptrNode);
 
+		/** Join The Transaction */
+		if (this->isInTransaction()) {
+			dynamic_cast<Track*>(ptrNode->getProcessor())->beginTransaction();
+		}
+
 		/** Connect Track Node To MIDI Input */
 		this->addConnection(
 			{ {this->midiInputNode->nodeID, this->midiChannelIndex},
-			{ptrNode->nodeID, this->midiChannelIndex} });
+			{ptrNode->nodeID, this->midiChannelIndex} }, this->getUpdateKind());
 
 		/** Prepare To Play */
 		ptrNode->getProcessor()->setPlayHead(this->getPlayHead());
@@ -28,8 +33,11 @@ void MainGraph::insertTrack(int index, const juce::AudioChannelSet& type) {
 			dynamic_cast<Track*>(node->getProcessor())->updateIndex(i);
 		}
 
+		/** Update Schedule */
+		this->updateSchedule();
+
 		/** Callback */
-		UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, index);
+		this->invokeCallback(UICallbackType::TrackChanged, index);
 	}
 	else {
 		jassertfalse;
@@ -48,7 +56,7 @@ void MainGraph::removeTrack(int index) {
 	this->midiI2TrkConnectionList.removeIf(
 		[this, nodeID](const juce::AudioProcessorGraph::Connection& element) {
 			if (element.destination.nodeID == nodeID) {
-				this->removeConnection(element);
+				this->removeConnection(element, this->getUpdateKind());
 				return true;
 			}
 			return false;
@@ -56,7 +64,7 @@ void MainGraph::removeTrack(int index) {
 	this->midiSrc2TrkConnectionList.removeIf(
 		[this, nodeID](const juce::AudioProcessorGraph::Connection& element) {
 			if (element.destination.nodeID == nodeID) {
-				this->removeConnection(element);
+				this->removeConnection(element, this->getUpdateKind());
 				return true;
 			}
 			return false;
@@ -64,7 +72,7 @@ void MainGraph::removeTrack(int index) {
 	this->midiTrk2OConnectionList.removeIf(
 		[this, nodeID](const juce::AudioProcessorGraph::Connection& element) {
 			if (element.source.nodeID == nodeID) {
-				this->removeConnection(element);
+				this->removeConnection(element, this->getUpdateKind());
 				return true;
 			}
 			return false;
@@ -72,7 +80,7 @@ void MainGraph::removeTrack(int index) {
 	this->audioSrc2TrkConnectionList.removeIf(
 		[this, nodeID](const juce::AudioProcessorGraph::Connection& element) {
 			if (element.destination.nodeID == nodeID) {
-				this->removeConnection(element);
+				this->removeConnection(element, this->getUpdateKind());
 				return true;
 			}
 			return false;
@@ -80,7 +88,7 @@ void MainGraph::removeTrack(int index) {
 	this->audioI2TrkConnectionList.removeIf(
 		[this, nodeID](const juce::AudioProcessorGraph::Connection& element) {
 			if (element.destination.nodeID == nodeID) {
-				this->removeConnection(element);
+				this->removeConnection(element, this->getUpdateKind());
 				return true;
 			}
 			return false;
@@ -89,7 +97,7 @@ void MainGraph::removeTrack(int index) {
 		[this, nodeID](const juce::AudioProcessorGraph::Connection& element) {
 			if (element.source.nodeID == nodeID ||
 				element.destination.nodeID == nodeID) {
-				this->removeConnection(element);
+				this->removeConnection(element, this->getUpdateKind());
 				return true;
 			}
 			return false;
@@ -97,14 +105,14 @@ void MainGraph::removeTrack(int index) {
 	this->audioTrk2OConnectionList.removeIf(
 		[this, nodeID](const juce::AudioProcessorGraph::Connection& element) {
 			if (element.source.nodeID == nodeID) {
-				this->removeConnection(element);
+				this->removeConnection(element, this->getUpdateKind());
 				return true;
 			}
 			return false;
 		});
 
 	/** Remove Node From Graph */
-	this->removeNode(nodeID);
+	this->removeNode(nodeID, this->getUpdateKind());
 
 	/** Set Index */
 	for (int i = index; i < this->trackNodeList.size(); i++) {
@@ -112,8 +120,11 @@ void MainGraph::removeTrack(int index) {
 		dynamic_cast<Track*>(node->getProcessor())->updateIndex(i);
 	}
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, index);
+	this->invokeCallback(UICallbackType::TrackChanged, index);
 }
 
 int MainGraph::getTrackNum() const {
@@ -131,7 +142,7 @@ void MainGraph::setTrackBypass(int index, bool bypass) {
 		node->setBypassed(bypass);
 
 		/** Callback */
-		UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, index);
+		this->invokeCallback(UICallbackType::TrackChanged, index);
 	}
 }
 
@@ -157,11 +168,14 @@ void MainGraph::setMIDII2TrkConnection(int trackIndex) {
 	juce::AudioProcessorGraph::Connection connection =
 	{ {this->midiInputNode->nodeID, this->midiChannelIndex},
 	{nodeID, this->midiChannelIndex} };
-	this->addConnection(connection);
+	this->addConnection(connection, this->getUpdateKind());
 	this->midiI2TrkConnectionList.add(connection);
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, trackIndex);
+	this->invokeCallback(UICallbackType::TrackChanged, trackIndex);
 }
 
 void MainGraph::removeMIDII2TrkConnection(int trackIndex) {
@@ -175,14 +189,17 @@ void MainGraph::removeMIDII2TrkConnection(int trackIndex) {
 	this->midiI2TrkConnectionList.removeIf(
 		[this, nodeID](const juce::AudioProcessorGraph::Connection& element) {
 			if (element.destination.nodeID == nodeID) {
-				this->removeConnection(element);
+				this->removeConnection(element, this->getUpdateKind());
 				return true;
 			}
 			return false;
 		});
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, trackIndex);
+	this->invokeCallback(UICallbackType::TrackChanged, trackIndex);
 }
 
 void MainGraph::setAudioI2TrkConnection(int trackIndex, int srcChannel, int dstChannel) {
@@ -201,12 +218,15 @@ void MainGraph::setAudioI2TrkConnection(int trackIndex, int srcChannel, int dstC
 	juce::AudioProcessorGraph::Connection connection =
 	{ {this->audioInputNode->nodeID, srcChannel}, {nodeID, dstChannel} };
 	if (!this->isConnected(connection)) {
-		this->addConnection(connection);
+		this->addConnection(connection, this->getUpdateKind());
 		this->audioI2TrkConnectionList.add(connection);
 	}
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, trackIndex);
+	this->invokeCallback(UICallbackType::TrackChanged, trackIndex);
 }
 
 void MainGraph::removeAudioI2TrkConnection(int trackIndex, int srcChannel, int dstChannel) {
@@ -216,11 +236,14 @@ void MainGraph::removeAudioI2TrkConnection(int trackIndex, int srcChannel, int d
 
 	juce::AudioProcessorGraph::Connection connection =
 	{ {this->audioInputNode->nodeID, srcChannel}, {nodeID, dstChannel} };
-	this->removeConnection(connection);
+	this->removeConnection(connection, this->getUpdateKind());
 	this->audioI2TrkConnectionList.removeAllInstancesOf(connection);
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, trackIndex);
+	this->invokeCallback(UICallbackType::TrackChanged, trackIndex);
 }
 
 void MainGraph::setAudioTrk2OConnection(int trackIndex, int srcChannel, int dstChannel) {
@@ -239,12 +262,15 @@ void MainGraph::setAudioTrk2OConnection(int trackIndex, int srcChannel, int dstC
 	juce::AudioProcessorGraph::Connection connection =
 	{ {nodeID, srcChannel}, {this->audioOutputNode->nodeID, dstChannel} };
 	if (!this->isConnected(connection)) {
-		this->addConnection(connection);
+		this->addConnection(connection, this->getUpdateKind());
 		this->audioTrk2OConnectionList.add(connection);
 	}
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, trackIndex);
+	this->invokeCallback(UICallbackType::TrackChanged, trackIndex);
 }
 
 void MainGraph::removeAudioTrk2OConnection(int trackIndex, int srcChannel, int dstChannel) {
@@ -254,11 +280,14 @@ void MainGraph::removeAudioTrk2OConnection(int trackIndex, int srcChannel, int d
 
 	juce::AudioProcessorGraph::Connection connection =
 	{ {nodeID, srcChannel}, {this->audioOutputNode->nodeID, dstChannel} };
-	this->removeConnection(connection);
+	this->removeConnection(connection, this->getUpdateKind());
 	this->audioTrk2OConnectionList.removeAllInstancesOf(connection);
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, trackIndex);
+	this->invokeCallback(UICallbackType::TrackChanged, trackIndex);
 }
 
 void MainGraph::setAudioTrk2TrkConnection(int trackIndex, int dstTrackIndex, int srcChannel, int dstChannel) {
@@ -285,13 +314,16 @@ void MainGraph::setAudioTrk2TrkConnection(int trackIndex, int dstTrackIndex, int
 	juce::AudioProcessorGraph::Connection connection =
 	{ {nodeID, srcChannel}, {dstNodeID, dstChannel} };
 	if (!this->isConnected(connection)) {
-		this->addConnection(connection);
+		this->addConnection(connection, this->getUpdateKind());
 		this->audioTrk2TrkConnectionList.add(connection);
 	}
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, trackIndex);
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, dstTrackIndex);
+	this->invokeCallback(UICallbackType::TrackChanged, trackIndex);
+	this->invokeCallback(UICallbackType::TrackChanged, dstTrackIndex);
 }
 
 void MainGraph::removeAudioTrk2TrkConnection(int trackIndex, int dstTrackIndex, int srcChannel, int dstChannel) {
@@ -309,12 +341,15 @@ void MainGraph::removeAudioTrk2TrkConnection(int trackIndex, int dstTrackIndex,
 	/** Remove Connection */
 	juce::AudioProcessorGraph::Connection connection =
 	{ {nodeID, srcChannel}, {dstNodeID, dstChannel} };
-	this->removeConnection(connection);
+	this->removeConnection(connection, this->getUpdateKind());
 	this->audioTrk2TrkConnectionList.removeAllInstancesOf(connection);
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, trackIndex);
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, dstTrackIndex);
+	this->invokeCallback(UICallbackType::TrackChanged, trackIndex);
+	this->invokeCallback(UICallbackType::TrackChanged, dstTrackIndex);
 }
 
 void MainGraph::setMIDITrk2OConnection(int trackIndex) {
@@ -331,11 +366,14 @@ void MainGraph::setMIDITrk2OConnection(int trackIndex) {
 	juce::AudioProcessorGraph::Connection connection =
 	{ {nodeID, this->midiChannelIndex} ,
 		{this->midiOutputNode->nodeID, this->midiChannelIndex} };
-	this->addConnection(connection);
+	this->addConnection(connection, this->getUpdateKind());
 	this->midiTrk2OConnectionList.add(connection);
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, trackIndex);
+	this->invokeCallback(UICallbackType::TrackChanged, trackIndex);
 }
 
 void MainGraph::removeMIDITrk2OConnection(int trackIndex) {
@@ -349,14 +387,17 @@ void MainGraph::removeMIDITrk2OConnection(int trackIndex) {
 	this->midiTrk2OConnectionList.removeIf(
 		[this, nodeID](const juce::AudioProcessorGraph::Connection& element) {
 			if (element.source.nodeID == nodeID) {
-				this->removeConnection(element);
+				this->removeConnection(element, this->getUpdateKind());
 				return true;
 			}
 			return false;
 		});
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, trackIndex);
+	this->invokeCallback(UICallbackType::TrackChanged, trackIndex);
 }
 
 bool MainGraph::isMIDII2TrkConnected(int trackIndex) const {
@@ -721,28 +762,34 @@ void MainGraph::removeIllegalAudioI2TrkConnections() {
 	this->audioI2TrkConnectionList.removeIf(
 		[this](const juce::AudioProcessorGraph::Connection& element) {
 			if (element.source.channelIndex >= this->getTotalNumInputChannels()) {
-				this->removeConnection(element);
+				this->removeConnection(element, this->getUpdateKind());
 				return true;
 			}
 			return false;
 		});
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, -1);
+	this->invokeCallback(UICallbackType::TrackChanged, -1);
 }
 
 void MainGraph::removeIllegalAudioTrk2OConnections() {
 	this->audioTrk2OConnectionList.removeIf(
 		[this](const juce::AudioProcessorGraph::Connection& element) {
 			if (element.destination.channelIndex >= this->getTotalNumOutputChannels()) {
-				this->removeConnection(element);
+				this->removeConnection(element, this->getUpdateKind());
 				return true;
 			}
 			return false;
 		});
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, -1);
+	this->invokeCallback(UICallbackType::TrackChanged, -1);
 }
 
 int MainGraph::findTrack(const Track* ptr) const {
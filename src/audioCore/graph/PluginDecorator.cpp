@@ -1,9 +1,12 @@
 ﻿#include "PluginDecorator.h"
+#include "SeqSourceProcessor.h"
 #include "../plugin/Plugin.h"
 #include "../plugin/PluginLoader.h"
 #include "../uiCallback/UICallback.h"
 #include "../misc/AudioLock.h"
 #include "../misc/VMath.h"
+#include "../misc/AllocationCheck.h"
+#include "../misc/EngineHealth.h"
 #include "../ara/ARAController.h"
 #include "../ara/ARADataIOThread.h"
 #include "../AudioCore.h"
@@ -41,7 +44,11 @@ PluginDecorator::PluginDecorator(std::unique_ptr<juce::AudioPluginInstance> plug
 }
 
 PluginDecorator::~PluginDecorator() {
+	this->stopTimer();
+	this->setSleeping(false);
+
 	if (this->plugin) {
+		this->plugin->removeListener(this);
 		if (auto editor = this->plugin->getActiveEditor()) {
 			delete editor;
 		}
@@ -53,11 +60,13 @@ void PluginDecorator::setPlugin(
 	std::unique_ptr<juce::AudioPluginInstance> plugin,
 	const juce::String& pluginIdentifier,
 	SetPluginCallback callback, bool hasARA) {
+	this->cancelInstrFreeze();
 	juce::ScopedWriteLock pluginLocker(audioLock::getPluginLock());
 
 	if (!plugin) { return; }
 
 	if (this->plugin) {
+		this->plugin->removeListener(this);
 		if (auto editor = this->plugin->getActiveEditor()) {
 			delete editor;
 		}
@@ -66,6 +75,7 @@ void PluginDecorator::setPlugin(
 
 	this->plugin = std::move(plugin);
 	this->pluginIdentifier = pluginIdentifier;
+	this->plugin->addListener(this);
 
 	/** Load ARA */
 	if (hasARA) {
@@ -100,7 +110,7 @@ void PluginDecorator::setPlugin(
 	else {
 		this->updatePluginBuses();
 
-		this->plugin->setPlayHead(this->getPlayHead());
+		this->plugin->setPlayHead(&(this->offsetPlayHead));
 		this->plugin->setNonRealtime(this->isNonRealtime());
 		this->pluginOnOffInternal(true,
 			this->getSampleRate(), this->getBlockSize());
@@ -166,7 +176,7 @@ void PluginDecorator::setARA(
 		/** Prepare Plugin */
 		this->updatePluginBuses();
 
-		this->plugin->setPlayHead(this->getPlayHead());
+		this->plugin->setPlayHead(&(this->offsetPlayHead));
 		this->plugin->setNonRealtime(this->isNonRealtime());
 		this->pluginOnOffInternal(true,
 			this->getSampleRate(), this->getBlockSize());
@@ -206,7 +216,7 @@ void PluginDecorator::handleARALoadError(
 		/** Prepare Plugin */
 		this->updatePluginBuses();
 
-		this->plugin->setPlayHead(this->getPlayHead());
+		this->plugin->setPlayHead(&(this->offsetPlayHead));
 		this->plugin->setNonRealtime(this->isNonRealtime());
 		this->pluginOnOffInternal(true,
 			this->getSampleRate(), this->getBlockSize());
@@ -415,6 +425,68 @@ void PluginDecorator::removeCCParamConnection(int CCIndex) {
 //	this->paramListenningCC = paramIndex;
 //}
 
+int PluginDecorator::addParamAutomationPoint(int paramIndex, double time, float value) {
+	if (paramIndex < 0) { return -1; }
+
+	/** Edit A Copy, The Audio Thread Keeps Reading The Old Lanes */
+	auto automation = std::make_unique<ParamAutomation>(this->automation.getLatest());
+	int index = automation->lanes[paramIndex].addPoint(time, juce::jlimit(0.f, 1.f, value));
+	this->automation.publish(std::move(automation));
+	this->updateEventTimer();
+
+	return index;
+}
+
+void PluginDecorator::removeParamAutomationPoint(int paramIndex, int pointIndex) {
+	auto automation = std::make_unique<ParamAutomation>(this->automation.getLatest());
+	auto it = automation->lanes.find(paramIndex);
+	if (it == automation->lanes.end()) { return; }
+
+	it->second.removePoint(pointIndex);
+	if (it->second.isEmpty()) {
+		automation->lanes.erase(it);
+	}
+	this->automation.publish(std::move(automation));
+	this->updateEventTimer();
+}
+
+int PluginDecorator::getParamAutomationPointNum(int paramIndex) const {
+	auto& lanes = this->automation.getLatest().lanes;
+	auto it = lanes.find(paramIndex);
+	return (it != lanes.end()) ? it->second.getPointNum() : 0;
+}
+
+const AutomationLane::Point PluginDecorator::getParamAutomationPoint(int paramIndex, int pointIndex) const {
+	auto& lanes = this->automation.getLatest().lanes;
+	auto it = lanes.find(paramIndex);
+	return (it != lanes.end()) ? it->second.getPoint(pointIndex) : AutomationLane::Point{};
+}
+
+const juce::var PluginDecorator::getAutomationData() const {
+	auto& lanes = this->automation.getLatest().lanes;
+	if (lanes.empty()) { return {}; }
+
+	juce::DynamicObject::Ptr result = new juce::DynamicObject;
+	for (auto& [paramIndex, lane] : lanes) {
+		result->setProperty(juce::String{ paramIndex }, lane.toVar());
+	}
+	return juce::var{ result.get() };
+}
+
+void PluginDecorator::setAutomationData(const juce::var& data) {
+	auto automation = std::make_unique<ParamAutomation>();
+	if (auto obj = data.getDynamicObject()) {
+		for (auto& i : obj->getProperties()) {
+			AutomationLane lane;
+			if (lane.fromVar(i.value) && !lane.isEmpty()) {
+				automation->lanes[i.name.toString().getIntValue()] = lane;
+			}
+		}
+	}
+	this->automation.publish(std::move(automation));
+	this->updateEventTimer();
+}
+
 void PluginDecorator::setMIDICCIntercept(bool midiCCShouldIntercept) {
 	this->midiCCShouldIntercept = midiCCShouldIntercept;
 
@@ -448,13 +520,82 @@ bool PluginDecorator::getMIDIOutput() const {
 }
 
 void PluginDecorator::setMIDICCListener(const MIDICCListener& listener) {
-	juce::ScopedWriteLock locker(audioLock::getPluginLock());
-	this->ccListener = listener;
+	this->ccListener.publish(std::make_unique<MIDICCListener>(listener));
+	this->updateEventTimer();
 }
 
 void PluginDecorator::clearMIDICCListener() {
-	juce::ScopedWriteLock locker(audioLock::getPluginLock());
-	this->ccListener = MIDICCListener{};
+	this->ccListener.publish(std::make_unique<MIDICCListener>());
+	this->updateEventTimer();
+}
+
+void PluginDecorator::setNeverSleep(bool neverSleep) {
+	this->neverSleep = neverSleep;
+}
+
+bool PluginDecorator::getNeverSleep() const {
+	return this->neverSleep;
+}
+
+bool PluginDecorator::isSleeping() const {
+	return this->sleeping;
+}
+
+int PluginDecorator::getSleepingNum() {
+	return PluginDecorator::sleepingNum;
+}
+
+uint64_t PluginDecorator::getSleptBlockNum() {
+	return PluginDecorator::sleptBlockNum;
+}
+
+const NodeProfiler::Usage PluginDecorator::getCPUUsage() const {
+	return this->profiler.getUsage();
+}
+
+uint64_t PluginDecorator::getMIDIEventOverflowNum() const {
+	return this->ccEvents.getOverflowNum();
+}
+
+bool PluginDecorator::processNodeInPlace(juce::AudioProcessorGraph::Node* node,
+	juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages,
+	int linkedInputChannels, int linkedOutputChannels) {
+	/** Check Channels */
+	auto processor = node->getProcessor();
+	int totalInputChannels = processor->getTotalNumInputChannels();
+	int totalOutputChannels = processor->getTotalNumOutputChannels();
+	int channels = std::max(totalInputChannels, totalOutputChannels);
+	if (channels > buffer.getNumChannels()) { return false; }
+
+	/** Unlinked Inputs */
+	for (int i = std::min(totalInputChannels, linkedInputChannels); i < channels; i++) {
+		vMath::zeroAllAudioDataOnChannel(buffer, i);
+	}
+
+	/** Process On A View Of The Buffer */
+	{
+		juce::AudioBuffer<float> view(
+			buffer.getArrayOfWritePointers(), channels, buffer.getNumSamples());
+
+		const juce::ScopedLock callbackLocker(processor->getCallbackLock());
+		if (processor->isSuspended()) {
+			vMath::zeroAllAudioData(view);
+		}
+		else if (node->isBypassed()) {
+			processor->processBlockBypassed(view, midiMessages);
+		}
+		else {
+			processor->processBlock(view, midiMessages);
+		}
+	}
+
+	/** Unlinked Outputs */
+	for (int i = std::min(totalOutputChannels, linkedOutputChannels);
+		i < linkedOutputChannels && i < buffer.getNumChannels(); i++) {
+		vMath::zeroAllAudioDataOnChannel(buffer, i);
+	}
+
+	return true;
 }
 
 void PluginDecorator::invokeARADocumentRegionChange() {
@@ -481,9 +622,12 @@ juce::StringArray PluginDecorator::getAlternateDisplayNames() const {
 
 void PluginDecorator::prepareToPlay(
 	double sampleRate, int maximumExpectedSamplesPerBlock) {
+	this->cancelInstrFreeze();
 	this->setRateAndBufferSizeDetails(sampleRate, maximumExpectedSamplesPerBlock);
 
 	this->updateBuffer();
+	this->midiTemp.ensureSize(4096);
+	this->midiSubTemp.ensureSize(4096);
 
 	this->pluginOnOffInternal(true,
 		this->getSampleRate(), this->getBlockSize());
@@ -503,59 +647,87 @@ void PluginDecorator::memoryWarningReceived() {
 
 void PluginDecorator::processBlock(
 	juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) {
-	PluginDecorator::filterMIDIMessage(this->midiChannel, midiMessages);
-	this->parseMIDICC(midiMessages);
-	PluginDecorator::interceptMIDICCMessage(this->midiCCShouldIntercept, midiMessages);
+	VS_SCOPED_NO_ALLOCATION;
+	NodeProfiler::Scope profilerScope(this->profiler, buffer.getNumSamples(), this->getSampleRate());
+
+	PluginDecorator::filterMIDIMessage(this->midiChannel, midiMessages, this->midiTemp);
+
+	/** Skip The Plugin While Sleeping On Silence */
+	bool inputSilent = this->canSleep() && midiMessages.isEmpty()
+		&& PluginDecorator::isBufferSilent(buffer);
+	if (this->processSleeping(buffer, inputSilent)) { return; }
 
 	{
 		if (this->plugin && this->pluginPrepared && this->buffer) {
-			this->buffer->clear();
-
-			int totalChannels = std::min(buffer.getNumChannels(), this->buffer->getNumChannels());
-			int totalSamples = std::min(buffer.getNumSamples(), this->buffer->getNumSamples());
-			for (int i = 0; i < totalChannels; i++) {
-				vMath::copyAudioData(
-					*(this->buffer.get()), buffer,
-					0, 0, i, i, totalSamples);
-			}
+			/** Zero Copy When The Layout Fits */
+			if (!this->processPluginBlockInPlace(buffer, *(this->buffer.get()), midiMessages)) {
+				this->buffer->clear();
+
+				int totalChannels = std::min(buffer.getNumChannels(), this->buffer->getNumChannels());
+				int totalSamples = std::min(buffer.getNumSamples(), this->buffer->getNumSamples());
+				for (int i = 0; i < totalChannels; i++) {
+					vMath::copyAudioData(
+						*(this->buffer.get()), buffer,
+						0, 0, i, i, totalSamples);
+				}
 
-			this->plugin->processBlock(*(this->buffer.get()), midiMessages);
+				this->processPluginBlock(this->buffer.get(), totalSamples, midiMessages);
 
-			for (int i = 0; i < totalChannels; i++) {
-				vMath::copyAudioData(
-					buffer, *(this->buffer.get()),
-					0, 0, i, i, totalSamples);
+				for (int i = 0; i < totalChannels; i++) {
+					vMath::copyAudioData(
+						buffer, *(this->buffer.get()),
+						0, 0, i, i, totalSamples);
+				}
 			}
 		}
+		else {
+			this->processPluginBlock<float>(nullptr, buffer.getNumSamples(), midiMessages);
+		}
 	}
 
+	this->updateSleeping(buffer, inputSilent);
+
 	PluginDecorator::interceptMIDIMessage(this->midiShouldOutput, midiMessages);
 }
 
 void PluginDecorator::processBlock(
 	juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages) {
-	PluginDecorator::filterMIDIMessage(this->midiChannel, midiMessages);
-	this->parseMIDICC(midiMessages);
-	PluginDecorator::interceptMIDICCMessage(this->midiCCShouldIntercept, midiMessages);
+	VS_SCOPED_NO_ALLOCATION;
+	NodeProfiler::Scope profilerScope(this->profiler, buffer.getNumSamples(), this->getSampleRate());
+
+	PluginDecorator::filterMIDIMessage(this->midiChannel, midiMessages, this->midiTemp);
+
+	/** Skip The Plugin While Sleeping On Silence */
+	bool inputSilent = this->canSleep() && midiMessages.isEmpty()
+		&& PluginDecorator::isBufferSilent(buffer);
+	if (this->processSleeping(buffer, inputSilent)) { return; }
 
 	{
 		if (this->plugin && this->pluginPrepared && this->doubleBuffer) {
-			this->doubleBuffer->clear();
-
-			int totalChannels = std::min(buffer.getNumChannels(), this->buffer->getNumChannels());
-			int totalSamples = std::min(buffer.getNumSamples(), this->buffer->getNumSamples());
-			for (int i = 0; i < totalChannels; i++) {
-				this->doubleBuffer->copyFrom(i, 0, buffer.getReadPointer(i), totalSamples);
-			}
+			/** Zero Copy When The Layout Fits */
+			if (!this->processPluginBlockInPlace(buffer, *(this->doubleBuffer.get()), midiMessages)) {
+				this->doubleBuffer->clear();
+
+				int totalChannels = std::min(buffer.getNumChannels(), this->buffer->getNumChannels());
+				int totalSamples = std::min(buffer.getNumSamples(), this->buffer->getNumSamples());
+				for (int i = 0; i < totalChannels; i++) {
+					this->doubleBuffer->copyFrom(i, 0, buffer.getReadPointer(i), totalSamples);
+				}
 
-			this->plugin->processBlock(*(this->doubleBuffer.get()), midiMessages);
+				this->processPluginBlock(this->doubleBuffer.get(), totalSamples, midiMessages);
 
-			for (int i = 0; i < totalChannels; i++) {
-				buffer.copyFrom(i, 0, this->doubleBuffer->getReadPointer(i), totalSamples);
+				for (int i = 0; i < totalChannels; i++) {
+					buffer.copyFrom(i, 0, this->doubleBuffer->getReadPointer(i), totalSamples);
+				}
 			}
 		}
+		else {
+			this->processPluginBlock<double>(nullptr, buffer.getNumSamples(), midiMessages);
+		}
 	}
 
+	this->updateSleeping(buffer, inputSilent);
+
 	PluginDecorator::interceptMIDIMessage(this->midiShouldOutput, midiMessages);
 }
 
@@ -679,11 +851,13 @@ void PluginDecorator::getStateInformation(juce::MemoryBlock& destData) {
 
 void PluginDecorator::setStateInformation(const void* data, int sizeInBytes) {
 	if (!this->plugin) { return; }
+	this->cancelInstrFreeze();
 	this->plugin->setStateInformation(data, sizeInBytes);
 }
 
 void PluginDecorator::setCurrentProgramStateInformation(const void* data, int sizeInBytes) {
 	if (!this->plugin) { return; }
+	this->cancelInstrFreeze();
 	this->plugin->setCurrentProgramStateInformation(data, sizeInBytes);
 }
 
@@ -701,10 +875,42 @@ void PluginDecorator::removeListener(juce::AudioProcessorListener* listenerToRem
 	this->plugin->removeListener(listenerToRemove);
 }
 
+void PluginDecorator::audioProcessorParameterChanged(
+	juce::AudioProcessor*, int, float) {
+	/** Played Automation Is Not An Edit */
+	if (this->notifyingAutomation) { return; }
+	this->invalidateRenderAhead();
+}
+
+void PluginDecorator::audioProcessorChanged(
+	juce::AudioProcessor*, const juce::AudioProcessorListener::ChangeDetails&) {
+	this->updateTailSamples();
+	this->invalidateRenderAhead();
+}
+
+void PluginDecorator::invalidateRenderAhead() {
+	/** Only Edits From The Editor, Not Parameter Changes While Processing */
+	if (!juce::MessageManager::existsAndIsCurrentThread()) { return; }
+
+	if (auto core = AudioCore::getInstanceWithoutCreate()) {
+		if (auto graph = core->getGraph()) {
+			graph->invalidateRenderAhead();
+		}
+	}
+}
+
+void PluginDecorator::cancelInstrFreeze() {
+	/** The Freeze Thread Processes The Instrument Outside The Audio Callback */
+	if (this->isInstr && this->seq) {
+		this->seq->cancelFreezeRender();
+	}
+}
+
 void PluginDecorator::setPlayHead(juce::AudioPlayHead* newPlayHead) {
 	this->juce::AudioProcessor::setPlayHead(newPlayHead);
+	this->offsetPlayHead.setPlayHead(newPlayHead);
 	if (this->plugin) {
-		this->plugin->setPlayHead(newPlayHead);
+		this->plugin->setPlayHead(&(this->offsetPlayHead));
 	}
 }
 
@@ -817,76 +1023,462 @@ std::unique_ptr<google::protobuf::Message> PluginDecorator::serialize(
 	return std::unique_ptr<google::protobuf::Message>(mes.release());
 }
 
-void PluginDecorator::filterMIDIMessage(int channel, juce::MidiBuffer& midiMessages) {
+void PluginDecorator::filterMIDIMessage(int channel, juce::MidiBuffer& midiMessages, juce::MidiBuffer& bufferTemp) {
 	/** Filter MIDI Channel */
 	if (channel >= 1 && channel <= 16) {
-		juce::MidiBuffer bufferTemp;
-		for (auto it = midiMessages.cbegin(); it != midiMessages.cend(); it++) {
-			auto message = (*it).getMessage();
-			if (message.getChannel() == channel) {
-				bufferTemp.addEvent(message, (*it).samplePosition);
+		bufferTemp.clear();
+		for (auto i : midiMessages) {
+			if (PluginDecorator::getMIDIChannel(i) == channel) {
+				bufferTemp.addEvent(i.data, i.numBytes, i.samplePosition);
 			}
 		}
-		midiMessages = bufferTemp;
+		midiMessages.swapWith(bufferTemp);
 	}
 }
 
 void PluginDecorator::interceptMIDIMessage(bool shouldMIDIOutput, juce::MidiBuffer& midiMessages) {
 	if (!shouldMIDIOutput) {
-		midiMessages = juce::MidiBuffer{};
+		/** Keep The Storage For The Next Block */
+		midiMessages.clear();
 	}
 }
 
-void PluginDecorator::interceptMIDICCMessage(bool shouldMIDICCIntercept, juce::MidiBuffer& midiMessages) {
+void PluginDecorator::interceptMIDICCMessage(bool shouldMIDICCIntercept, juce::MidiBuffer& midiMessages, juce::MidiBuffer& bufferTemp) {
 	if (shouldMIDICCIntercept) {
-		juce::MidiBuffer bufferTemp;
+		bufferTemp.clear();
 		for (auto i : midiMessages) {
-			auto message = i.getMessage();
-			if (!message.isController()) {
-				bufferTemp.addEvent(message, i.samplePosition);
+			if (!PluginDecorator::isMIDIController(i)) {
+				bufferTemp.addEvent(i.data, i.numBytes, i.samplePosition);
 			}
 		}
-		midiMessages = bufferTemp;
+		midiMessages.swapWith(bufferTemp);
 	}
 }
 
-void PluginDecorator::parseMIDICC(juce::MidiBuffer& midiMessages) {
-	/** Param Changed Temp */
-	std::map<int, float> paramTemp;
+int PluginDecorator::getMIDIChannel(const juce::MidiMessageMetadata& message) {
+	/** Same As juce::MidiMessage::getChannel Without Copying The Message */
+	if (message.numBytes <= 0) { return 0; }
+	auto status = message.data[0];
+	if ((status & 0xf0) == 0xf0 || (status & 0x80) == 0) { return 0; }
+	return (status & 0x0f) + 1;
+}
+
+bool PluginDecorator::isMIDIController(const juce::MidiMessageMetadata& message) {
+	return message.numBytes >= 3 && (message.data[0] & 0xf0) == 0xb0;
+}
+
+bool PluginDecorator::isMIDICCMapped(const juce::MidiMessageMetadata& message) const {
+	return PluginDecorator::isMIDIController(message)
+		&& this->paramCCList[message.data[1] & 0x7f] > -1;
+}
 
+int PluginDecorator::parseMIDICC(const juce::MidiBuffer& midiMessages, int startSample, int endSample) {
 	/** Parse Message */
 	int lastCCChannel = -1;
-	for (auto i : midiMessages) {
-		/** Get Message */
-		auto message = i.getMessage();
-		if (!message.isController()) { continue; }
+	int changedNum = 0;
+	for (auto it = midiMessages.findNextSamplePosition(startSample); it != midiMessages.cend(); it++) {
+		auto i = *it;
+		if (i.samplePosition >= endSample) { break; }
+		if (!PluginDecorator::isMIDIController(i)) { continue; }
+		int controller = i.data[1] & 0x7f;
 
 		/** Auto Link Param */
-		lastCCChannel = message.getControllerNumber();
+		lastCCChannel = controller;
 
-		/** Get Param Changed */
-		int paramIndex = this->paramCCList[message.getControllerNumber()];
-		if (paramIndex > -1) {
-			paramTemp[paramIndex] = message.getControllerValue() / 127.f;
+		/** Get Param Changed, The Last Value Of Each CC Wins */
+		if (this->paramCCList[controller] > -1) {
+			if (!this->ccChangedTemp[controller]) {
+				this->ccChangedTemp[controller] = true;
+				this->ccChangedList[changedNum++] = controller;
+			}
+			this->ccValueTemp[controller] = (i.data[2] & 0x7f) / 127.f;
 		}
 	}
 
 	/** Set Param Value */
+	if (this->plugin) {
+		/** Host Notification Runs Plugin Code */
+		VS_SCOPED_ALLOCATION_ALLOWED;
+
+		auto& paramList = this->plugin->getParameters();
+		for (int i = 0; i < changedNum; i++) {
+			int controller = this->ccChangedList[i];
+			if (auto param = paramList[this->paramCCList[controller]]) {
+				param->beginChangeGesture();
+				param->setValueNotifyingHost(this->ccValueTemp[controller]);
+				param->endChangeGesture();
+			}
+		}
+	}
+
+	/** Reset Change Table */
+	for (int i = 0; i < changedNum; i++) {
+		this->ccChangedTemp[this->ccChangedList[i]] = false;
+	}
+
+	return lastCCChannel;
+}
+
+void PluginDecorator::notifyMIDICC(int lastCCChannel) {
 	if (!this->plugin) { return; }
+
+	/** Send Auto Connect */
+	if (lastCCChannel > -1) {
+		AudioSnapshot<MIDICCListener>::Reader listener{ this->ccListener };
+		if (*listener) {
+			if (!this->ccEvents.push(lastCCChannel)) {
+				EngineHealth::getInstance()->report(
+					EngineHealth::EventType::MIDIOverflow, this->getCurrentPositionInSamples());
+			}
+		}
+	}
+}
+
+int64_t PluginDecorator::getCurrentPositionInSamples() const {
+	if (auto playHead = this->getPlayHead()) {
+		if (auto pos = playHead->getPosition()) {
+			return pos->getTimeInSamples().orFallback(0);
+		}
+	}
+	return 0;
+}
+
+bool PluginDecorator::getAutomationTime(double& time) const {
+	auto playHead = this->getPlayHead();
+	if (!playHead) { return false; }
+
+	auto pos = playHead->getPosition();
+	if (!pos || !pos->getIsPlaying()) { return false; }
+
+	time = pos->getTimeInSeconds().orFallback(0);
+	return true;
+}
+
+void PluginDecorator::writeAutomation(const ParamAutomation& automation, double time) {
+	/** Listeners Are Notified On The Message Thread */
 	auto& paramList = this->plugin->getParameters();
-	for (auto& i : paramTemp) {
-		auto param = paramList[i.first];
-		if (param) {
-			param->beginChangeGesture();
-			param->setValueNotifyingHost(i.second);
-			param->endChangeGesture();
+	for (auto& [paramIndex, lane] : automation.lanes) {
+		if (auto param = paramList[paramIndex]) {
+			float value = juce::jlimit(0.f, 1.f, lane.getValue(time));
+			if (!juce::approximatelyEqual(param->getValue(), value)) {
+				param->setValue(value);
+				this->automationEvents.push(paramIndex);
+			}
 		}
 	}
+}
 
-	/** Send Auto Connect */
-	if ((lastCCChannel > -1) && this->ccListener) {
-		juce::MessageManager::callAsync(
-			std::bind(this->ccListener, lastCCChannel));
+int PluginDecorator::getNextAutomationSample(const ParamAutomation& automation,
+	double blockTime, int minSample, int numSamples, double sampleRate) {
+	if (minSample >= numSamples || sampleRate <= 0) { return numSamples; }
+
+	/** Values Only Change At Breakpoints */
+	double minTime = blockTime + minSample / sampleRate;
+	int result = numSamples;
+	for (auto& [paramIndex, lane] : automation.lanes) {
+		double nextTime = lane.getNextPointTime(minTime);
+		if (nextTime < blockTime + numSamples / sampleRate) {
+			result = std::min(result, std::max(minSample,
+				(int)std::ceil((nextTime - blockTime) * sampleRate)));
+		}
+	}
+	return result;
+}
+
+template<typename T>
+void PluginDecorator::processPluginBlock(
+	juce::AudioBuffer<T>* pluginBuffer, int numSamples, juce::MidiBuffer& midiMessages) {
+	int splitSize = PluginDecorator::midiCCSplitSize;
+	bool ccSplit = splitSize > 0;
+
+	/** Automation Is Only Written While Playing */
+	AudioSnapshot<ParamAutomation>::Reader automation{ this->automation };
+	double blockTime = 0;
+	bool automationActive = pluginBuffer && !automation->lanes.empty()
+		&& this->getAutomationTime(blockTime);
+	if (automationActive && !ccSplit) {
+		splitSize = PluginDecorator::automationSplitSize;
+	}
+
+	/** Whole Block */
+	if (!pluginBuffer || splitSize <= 0) {
+		this->notifyMIDICC(this->parseMIDICC(midiMessages, 0, INT_MAX));
+		PluginDecorator::interceptMIDICCMessage(this->midiCCShouldIntercept, midiMessages, this->midiTemp);
+
+		if (pluginBuffer) {
+			VS_SCOPED_ALLOCATION_ALLOWED;
+			this->plugin->processBlock(*pluginBuffer, midiMessages);
+		}
+		return;
+	}
+
+	/** Split At Mapped CC And Automation */
+	bool shouldMIDICCIntercept = this->midiCCShouldIntercept;
+	int lastCCChannel = -1;
+	this->midiTemp.clear();
+	for (int startSample = 0; startSample < numSamples;) {
+		/** Next Split Point */
+		int endSample = numSamples;
+		if (ccSplit) {
+			for (auto it = midiMessages.findNextSamplePosition(startSample + splitSize); it != midiMessages.cend(); it++) {
+				auto i = *it;
+				if (i.samplePosition >= numSamples) { break; }
+				if (this->isMIDICCMapped(i)) {
+					endSample = i.samplePosition;
+					break;
+				}
+			}
+		}
+		if (automationActive) {
+			endSample = std::min(endSample, PluginDecorator::getNextAutomationSample(
+				*automation, blockTime, startSample + splitSize, numSamples, this->getSampleRate()));
+		}
+
+		/** Param Changes Land At The Start Of The Sub Block */
+		int lastCC = this->parseMIDICC(midiMessages, startSample, (endSample < numSamples) ? endSample : INT_MAX);
+		if (lastCC > -1) {
+			lastCCChannel = lastCC;
+		}
+		if (automationActive) {
+			this->writeAutomation(*automation, blockTime + startSample / this->getSampleRate());
+		}
+
+		/** Sub Block MIDI */
+		this->midiSubTemp.clear();
+		for (auto it = midiMessages.findNextSamplePosition(startSample); it != midiMessages.cend(); it++) {
+			auto i = *it;
+			if (i.samplePosition >= endSample) { break; }
+			if (shouldMIDICCIntercept && PluginDecorator::isMIDIController(i)) { continue; }
+			this->midiSubTemp.addEvent(i.data, i.numBytes, i.samplePosition - startSample);
+		}
+
+		/** Process Sub Block */
+		{
+			juce::AudioBuffer<T> subBuffer{ pluginBuffer->getArrayOfWritePointers(),
+				pluginBuffer->getNumChannels(), startSample, endSample - startSample };
+
+			this->offsetPlayHead.setOffset(startSample, this->getSampleRate());
+			VS_SCOPED_ALLOCATION_ALLOWED;
+			this->plugin->processBlock(subBuffer, this->midiSubTemp);
+		}
+
+		/** Collect MIDI Output */
+		for (auto i : this->midiSubTemp) {
+			this->midiTemp.addEvent(i.data, i.numBytes, i.samplePosition + startSample);
+		}
+
+		startSample = endSample;
+	}
+	this->offsetPlayHead.setOffset(0, this->getSampleRate());
+
+	midiMessages.swapWith(this->midiTemp);
+	this->notifyMIDICC(lastCCChannel);
+}
+
+template<typename T>
+bool PluginDecorator::processPluginBlockInPlace(
+	juce::AudioBuffer<T>& buffer, juce::AudioBuffer<T>& spareBuffer, juce::MidiBuffer& midiMessages) {
+	int pluginChannels = spareBuffer.getNumChannels();
+	int hostChannels = buffer.getNumChannels();
+	int numSamples = buffer.getNumSamples();
+
+	/** Larger Blocks Than Prepared Go Through The Copy Path */
+	if (numSamples > spareBuffer.getNumSamples()) { return false; }
+
+	/** Same Layout, Hand The Host Buffer Over */
+	if (hostChannels == pluginChannels) {
+		this->processPluginBlock(&buffer, numSamples, midiMessages);
+		return true;
+	}
+
+	/** Remap Channel Pointers, Extra Host Channels Pass Through And Missing Ones Use Cleared Spare Channels */
+	if (pluginChannels > maxRemapChannels) { return false; }
+	std::array<T*, maxRemapChannels> channels{};
+	for (int i = 0; i < pluginChannels; i++) {
+		if (i < hostChannels) {
+			channels[i] = buffer.getWritePointer(i);
+		}
+		else {
+			channels[i] = spareBuffer.getWritePointer(i);
+			juce::FloatVectorOperations::clear(channels[i], numSamples);
+		}
+	}
+
+	juce::AudioBuffer<T> pluginBuffer{ channels.data(), pluginChannels, numSamples };
+	this->processPluginBlock(&pluginBuffer, numSamples, midiMessages);
+	return true;
+}
+
+std::atomic_int PluginDecorator::midiCCSplitSize = 0;
+std::atomic_int PluginDecorator::sleepingNum = 0;
+std::atomic_uint64_t PluginDecorator::sleptBlockNum = 0;
+
+bool PluginDecorator::canSleep() const {
+	return (!this->isInstr) && (!this->neverSleep) && this->pluginPrepared
+		&& (this->tailSamples >= 0);
+}
+
+void PluginDecorator::setSleeping(bool shouldSleep) {
+	if (this->sleeping.exchange(shouldSleep) != shouldSleep) {
+		PluginDecorator::sleepingNum += shouldSleep ? 1 : -1;
+	}
+	if (!shouldSleep) {
+		this->silentSamples = 0;
+	}
+}
+
+void PluginDecorator::updateTailSamples() {
+	if (!this->plugin || this->isARAValid()) {
+		this->tailSamples = -1;
+		return;
+	}
+
+	/** Latency Delays The Tail Too */
+	double tail = std::max(this->plugin->getTailLengthSeconds(), 0.0) * this->getSampleRate()
+		+ this->plugin->getLatencySamples();
+	this->tailSamples = (std::isfinite(tail) && tail < INT_MAX / 2) ? (int)std::ceil(tail) : -1;
+}
+
+template<typename T>
+bool PluginDecorator::isBufferSilent(const juce::AudioBuffer<T>& buffer) {
+	for (int i = 0; i < buffer.getNumChannels(); i++) {
+		if (buffer.getMagnitude(i, 0, buffer.getNumSamples()) > (T)PluginDecorator::silenceLevel) {
+			return false;
+		}
+	}
+	return true;
+}
+
+template<typename T>
+bool PluginDecorator::processSleeping(juce::AudioBuffer<T>& buffer, bool inputSilent) {
+	/** Wake On Sound, MIDI Or When Sleeping Is No Longer Allowed */
+	if (!inputSilent) {
+		this->setSleeping(false);
+		return false;
+	}
+	if (!this->sleeping) { return false; }
+
+	buffer.clear();
+	PluginDecorator::sleptBlockNum++;
+	return true;
+}
+
+template<typename T>
+void PluginDecorator::updateSleeping(const juce::AudioBuffer<T>& buffer, bool inputSilent) {
+	if (!inputSilent) { return; }
+
+	/** Sleep After The Tail Expires And The Output Died Away */
+	this->silentSamples = std::min(this->silentSamples + buffer.getNumSamples(), INT_MAX / 2);
+	if (this->silentSamples >= this->tailSamples && PluginDecorator::isBufferSilent(buffer)) {
+		this->setSleeping(true);
+	}
+}
+
+void PluginDecorator::setMIDICCSplitSize(int size) {
+	PluginDecorator::midiCCSplitSize = std::max(size, 0);
+}
+
+int PluginDecorator::getMIDICCSplitSize() {
+	return PluginDecorator::midiCCSplitSize;
+}
+
+void PluginDecorator::OffsetPlayHead::setPlayHead(juce::AudioPlayHead* playHead) {
+	this->playHead = playHead;
+}
+
+void PluginDecorator::OffsetPlayHead::setOffset(int offset, double sampleRate) {
+	this->offset = offset;
+	this->sampleRate = sampleRate;
+}
+
+juce::Optional<juce::AudioPlayHead::PositionInfo> PluginDecorator::OffsetPlayHead::getPosition() const {
+	auto playHead = this->playHead.load();
+	if (!playHead) { return juce::nullopt; }
+
+	auto position = playHead->getPosition();
+	int offset = this->offset;
+	double sampleRate = this->sampleRate;
+	if (!position || offset == 0 || sampleRate <= 0) { return position; }
+
+	/** Move To The Start Of The Sub Block */
+	double offsetSeconds = offset / sampleRate;
+	if (auto time = position->getTimeInSamples()) {
+		position->setTimeInSamples(*time + offset);
+	}
+	if (auto time = position->getTimeInSeconds()) {
+		position->setTimeInSeconds(*time + offsetSeconds);
+	}
+	if (auto ppq = position->getPpqPosition()) {
+		if (auto bpm = position->getBpm()) {
+			position->setPpqPosition(*ppq + offsetSeconds * (*bpm) / 60.0);
+		}
+	}
+	return position;
+}
+
+bool PluginDecorator::OffsetPlayHead::canControlTransport() {
+	auto playHead = this->playHead.load();
+	return playHead && playHead->canControlTransport();
+}
+
+void PluginDecorator::OffsetPlayHead::transportPlay(bool shouldStartPlaying) {
+	if (auto playHead = this->playHead.load()) {
+		playHead->transportPlay(shouldStartPlaying);
+	}
+}
+
+void PluginDecorator::OffsetPlayHead::transportRecord(bool shouldStartRecording) {
+	if (auto playHead = this->playHead.load()) {
+		playHead->transportRecord(shouldStartRecording);
+	}
+}
+
+void PluginDecorator::OffsetPlayHead::transportRewind() {
+	if (auto playHead = this->playHead.load()) {
+		playHead->transportRewind();
+	}
+}
+
+void PluginDecorator::timerCallback() {
+	/** Listener Only Needs The Last CC */
+	int lastCCChannel = -1;
+	this->ccEvents.drain([&lastCCChannel](int channel) {
+		lastCCChannel = channel;
+		});
+	if (lastCCChannel > -1) {
+		auto listener = this->ccListener.getLatest();
+		if (listener) {
+			listener(lastCCChannel);
+		}
+	}
+
+	/** Tell The Host And Editor About Automation Written By The Audio Thread */
+	if (this->plugin) {
+		auto& paramList = this->plugin->getParameters();
+		this->notifyingAutomation = true;
+		this->automationEvents.drain([&paramList](int paramIndex) {
+			if (auto param = paramList[paramIndex]) {
+				param->sendValueChangedMessageToListeners(param->getValue());
+			}
+			});
+		this->notifyingAutomation = false;
+	}
+	else {
+		this->automationEvents.drain([](int) {});
+	}
+}
+
+void PluginDecorator::updateEventTimer() {
+	/** Drain Events While Someone Listens For CC Or Automation Is Written */
+	bool listening = static_cast<bool>(this->ccListener.getLatest());
+	bool automated = !this->automation.getLatest().lanes.empty();
+	if (listening || automated) {
+		if (!this->isTimerRunning()) {
+			this->startTimer(20);
+		}
+	}
+	else {
+		this->stopTimer();
 	}
 }
 
@@ -903,11 +1495,14 @@ void PluginDecorator::updateBuffer() {
 
 void PluginDecorator::pluginOnOffInternal(
 	bool shouldOn, double sampleRate, int blockSize, bool stateQuickSwitch) {
+	this->setSleeping(false);
+
 	if (shouldOn) {
 		if (plugin) {
 			if (!stateQuickSwitch) {
 				plugin->prepareToPlay(sampleRate, blockSize);
 			}
+			this->updateTailSamples();
 			this->pluginPrepared = true;
 		}
 	}
@@ -3,11 +3,17 @@
 #include <JuceHeader.h>
 #include "../project/Serializable.h"
 #include "../ara/ARAVirtualDocument.h"
+#include "../misc/AudioSnapshot.h"
+#include "../misc/RealtimeFifo.h"
+#include "../misc/NodeProfiler.h"
+#include "../misc/AutomationLane.h"
 
 class SeqSourceProcessor;
 
 class PluginDecorator final : public juce::AudioProcessor,
-	public Serializable {
+	public Serializable,
+	private juce::Timer,
+	private juce::AudioProcessorListener {
 public:
 	PluginDecorator() = delete;
 	PluginDecorator(SeqSourceProcessor* seq, bool isInstr = false,
@@ -58,15 +64,60 @@ public:
 	void removeCCParamConnection(int CCIndex);
 	//void setParamCCListenning(int paramIndex);
 
+	/**
+	 * @brief	Automation points hold normalized param values and are written to the plugin while playing.
+	 * @attention	Plugin blocks are split at breakpoints at least automation split size samples apart,
+	 *				each sub-block gets the value at its start.
+	 *				Listeners hear about written values on the message thread.
+	 */
+	int addParamAutomationPoint(int paramIndex, double time, float value);
+	void removeParamAutomationPoint(int paramIndex, int pointIndex);
+	int getParamAutomationPointNum(int paramIndex) const;
+	const AutomationLane::Point getParamAutomationPoint(int paramIndex, int pointIndex) const;
+	const juce::var getAutomationData() const;
+	void setAutomationData(const juce::var& data);
+
 	void setMIDICCIntercept(bool midiCCShouldIntercept);
 	bool getMIDICCIntercept() const;
 
 	void setMIDIOutput(bool midiShouldOutput);
 	bool getMIDIOutput() const;
 
+	/**
+	 * @brief	Effects sleep once their input stays silent past the plugin tail and their output is silent,
+	 *			then wake on the first non-silent sample or MIDI event.
+	 * @attention	Instruments, ARA plugins and plugins with an infinite tail never sleep.
+	 */
+	void setNeverSleep(bool neverSleep);
+	bool getNeverSleep() const;
+	bool isSleeping() const;
+	static int getSleepingNum();
+	static uint64_t getSleptBlockNum();
+
+	const NodeProfiler::Usage getCPUUsage() const;
+
+	/**
+	 * @brief	Split plugin blocks at mapped MIDI CC events so parameter changes land sample-accurately.
+	 * @attention	A sub-block only ends at a mapped CC at least size samples after its start,
+	 *			so the last sub-block of a block can be shorter. Set 0 to process whole blocks.
+	 */
+	static void setMIDICCSplitSize(int size);
+	static int getMIDICCSplitSize();
+
 	using MIDICCListener = std::function<void(int)>;
 	void setMIDICCListener(const MIDICCListener& listener);
 	void clearMIDICCListener();
+	uint64_t getMIDIEventOverflowNum() const;
+
+	/**
+	 * @brief	Run a plugin node directly on the owner's buffer instead of a nested graph.
+	 * @attention	Channels at or beyond the linked input num reach the plugin as silence,
+	 *				and main channels at or beyond the plugin output num are cleared.
+	 *				Return false if the buffer has fewer channels than the plugin needs.
+	 */
+	static bool processNodeInPlace(juce::AudioProcessorGraph::Node* node,
+		juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages,
+		int linkedInputChannels, int linkedOutputChannels);
 
 	void invokeARADocumentRegionChange();
 	void invokeARADocumentContextChange();
@@ -175,7 +226,30 @@ private:
 	const bool isInstr = false;
 	std::atomic_bool pluginPrepared = false;
 
-	MIDICCListener ccListener;
+	/** Silent Samples Are Only Touched By The Thread Processing This Plugin */
+	std::atomic_bool neverSleep = false;
+	std::atomic_bool sleeping = false;
+	std::atomic_int tailSamples = -1;
+	int silentSamples = 0;
+
+	AudioSnapshot<MIDICCListener> ccListener;
+	RealtimeFifo<int, 256> ccEvents;
+
+	/** Lanes Without Points Are Removed */
+	struct ParamAutomation final {
+		std::map<int, AutomationLane> lanes;
+	};
+	AudioSnapshot<ParamAutomation> automation;
+	RealtimeFifo<int, 256> automationEvents;
+	bool notifyingAutomation = false;
+	/** Shortest Sub-Block Ended By A Breakpoint */
+	static constexpr int automationSplitSize = 32;
+
+	/** Scratch Storage Reused By Every Block */
+	juce::MidiBuffer midiTemp, midiSubTemp;
+	std::array<float, 128> ccValueTemp{};
+	std::array<bool, 128> ccChangedTemp{};
+	std::array<int, 128> ccChangedList{};
 
 	std::unique_ptr<juce::ARAHostDocumentController> araDocumentController = nullptr;
 	juce::ARAHostModel::EditorRendererInterface araEditorRenderer;
@@ -190,11 +264,85 @@ private:
 	int pluginOnOffCount = 0;
 	juce::SpinLock pluginOnOffMutex;
 
-	static void filterMIDIMessage(int channel, juce::MidiBuffer& midiMessages);
+	NodeProfiler profiler;
+
+	static void filterMIDIMessage(int channel, juce::MidiBuffer& midiMessages, juce::MidiBuffer& bufferTemp);
 	static void interceptMIDIMessage(bool shouldMIDIOutput, juce::MidiBuffer& midiMessages);
-	static void interceptMIDICCMessage(bool shouldMIDICCIntercept, juce::MidiBuffer& midiMessages);
+	static void interceptMIDICCMessage(bool shouldMIDICCIntercept, juce::MidiBuffer& midiMessages, juce::MidiBuffer& bufferTemp);
+	static int getMIDIChannel(const juce::MidiMessageMetadata& message);
+	static bool isMIDIController(const juce::MidiMessageMetadata& message);
+
+	static std::atomic_int midiCCSplitSize;
+
+	static std::atomic_int sleepingNum;
+	static std::atomic_uint64_t sleptBlockNum;
+	static constexpr float silenceLevel = 1.0e-7f;
 
-	void parseMIDICC(juce::MidiBuffer& midiMessages);
+	/** Position Seen By The Plugin, Moved To The Start Of The Current Sub Block */
+	class OffsetPlayHead final : public juce::AudioPlayHead {
+	public:
+		OffsetPlayHead() = default;
+
+		void setPlayHead(juce::AudioPlayHead* playHead);
+		void setOffset(int offset, double sampleRate);
+
+		juce::Optional<juce::AudioPlayHead::PositionInfo> getPosition() const override;
+
+		bool canControlTransport() override;
+		void transportPlay(bool shouldStartPlaying) override;
+		void transportRecord(bool shouldStartRecording) override;
+		void transportRewind() override;
+
+	private:
+		std::atomic<juce::AudioPlayHead*> playHead = nullptr;
+		std::atomic_int offset = 0;
+		std::atomic<double> sampleRate = 0;
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OffsetPlayHead)
+	};
+	OffsetPlayHead offsetPlayHead;
+
+	bool isMIDICCMapped(const juce::MidiMessageMetadata& message) const;
+	int parseMIDICC(const juce::MidiBuffer& midiMessages, int startSample, int endSample);
+	void notifyMIDICC(int lastCCChannel);
+	int64_t getCurrentPositionInSamples() const;
+
+	bool getAutomationTime(double& time) const;
+	void writeAutomation(const ParamAutomation& automation, double time);
+	static int getNextAutomationSample(const ParamAutomation& automation,
+		double blockTime, int minSample, int numSamples, double sampleRate);
+
+	/** Same As The Channel Space JUCE Preallocates In A Referring AudioBuffer */
+	static constexpr int maxRemapChannels = 32;
+
+	/**
+	 * @brief	Run the plugin directly on the host buffer, or on remapped channel pointers when only the channel number differs.
+	 * @attention	Returns false when the block has to go through the copy path.
+	 */
+	template<typename T>
+	bool processPluginBlockInPlace(juce::AudioBuffer<T>& buffer, juce::AudioBuffer<T>& spareBuffer, juce::MidiBuffer& midiMessages);
+	template<typename T>
+	void processPluginBlock(juce::AudioBuffer<T>* pluginBuffer, int numSamples, juce::MidiBuffer& midiMessages);
+
+	bool canSleep() const;
+	void setSleeping(bool shouldSleep);
+	void updateTailSamples();
+	template<typename T>
+	static bool isBufferSilent(const juce::AudioBuffer<T>& buffer);
+	/** Returns true when the block was skipped */
+	template<typename T>
+	bool processSleeping(juce::AudioBuffer<T>& buffer, bool inputSilent);
+	template<typename T>
+	void updateSleeping(const juce::AudioBuffer<T>& buffer, bool inputSilent);
+	void timerCallback() override;
+	void updateEventTimer();
+
+	void audioProcessorParameterChanged(
+		juce::AudioProcessor* processor, int parameterIndex, float newValue) override;
+	void audioProcessorChanged(
+		juce::AudioProcessor* processor, const juce::AudioProcessorListener::ChangeDetails& details) override;
+	void invalidateRenderAhead();
+	void cancelInstrFreeze();
 	
 	void updateBuffer();
 
@@ -1,4 +1,5 @@
 ﻿#include "PluginDock.h"
+#include "../misc/VMath.h"
 #include "../uiCallback/UICallback.h"
 #include <VSP4.h>
 using namespace org::vocalsharp::vocalshaper;
@@ -40,6 +41,9 @@ PluginDock::PluginDock(
 		this->addConnection(
 			{ {this->audioInputNode->nodeID, i}, {this->audioOutputNode->nodeID, i} });
 	}
+
+	/** Plugin Chain */
+	this->updateChain();
 }
 
 PluginDock::~PluginDock() {
@@ -64,7 +68,7 @@ PluginDecorator::SafePointer PluginDock::insertPlugin(std::unique_ptr<juce::Audi
 
 PluginDecorator::SafePointer PluginDock::insertPlugin(int index) {
 	/** Add To The Graph */
-	auto ptrNode = this->addNode(std::make_unique<PluginDecorator>(nullptr, false, this->audioChannels));
+	auto ptrNode = this->addNode(std::make_unique<PluginDecorator>(nullptr, false, this->audioChannels), {}, this->getUpdateKind());
 	if (ptrNode) {
 		/** Set Bus Num */
 		{
@@ -81,7 +85,7 @@ PluginDecorator::SafePointer PluginDock::insertPlugin(int index) {
 
 		/** Check Channels */
 		if (pluginInputChannels < mainBusChannels || pluginOutputChannels < mainBusChannels) {
-			this->removeNode(ptrNode->nodeID);
+			this->removeNode(ptrNode->nodeID, this->getUpdateKind());
 			return nullptr;
 		}
 
@@ -98,7 +102,7 @@ PluginDecorator::SafePointer PluginDock::insertPlugin(int index) {
 		ptrNode->getProcessor()->prepareToPlay(this->getSampleRate(), this->getBlockSize());
 
 		/** Callback */
-		UICallbackAPI<int, int>::invoke(UICallbackType::EffectChanged, this->index, index);
+		this->invokeCallback(UICallbackType::EffectChanged, this->index, index);
 
 		return PluginDecorator::SafePointer{ dynamic_cast<PluginDecorator*>(ptrNode->getProcessor()) };
 	}
@@ -123,10 +127,10 @@ void PluginDock::removePlugin(int index) {
 	}
 
 	/** Remove Node From Graph */
-	this->removeNode(ptrNode->nodeID);
+	this->removeNode(ptrNode->nodeID, this->getUpdateKind());
 
 	/** Callback */
-	UICallbackAPI<int, int>::invoke(UICallbackType::EffectChanged, this->index, index);
+	this->invokeCallback(UICallbackType::EffectChanged, this->index, index);
 }
 
 void PluginDock::setPluginIndex(int oldIndex, int newIndex) {
@@ -144,8 +148,8 @@ void PluginDock::setPluginIndex(int oldIndex, int newIndex) {
 	this->insertPluginInternal(newIndex, ptr);
 
 	/** Callback */
-	UICallbackAPI<int, int>::invoke(UICallbackType::EffectChanged, this->index, oldIndex);
-	UICallbackAPI<int, int>::invoke(UICallbackType::EffectChanged, this->index, newIndex);
+	this->invokeCallback(UICallbackType::EffectChanged, this->index, oldIndex);
+	this->invokeCallback(UICallbackType::EffectChanged, this->index, newIndex);
 }
 
 int PluginDock::getPluginNum() const {
@@ -231,16 +235,19 @@ bool PluginDock::addAdditionalAudioBus() {
 		for (int i = oldNum; i < newNum; i++) {
 			juce::AudioProcessorGraph::Connection connection =
 			{ {this->audioInputNode->nodeID, i}, {p->nodeID, i} };
-			this->addConnection(connection);
+			this->addConnection(connection, this->getUpdateKind());
 		}
 	}
 	for (int i = oldNum; i < newNum; i++) {
 		juce::AudioProcessorGraph::Connection connection =
 		{ {this->audioInputNode->nodeID, i},
 			{this->audioOutputNode->nodeID, i} };
-		this->addConnection(connection);
+		this->addConnection(connection, this->getUpdateKind());
 	}
 
+	/** Plugin Chain */
+	this->updateChain();
+
 	return true;
 }
 
@@ -276,7 +283,10 @@ bool PluginDock::removeAdditionalAudioBus() {
 	}
 
 	/** Remove Additional Connection */
-	this->removeIllegalConnections();
+	this->removeIllegalConnections(this->getUpdateKind());
+
+	/** Plugin Chain */
+	this->updateChain();
 
 	return true;
 }
@@ -295,6 +305,9 @@ PluginDock::PluginStateList PluginDock::getPluginList() const {
 void PluginDock::prepareToPlay(double sampleRate, int maximumExpectedSamplesPerBlock) {
 	/** Plugin Dock */
 	this->juce::AudioProcessorGraph::prepareToPlay(sampleRate, maximumExpectedSamplesPerBlock);
+
+	/** Plugin Chain */
+	this->updateChain();
 }
 
 void PluginDock::setPlayHead(juce::AudioPlayHead* newPlayHead) {
@@ -307,22 +320,84 @@ void PluginDock::setPlayHead(juce::AudioPlayHead* newPlayHead) {
 	}
 }
 
+void PluginDock::processChain(juce::AudioBuffer<float>& buffer, const juce::MidiBuffer& midiMessages) {
+	AudioSnapshot<PluginChain>::Reader chain{ this->chain };
+
+	int mainChannels = chain->mainChannels;
+	int totalChannels = chain->totalChannels;
+	int sideChannels = totalChannels - mainChannels;
+	int numSamples = buffer.getNumSamples();
+	auto& sideChain = *(chain->sideChain);
+	auto& midi = *(chain->midi);
+
+	/** Check Channels, Use The Nested Graph If Anything Doesn't Fit */
+	bool fit = (buffer.getNumChannels() >= totalChannels)
+		&& (sideChannels <= 0 || numSamples <= sideChain.getNumSamples());
+	for (int i = 0; fit && i < chain->plugins.size(); i++) {
+		auto processor = chain->plugins.getUnchecked(i)->getProcessor();
+		fit = std::max(processor->getTotalNumInputChannels(),
+			processor->getTotalNumOutputChannels()) <= buffer.getNumChannels();
+	}
+	if (!fit) {
+		midi.clear();
+		midi.addEvents(midiMessages, 0, numSamples, 0);
+		this->juce::AudioProcessorGraph::processBlock(buffer, midi);
+		return;
+	}
+
+	/** Keep Side Chain Input */
+	for (int i = 0; i < sideChannels; i++) {
+		vMath::copyAudioData(sideChain, buffer, 0, 0, i, mainChannels + i, numSamples);
+	}
+
+	/** Process Plugins */
+	for (auto& node : chain->plugins) {
+		/** Every Plugin Gets The Dock MIDI Input */
+		midi.clear();
+		midi.addEvents(midiMessages, 0, numSamples, 0);
+
+		/** Process Main Bus In Place */
+		PluginDecorator::processNodeInPlace(
+			node.get(), buffer, midi, totalChannels, mainChannels);
+
+		/** Restore Side Chain For The Next Plugin */
+		for (int i = 0; i < sideChannels; i++) {
+			vMath::copyAudioData(buffer, sideChain, 0, 0, mainChannels + i, i, numSamples);
+		}
+	}
+
+	/** Unlinked Outputs */
+	for (int i = totalChannels; i < buffer.getNumChannels(); i++) {
+		vMath::zeroAllAudioDataOnChannel(buffer, i);
+	}
+}
+
+void PluginDock::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) {
+	this->processChain(buffer, midiMessages);
+
+	/** The Dock Has No MIDI Output */
+	midiMessages.clear();
+}
+
 void PluginDock::clearGraph() {
 	for (auto& i : this->pluginNodeList) {
-		this->removeNode(i->nodeID);
+		this->removeNode(i->nodeID, this->getUpdateKind());
 	}
 	this->pluginNodeList.clear();
 
-	this->removeIllegalConnections();
+	this->removeIllegalConnections(this->getUpdateKind());
 
 	int mainBusChannels = this->audioChannels.size();
 	for (int i = 0; i < mainBusChannels; i++) {
 		this->addConnection(
-			{ {this->audioInputNode->nodeID, i}, {this->audioOutputNode->nodeID, i} });
+			{ {this->audioInputNode->nodeID, i}, {this->audioOutputNode->nodeID, i} }, this->getUpdateKind());
 	}
 
+	/** Plugin Chain */
+	this->updateChain();
+
 	/** Callback */
-	UICallbackAPI<int, int>::invoke(UICallbackType::EffectChanged, this->index, -1);
+	this->invokeCallback(UICallbackType::EffectChanged, this->index, -1);
 }
 
 bool PluginDock::parse(
@@ -371,6 +446,35 @@ std::unique_ptr<google::protobuf::Message> PluginDock::serialize(
 	return std::unique_ptr<google::protobuf::Message>(mes.release());
 }
 
+void PluginDock::updateChain() {
+	/** Rebuilt When The Transaction Is Committed */
+	if (this->isInTransaction()) { return; }
+
+	auto result = std::make_unique<PluginChain>();
+	result->plugins = this->pluginNodeList;
+
+	/** Channels */
+	result->mainChannels = this->audioChannels.size();
+	result->totalChannels = std::max(this->getTotalNumInputChannels(), result->mainChannels);
+
+	/** Buffers */
+	result->sideChain = std::make_unique<juce::AudioBuffer<float>>(
+		result->totalChannels - result->mainChannels, std::max(this->getBlockSize(), 0));
+	result->midi = std::make_unique<juce::MidiBuffer>();
+	result->midi->ensureSize(4096);
+
+	this->chain.publish(std::move(result));
+}
+
+int PluginDock::getTransactionIndex() const {
+	return this->index;
+}
+
+void PluginDock::transactionCommitted() {
+	this->rebuild();
+	this->updateChain();
+}
+
 int PluginDock::findPlugin(const PluginDecorator* ptr) const {
 	for (int i = 0; i < this->pluginNodeList.size(); i++) {
 		if (this->pluginNodeList.getUnchecked(i)->getProcessor() == ptr) {
@@ -386,13 +490,13 @@ juce::AudioProcessorGraph::Node::Ptr PluginDock::removePluginInternal(int index)
 
 	/** Remove MIDI Connection */
 	this->removeConnection(
-		{ {this->midiInputNode->nodeID, this->midiChannelIndex}, {ptrNode->nodeID, this->midiChannelIndex} });
+		{ {this->midiInputNode->nodeID, this->midiChannelIndex}, {ptrNode->nodeID, this->midiChannelIndex} }, this->getUpdateKind());
 
 	/** Remove Additional Connection */
 	for (int i = this->audioChannels.size(); i < this->getTotalNumInputChannels(); i++) {
 		juce::AudioProcessorGraph::Connection connection =
 		{ {this->audioInputNode->nodeID, i}, {ptrNode->nodeID, i} };
-		this->removeConnection(connection);
+		this->removeConnection(connection, this->getUpdateKind());
 	}
 
 	/** Connect The Last Node With The Next Node */
@@ -418,18 +522,21 @@ juce::AudioProcessorGraph::Node::Ptr PluginDock::removePluginInternal(int index)
 		/** Remove Connection To Hot Spot Nodes */
 		for (int i = 0; i < mainBusChannels; i++) {
 			this->removeConnection(
-				{ {lastNode->nodeID, i}, {ptrNode->nodeID, i} });
+				{ {lastNode->nodeID, i}, {ptrNode->nodeID, i} }, this->getUpdateKind());
 			this->removeConnection(
-				{ {ptrNode->nodeID, i}, {nextNode->nodeID, i} });
+				{ {ptrNode->nodeID, i}, {nextNode->nodeID, i} }, this->getUpdateKind());
 		}
 
 		/** Add Connection Between Hot Spot Nodes */
 		for (int i = 0; i < mainBusChannels; i++) {
 			this->addConnection(
-				{ {lastNode->nodeID, i}, {nextNode->nodeID, i} });
+				{ {lastNode->nodeID, i}, {nextNode->nodeID, i} }, this->getUpdateKind());
 		}
 	}
 
+	/** Plugin Chain */
+	this->updateChain();
+
 	/** Return */
 	return ptrNode;
 }
@@ -468,15 +575,15 @@ void PluginDock::insertPluginInternal(
 		/** Remove Connection Between Hot Spot Nodes */
 		for (int i = 0; i < mainBusChannels; i++) {
 			this->removeConnection(
-				{ {lastNode->nodeID, i}, {nextNode->nodeID, i} });
+				{ {lastNode->nodeID, i}, {nextNode->nodeID, i} }, this->getUpdateKind());
 		}
 
 		/** Add Connection To Hot Spot Nodes */
 		for (int i = 0; i < mainBusChannels; i++) {
 			this->addConnection(
-				{ {lastNode->nodeID, i}, {ptr->nodeID, i} });
+				{ {lastNode->nodeID, i}, {ptr->nodeID, i} }, this->getUpdateKind());
 			this->addConnection(
-				{ {ptr->nodeID, i}, {nextNode->nodeID, i} });
+				{ {ptr->nodeID, i}, {nextNode->nodeID, i} }, this->getUpdateKind());
 		}
 	}
 
@@ -484,13 +591,16 @@ void PluginDock::insertPluginInternal(
 	for (int i = this->audioChannels.size(); i < this->getTotalNumInputChannels(); i++) {
 		juce::AudioProcessorGraph::Connection connection =
 		{ {this->audioInputNode->nodeID, i}, {ptr->nodeID, i} };
-		this->addConnection(connection);
+		this->addConnection(connection, this->getUpdateKind());
 	}
 
 	/** Connect Node To MIDI Input */
 	this->addConnection(
-		{ {this->midiInputNode->nodeID, this->midiChannelIndex}, {ptr->nodeID, this->midiChannelIndex} });
+		{ {this->midiInputNode->nodeID, this->midiChannelIndex}, {ptr->nodeID, this->midiChannelIndex} }, this->getUpdateKind());
 
 	/** Add Node To The Plugin List */
 	this->pluginNodeList.insert(index, ptr);
+
+	/** Plugin Chain */
+	this->updateChain();
 }
@@ -3,10 +3,13 @@
 #include <JuceHeader.h>
 
 #include "PluginDecorator.h"
+#include "GraphTransaction.h"
 #include "../project/Serializable.h"
+#include "../misc/AudioSnapshot.h"
 #include "../Utils.h"
 
 class PluginDock final : public juce::AudioProcessorGraph,
+	public GraphTransaction,
 	public Serializable {
 public:
 	PluginDock() = delete;
@@ -53,6 +56,11 @@ public:
 	void prepareToPlay(double sampleRate, int maximumExpectedSamplesPerBlock) override;
 	void setPlayHead(juce::AudioPlayHead* newPlayHead) override;
 
+	/**
+	 * @brief	Run the plugin chain in place on the buffer without touching the MIDI input.
+	 */
+	void processChain(juce::AudioBuffer<float>& buffer, const juce::MidiBuffer& midiMessages);
+
 	void clearGraph();
 
 	class SafePointer {
@@ -92,8 +100,23 @@ private:
 
 	juce::Array<juce::AudioProcessorGraph::Node::Ptr> pluginNodeList;
 
+	struct PluginChain final {
+		juce::Array<juce::AudioProcessorGraph::Node::Ptr> plugins;
+		int mainChannels = 0, totalChannels = 0;
+		std::unique_ptr<juce::AudioBuffer<float>> sideChain;
+		std::unique_ptr<juce::MidiBuffer> midi;
+	};
+	AudioSnapshot<PluginChain> chain;
+
 	int findPlugin(const PluginDecorator* ptr) const;
 
+	void updateChain();
+
+	int getTransactionIndex() const override;
+	void transactionCommitted() override;
+
+	void processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) override;
+
 	juce::AudioProcessorGraph::Node::Ptr removePluginInternal(int index);
 	void insertPluginInternal(int index, juce::AudioProcessorGraph::Node::Ptr ptr);
 
@@ -0,0 +1,158 @@
+﻿#include "MainGraph.h"
+#include "../misc/PlayPosition.h"
+#include "../misc/Renderer.h"
+#include "../misc/AudioLock.h"
+
+MainGraph::RenderAheadThread::RenderAheadThread(MainGraph* parent)
+	: Thread("Render Ahead"), parent(parent) {}
+
+void MainGraph::RenderAheadThread::wakeUp() {
+	/** Never Release The Semaphore Twice Before The Thread Takes It */
+	if (!this->wakeUpRequested.exchange(true)) {
+		this->wakeUpSemaphore.release();
+	}
+}
+
+void MainGraph::RenderAheadThread::stop() {
+	this->signalThreadShouldExit();
+	this->wakeUp();
+	this->stopThread(3000);
+}
+
+void MainGraph::RenderAheadThread::run() {
+	while (!this->threadShouldExit()) {
+		/** Render Until The Ring Is Full */
+		if (this->parent->renderAheadBlock()) { continue; }
+
+		/** Wait For The Audio Thread To Take A Block */
+		if (this->wakeUpSemaphore.try_acquire_for(std::chrono::milliseconds(10))) {
+			this->wakeUpRequested = false;
+		}
+	}
+}
+
+void MainGraph::setRenderAheadBlockNum(int num) {
+	this->renderAheadBlockNum = juce::jlimit(0, MainGraph::maxRenderAheadBlockNum, num);
+	this->updateSchedule();
+}
+
+int MainGraph::getRenderAheadBlockNum() const {
+	return this->renderAheadBlockNum;
+}
+
+void MainGraph::invalidateRenderAhead() {
+	if (this->renderAheadBlockNum <= 0) { return; }
+
+	/** Only A Changed Live Set Needs A New Schedule */
+	this->updateLiveSources();
+
+	/** Keep The Ring, Blocks Of The Old Generation Are Dropped And Refilled From The Live Position */
+	this->aheadGeneration++;
+	this->aheadResetRequested = true;
+	if (this->aheadThread) {
+		this->aheadThread->wakeUp();
+	}
+}
+
+int64_t MainGraph::getNextPosition(int64_t current, int clipSize) const {
+	/** Same Rule As updatePosition() */
+	if (auto position = dynamic_cast<PlayPosition*>(this->getPlayHead())) {
+		if (position->getLooping()) {
+			auto [loopStart, loopEnd] = position->getLoopingTimeSec();
+			double sampleRate = position->getSampleRate();
+
+			int64_t next = current + clipSize;
+			if (next < (loopStart * sampleRate) || next > (loopEnd * sampleRate)) {
+				return (int64_t)(loopStart * sampleRate);
+			}
+		}
+	}
+	return current + clipSize;
+}
+
+void MainGraph::restartRenderAhead(int64_t position, int clipSize) {
+	/** Called With The Render Ahead Lock Held, Blocks Already In The Ring Become Stale */
+	this->aheadGeneration++;
+	this->aheadCursor = this->getNextPosition(position, clipSize);
+	this->aheadResetRequested = false;
+}
+
+bool MainGraph::renderAheadBlock() {
+	int blockNum = this->renderAheadBlockNum;
+	if (blockNum <= 0) { return false; }
+	if (Renderer::getInstance()->getRendering()) { return false; }
+
+	/** Only While Playing */
+	auto position = dynamic_cast<PlayPosition*>(this->getPlayHead());
+	if (!position) { return false; }
+	if (!position->getPosition()->getIsPlaying()) { return false; }
+
+	/** Lock Graph Structure */
+	juce::ScopedTryReadLock audioLocker(audioLock::getAudioLock());
+	juce::ScopedTryReadLock sourceLocker(audioLock::getSourceLock());
+	juce::ScopedTryReadLock pluginLocker(audioLock::getPluginLock());
+	if (!(audioLocker.isLocked() && sourceLocker.isLocked() && pluginLocker.isLocked())) {
+		return false;
+	}
+
+	/** Own The Anticipative Tasks */
+	juce::SpinLock::ScopedLockType aheadLocker(this->aheadLock);
+
+	/**
+	 * Mark the schedule busy before checking it is still the newest one,
+	 * so an audio thread already on a newer schedule always sees the mark.
+	 */
+	AudioSnapshot<Schedule>::Reader schedule{ this->schedule };
+	this->aheadSchedule = &(*schedule);
+
+	bool rendered = false;
+	auto ahead = schedule->ahead.get();
+	int numSamples = this->aheadBlockSize;
+	if (ahead && (&(this->schedule.getLatest()) == &(*schedule))
+		&& numSamples > 0 && ahead->fifo.getNumReady() < blockNum && ahead->fifo.getFreeSpace() > 0) {
+		/** Check Buffers Still Fit The Processors */
+		bool fit = true;
+		for (auto i : schedule->aheadOrder) {
+			auto task = schedule->nodes.getUnchecked(i);
+			auto processor = task->node->getProcessor();
+			int channels = std::max(processor->getTotalNumInputChannels(), processor->getTotalNumOutputChannels());
+			if (channels > task->bufferChannels || numSamples > task->bufferSamples) {
+				fit = false;
+				break;
+			}
+		}
+
+		if (fit) {
+			/** Start Over After A Seek, Loop Change Or Missed Block */
+			if (this->aheadResetRequested.exchange(false) || this->aheadCursor < 0) {
+				this->restartRenderAhead(this->aheadLivePosition, numSamples);
+			}
+
+			/** An Invalidate During Rendering Makes This Block Stale */
+			uint64_t generation = this->aheadGeneration;
+
+			int start1, size1, start2, size2;
+			ahead->fifo.prepareToWrite(1, start1, size1, start2, size2);
+			auto block = ahead->blocks.getUnchecked(start1);
+
+			/** Process At The Cursor */
+			MovablePlayHead::setThreadPositionInSamples(this->aheadCursor);
+			for (auto i : schedule->aheadOrder) {
+				MainGraph::processScheduleTask(*(schedule->nodes.getUnchecked(i)), i, block->buffers,
+					this->aheadAudioTemp, this->aheadMIDITemp, numSamples);
+			}
+			MovablePlayHead::setThreadPositionInSamples(-1);
+
+			block->position = this->aheadCursor;
+			block->numSamples = numSamples;
+			block->generation = generation;
+			ahead->fifo.finishedWrite(1);
+
+			this->aheadCursor = this->getNextPosition(this->aheadCursor, numSamples);
+			rendered = true;
+		}
+	}
+
+	this->aheadSchedule = nullptr;
+	return rendered;
+}
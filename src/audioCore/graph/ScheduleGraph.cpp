@@ -0,0 +1,451 @@
+﻿#include "MainGraph.h"
+#include "../misc/VMath.h"
+#include "../misc/Renderer.h"
+
+void MainGraph::updateSchedule() {
+	/** Taken Before Any Early Return, So The Timer Doesn't Rebuild Again For The Same Sources */
+	this->liveSources = this->getLiveSources();
+
+	/** Rebuilt When The Transaction Is Committed */
+	if (this->isInTransaction()) { return; }
+
+	auto result = std::make_unique<Schedule>();
+
+	/** Tasks, Sources Before Tracks */
+	juce::HashMap<juce::uint32, int> taskIndex;
+	auto addTask = [&result, &taskIndex](const juce::AudioProcessorGraph::Node::Ptr& node) {
+		auto task = std::make_unique<ScheduleNode>();
+		task->node = node;
+
+		taskIndex.set(node->nodeID.uid, result->nodes.size());
+		result->nodes.add(std::move(task));
+	};
+	for (auto& i : this->audioSourceNodeList) {
+		addTask(i);
+	}
+	for (auto& i : this->trackNodeList) {
+		addTask(i);
+	}
+
+	/** Too Many Tasks, Leave It To The Graph */
+	int taskNum = result->nodes.size();
+	if (taskNum > ParallelScheduler::maxTaskNum) {
+		this->schedule.publish(std::move(result));
+		return;
+	}
+	result->taskGraph.predecessorNum.insertMultiple(0, 0, taskNum);
+	result->taskGraph.successors.insertMultiple(0, {}, taskNum);
+
+	/** Links */
+	bool valid = true;
+	juce::BigInteger liveTasks;
+	for (auto& i : this->getConnections()) {
+		bool isMIDI = i.source.isMIDI();
+
+		/** Source Task */
+		int src = -1;
+		if (i.source.nodeID != this->audioInputNode->nodeID
+			&& i.source.nodeID != this->midiInputNode->nodeID) {
+			if (!taskIndex.contains(i.source.nodeID.uid)) { valid = false; continue; }
+			src = taskIndex[i.source.nodeID.uid];
+		}
+
+		/** Device Output */
+		if (i.destination.nodeID == this->audioOutputNode->nodeID
+			|| i.destination.nodeID == this->midiOutputNode->nodeID) {
+			if (src < 0) { continue; }
+			if (isMIDI) {
+				result->midiOutputs.addIfNotAlreadyThere(src);
+			}
+			else {
+				result->audioOutputs.add({ src, i.source.channelIndex, i.destination.channelIndex });
+			}
+			continue;
+		}
+
+		/** Destination Task */
+		if (!taskIndex.contains(i.destination.nodeID.uid)) { valid = false; continue; }
+		int dst = taskIndex[i.destination.nodeID.uid];
+		auto dstTask = result->nodes.getUnchecked(dst);
+		if (isMIDI) {
+			dstTask->midiInputs.addIfNotAlreadyThere(src);
+		}
+		else {
+			dstTask->audioInputs.add({ src, i.source.channelIndex, i.destination.channelIndex });
+		}
+
+		/** Fed By The Device */
+		if (src < 0) {
+			liveTasks.setBit(dst);
+		}
+
+		/** Dependency */
+		if (src > -1) {
+			auto& successors = result->taskGraph.successors.getReference(src);
+			if (!successors.contains(dst)) {
+				successors.add(dst);
+				result->taskGraph.predecessorNum.getReference(dst)++;
+			}
+		}
+	}
+
+	/** Fixed Mix Order So Serial And Parallel Runs Sum Identically */
+	auto linkLess = [](const ScheduleLink& a, const ScheduleLink& b) {
+		return std::tie(a.srcTask, a.srcChannel, a.dstChannel) < std::tie(b.srcTask, b.srcChannel, b.dstChannel);
+	};
+	for (auto i : result->nodes) {
+		std::sort(i->audioInputs.begin(), i->audioInputs.end(), linkLess);
+		i->midiInputs.sort();
+	}
+	std::sort(result->audioOutputs.begin(), result->audioOutputs.end(), linkLess);
+	result->midiOutputs.sort();
+
+	/** Topological Order */
+	juce::Array<int> orderList;
+	{
+		juce::Array<int> pendingNum = result->taskGraph.predecessorNum;
+		for (int i = 0; i < taskNum; i++) {
+			if (pendingNum.getUnchecked(i) == 0) { orderList.add(i); }
+		}
+		for (int i = 0; i < orderList.size(); i++) {
+			for (auto j : result->taskGraph.successors.getReference(orderList.getUnchecked(i))) {
+				if (--(pendingNum.getReference(j)) == 0) { orderList.add(j); }
+			}
+		}
+	}
+
+	/** Cycle */
+	if (orderList.size() != taskNum) {
+		this->schedule.publish(std::move(result));
+		return;
+	}
+
+	/** Ancestors Of Each Task */
+	juce::Array<juce::BigInteger> ancestors;
+	ancestors.insertMultiple(0, {}, taskNum);
+	for (auto i : orderList) {
+		for (auto j : result->taskGraph.successors.getReference(i)) {
+			auto& ancestor = ancestors.getReference(j);
+			ancestor |= ancestors.getReference(i);
+			ancestor.setBit(i);
+		}
+	}
+
+	/** Device Outputs Keep Their Buffers Until The End Of The Block */
+	juce::BigInteger outputTasks;
+	for (auto& i : result->audioOutputs) {
+		outputTasks.setBit(i.srcTask);
+	}
+	for (auto i : result->midiOutputs) {
+		outputTasks.setBit(i);
+	}
+
+	/**
+	 * Shared Buffer Slots.
+	 * A task may take over the slot of a finished task only when that task and all of its
+	 * consumers are ancestors of it, so the slot is never touched by two running tasks.
+	 */
+	juce::Array<int> slotOwner;
+	juce::Array<int> slotChannels;
+	juce::Array<int> taskSlot;
+	taskSlot.insertMultiple(0, -1, taskNum);
+	for (auto i : orderList) {
+		auto& ancestor = ancestors.getReference(i);
+
+		int slot = -1;
+		for (int j = 0; j < slotOwner.size() && slot < 0; j++) {
+			int owner = slotOwner.getUnchecked(j);
+			if (outputTasks[owner] || !ancestor[owner]) { continue; }
+
+			bool consumed = true;
+			for (auto k : result->taskGraph.successors.getReference(owner)) {
+				if (!ancestor[k]) { consumed = false; break; }
+			}
+			if (consumed) { slot = j; }
+		}
+		if (slot < 0) {
+			slot = slotOwner.size();
+			slotOwner.add(i);
+			slotChannels.add(0);
+		}
+
+		auto processor = result->nodes.getUnchecked(i)->node->getProcessor();
+		int channels = std::max(processor->getTotalNumInputChannels(), processor->getTotalNumOutputChannels());
+
+		slotOwner.set(slot, i);
+		slotChannels.set(slot, std::max(slotChannels.getUnchecked(slot), channels));
+		taskSlot.set(i, slot);
+	}
+
+	/** Buffers */
+	int slotSamples = std::max(this->getBlockSize(), 0);
+	for (auto i : slotChannels) {
+		result->audioSlots.add(std::make_unique<juce::AudioBuffer<float>>(i, slotSamples));
+
+		auto midiBuffer = std::make_unique<juce::MidiBuffer>();
+		midiBuffer->ensureSize(4096);
+		result->midiSlots.add(std::move(midiBuffer));
+	}
+	for (int i = 0; i < taskNum; i++) {
+		auto task = result->nodes.getUnchecked(i);
+		int slot = taskSlot.getUnchecked(i);
+		result->buffers.audio.add(result->audioSlots.getUnchecked(slot));
+		result->buffers.midi.add(result->midiSlots.getUnchecked(slot));
+		task->bufferChannels = slotChannels.getUnchecked(slot);
+		task->bufferSamples = slotSamples;
+	}
+
+	/** Render Ahead */
+	int aheadNum = this->renderAheadBlockNum;
+	if (aheadNum > 0) {
+		/** Chains Fed By The Device, Input Monitored, Record Armed Or Played Directly Stay Live */
+		for (auto i : orderList) {
+			auto task = result->nodes.getUnchecked(i);
+			if (auto source = dynamic_cast<SeqSourceProcessor*>(task->node->getProcessor())) {
+				if (this->liveSources[i]) {
+					liveTasks.setBit(i);
+				}
+			}
+			if (liveTasks[i]) {
+				for (auto j : result->taskGraph.successors.getReference(i)) {
+					liveTasks.setBit(j);
+				}
+			}
+		}
+
+		/** Anticipative Tasks Hand Their Output To The Live Ones */
+		for (auto i : orderList) {
+			if (liveTasks[i]) { continue; }
+
+			auto task = result->nodes.getUnchecked(i);
+			task->anticipative = true;
+			task->aheadOutput = outputTasks[i];
+			for (auto j : result->taskGraph.successors.getReference(i)) {
+				if (liveTasks[j]) { task->aheadOutput = true; }
+			}
+			result->aheadOrder.add(i);
+		}
+
+		/** Ring Of Blocks */
+		if (!result->aheadOrder.isEmpty()) {
+			result->ahead = std::make_unique<AheadRing>(aheadNum + 1);
+			for (int i = 0; i < aheadNum + 1; i++) {
+				auto block = std::make_unique<AheadBlock>();
+				for (int j = 0; j < taskNum; j++) {
+					auto task = result->nodes.getUnchecked(j);
+					if (!task->anticipative) {
+						block->buffers.audio.add(nullptr);
+						block->buffers.midi.add(nullptr);
+						continue;
+					}
+
+					auto audioBuffer = std::make_unique<juce::AudioBuffer<float>>(task->bufferChannels, slotSamples);
+					auto midiBuffer = std::make_unique<juce::MidiBuffer>();
+					midiBuffer->ensureSize(4096);
+					block->buffers.audio.add(audioBuffer.get());
+					block->buffers.midi.add(midiBuffer.get());
+					block->audioStorage.add(std::move(audioBuffer));
+					block->midiStorage.add(std::move(midiBuffer));
+				}
+				result->ahead->blocks.add(std::move(block));
+			}
+		}
+	}
+
+	/** Publish */
+	result->valid = valid;
+	this->schedule.publish(std::move(result));
+}
+
+void MainGraph::handleAsyncUpdate() {
+	this->updateSchedule();
+}
+
+const juce::BigInteger MainGraph::getLiveSources() const {
+	juce::BigInteger result;
+	if (this->renderAheadBlockNum <= 0) { return result; }
+
+	/** Sources Come First In The Schedule, So Task Index Is Source Index */
+	for (int i = 0; i < this->audioSourceNodeList.size(); i++) {
+		auto source = dynamic_cast<SeqSourceProcessor*>(
+			this->audioSourceNodeList.getUnchecked(i)->getProcessor());
+		if (source && (source->isDirectMidiActive() || source->getInputMonitoring()
+			|| source->getRecording() != SeqSourceProcessor::RecordState::NotRecording)) {
+			result.setBit(i);
+		}
+	}
+	return result;
+}
+
+void MainGraph::updateLiveSources() {
+	/** Played, Monitored And Armed Tracks Go Live, Idle Ones Are Rendered Ahead Again */
+	if (this->getLiveSources() != this->liveSources) {
+		this->updateSchedule();
+	}
+}
+
+bool MainGraph::processScheduledBlock(juce::AudioBuffer<float>& audio, juce::MidiBuffer& midi) {
+	/** Nothing To Gain Without Workers Or Render Ahead, Keep The Graph */
+	if (this->getParallelThreadNum() <= 0 && this->renderAheadBlockNum <= 0) { return false; }
+
+	AudioSnapshot<Schedule>::Reader schedule{ this->schedule };
+	if (!schedule->valid) { return false; }
+
+	/** The Render Ahead Thread Still Works On A Replaced Schedule */
+	auto aheadSchedule = this->aheadSchedule.load();
+	if (aheadSchedule && aheadSchedule != &(*schedule)) { return false; }
+
+	/** Check Buffers Still Fit The Processors */
+	int numSamples = audio.getNumSamples();
+	for (auto i : schedule->nodes) {
+		auto processor = i->node->getProcessor();
+
+		/** Plugin Delay Is Only Compensated By The Graph */
+		if (processor->getLatencySamples() > 0) { return false; }
+
+		int channels = std::max(processor->getTotalNumInputChannels(), processor->getTotalNumOutputChannels());
+		if (channels > i->bufferChannels || numSamples > i->bufferSamples) {
+			this->triggerAsyncUpdate();
+			return false;
+		}
+	}
+
+	/** Transport */
+	int64_t position = 0;
+	bool isPlaying = false;
+	if (auto playHead = this->getPlayHead()) {
+		if (auto info = playHead->getPosition()) {
+			position = info->getTimeInSamples().orFallback(0);
+			isPlaying = info->getIsPlaying();
+		}
+	}
+	bool aheadActive = isPlaying && !Renderer::getInstance()->getRendering();
+
+	/** Take The Block Rendered Ahead For This Position, Drop Stale Ones */
+	auto ahead = schedule->ahead.get();
+	AheadBlock* aheadBlock = nullptr;
+	if (ahead) {
+		if (aheadActive) {
+			this->aheadLivePosition = position;
+			this->aheadBlockSize = numSamples;
+		}
+
+		uint64_t generation = this->aheadGeneration;
+		while (ahead->fifo.getNumReady() > 0) {
+			int start1, size1, start2, size2;
+			ahead->fifo.prepareToRead(1, start1, size1, start2, size2);
+			auto block = ahead->blocks.getUnchecked(start1);
+			if (aheadActive && block->generation == generation
+				&& block->position == position && block->numSamples == numSamples) {
+				aheadBlock = block;
+				break;
+			}
+			ahead->fifo.finishedRead(1);
+		}
+	}
+
+	/** Without A Block The Anticipative Tasks Run Live If The Render Ahead Thread Is Idle, Or Keep Silent */
+	juce::SpinLock::ScopedTryLockType aheadLocker(this->aheadLock, false);
+	bool aheadLive = ahead && !aheadBlock && aheadLocker.retryLock();
+	if (aheadLive) {
+		this->restartRenderAhead(position, numSamples);
+	}
+	else if (ahead && !aheadBlock && aheadActive) {
+		this->aheadResetRequested = true;
+	}
+
+	/** Process Nodes */
+	ParallelScheduler::TaskFunc func{
+		[&schedule = *schedule, &audio, &midi, numSamples, aheadBlock, aheadLive](int task) {
+			auto current = schedule.nodes.getUnchecked(task);
+
+			/** Anticipative Task Not Processed Here */
+			if (current->anticipative && !aheadLive) {
+				if (!current->aheadOutput) { return; }
+
+				auto processor = current->node->getProcessor();
+				auto& buffer = *(schedule.buffers.audio.getUnchecked(task));
+				auto& midiBuffer = *(schedule.buffers.midi.getUnchecked(task));
+
+				int channels = std::max(processor->getTotalNumInputChannels(), processor->getTotalNumOutputChannels());
+				buffer.setSize(channels, numSamples, false, false, true);
+				vMath::zeroAllAudioData(buffer);
+				midiBuffer.clear();
+
+				if (aheadBlock) {
+					auto& srcBuffer = *(aheadBlock->buffers.audio.getUnchecked(task));
+					int totalChannels = std::min(channels, srcBuffer.getNumChannels());
+					for (int i = 0; i < totalChannels; i++) {
+						vMath::copyAudioData(buffer, srcBuffer, 0, 0, i, i, numSamples);
+					}
+					midiBuffer.addEvents(*(aheadBlock->buffers.midi.getUnchecked(task)), 0, numSamples, 0);
+				}
+				return;
+			}
+
+			MainGraph::processScheduleTask(*current, task, schedule.buffers, audio, midi, numSamples);
+		} };
+	this->scheduler->process(schedule->taskGraph, func);
+
+	/** Block Used */
+	if (aheadBlock) {
+		ahead->fifo.finishedRead(1);
+	}
+	if (ahead && aheadActive) {
+		this->aheadThread->wakeUp();
+	}
+
+	/** Device Output */
+	vMath::zeroAllAudioData(audio);
+	for (auto& [src, srcc, dstc] : schedule->audioOutputs) {
+		auto& srcBuffer = *(schedule->buffers.audio.getUnchecked(src));
+		if (srcc < 0 || srcc >= srcBuffer.getNumChannels()) { continue; }
+		if (dstc < 0 || dstc >= audio.getNumChannels()) { continue; }
+		vMath::addAudioData(audio, srcBuffer, 0, 0, dstc, srcc, numSamples);
+	}
+	midi.clear();
+	for (auto src : schedule->midiOutputs) {
+		midi.addEvents(*(schedule->buffers.midi.getUnchecked(src)), 0, numSamples, 0);
+	}
+
+	return true;
+}
+
+void MainGraph::processScheduleTask(const ScheduleNode& task, int index, const TaskBuffers& buffers,
+	const juce::AudioBuffer<float>& audio, const juce::MidiBuffer& midi, int numSamples) {
+	auto node = task.node.get();
+	auto processor = node->getProcessor();
+	auto& buffer = *(buffers.audio.getUnchecked(index));
+	auto& midiBuffer = *(buffers.midi.getUnchecked(index));
+
+	/** Prepare Buffer */
+	int channels = std::max(processor->getTotalNumInputChannels(), processor->getTotalNumOutputChannels());
+	buffer.setSize(channels, numSamples, false, false, true);
+	vMath::zeroAllAudioData(buffer);
+	midiBuffer.clear();
+
+	/** Mix Inputs */
+	for (auto& [src, srcc, dstc] : task.audioInputs) {
+		auto& srcBuffer = (src > -1) ? *(buffers.audio.getUnchecked(src)) : audio;
+		if (srcc < 0 || srcc >= srcBuffer.getNumChannels()) { continue; }
+		if (dstc < 0 || dstc >= channels) { continue; }
+		vMath::addAudioData(buffer, srcBuffer, 0, 0, dstc, srcc, numSamples);
+	}
+	for (auto src : task.midiInputs) {
+		auto& srcBuffer = (src > -1) ? *(buffers.midi.getUnchecked(src)) : midi;
+		midiBuffer.addEvents(srcBuffer, 0, numSamples, 0);
+	}
+
+	/** Process */
+	const juce::ScopedLock callbackLocker(processor->getCallbackLock());
+	if (processor->isSuspended()) {
+		vMath::zeroAllAudioData(buffer);
+		midiBuffer.clear();
+	}
+	else if (node->isBypassed()) {
+		processor->processBlockBypassed(buffer, midiBuffer);
+	}
+	else {
+		processor->processBlock(buffer, midiBuffer);
+	}
+}
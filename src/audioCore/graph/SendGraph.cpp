@@ -17,12 +17,15 @@ void MainGraph::setMIDISrc2TrkConnection(int sourceIndex, int trackIndex) {
 	juce::AudioProcessorGraph::Connection connection =
 	{ {srcNodeID, this->midiChannelIndex},
 	{trkNodeID, this->midiChannelIndex} };
-	this->addConnection(connection);
+	this->addConnection(connection, this->getUpdateKind());
 	this->midiSrc2TrkConnectionList.add(connection);
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, trackIndex);
-	UICallbackAPI<int>::invoke(UICallbackType::SeqChanged, sourceIndex);
+	this->invokeCallback(UICallbackType::TrackChanged, trackIndex);
+	this->invokeCallback(UICallbackType::SeqChanged, sourceIndex);
 }
 
 void MainGraph::removeMIDISrc2TrkConnection(int sourceIndex, int trackIndex) {
@@ -39,15 +42,18 @@ void MainGraph::removeMIDISrc2TrkConnection(int sourceIndex, int trackIndex) {
 		[this, srcNodeID, trkNodeID](const juce::AudioProcessorGraph::Connection& element) {
 			if (element.source.nodeID == srcNodeID &&
 				element.destination.nodeID == trkNodeID) {
-				this->removeConnection(element);
+				this->removeConnection(element, this->getUpdateKind());
 				return true;
 			}
 			return false;
 		});
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, trackIndex);
-	UICallbackAPI<int>::invoke(UICallbackType::SeqChanged, sourceIndex);
+	this->invokeCallback(UICallbackType::TrackChanged, trackIndex);
+	this->invokeCallback(UICallbackType::SeqChanged, sourceIndex);
 }
 
 void MainGraph::setAudioSrc2TrkConnection(int sourceIndex, int trackIndex, int srcChannel, int dstChannel) {
@@ -71,13 +77,16 @@ void MainGraph::setAudioSrc2TrkConnection(int sourceIndex, int trackIndex, int s
 	juce::AudioProcessorGraph::Connection connection =
 	{ {srcNodeID, srcChannel}, {trkNodeID, dstChannel} };
 	if (!this->isConnected(connection)) {
-		this->addConnection(connection);
+		this->addConnection(connection, this->getUpdateKind());
 		this->audioSrc2TrkConnectionList.add(connection);
 	}
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, trackIndex);
-	UICallbackAPI<int>::invoke(UICallbackType::SeqChanged, sourceIndex);
+	this->invokeCallback(UICallbackType::TrackChanged, trackIndex);
+	this->invokeCallback(UICallbackType::SeqChanged, sourceIndex);
 }
 
 void MainGraph::removeAudioSrc2TrkConnection(int sourceIndex, int trackIndex, int srcChannel, int dstChannel) {
@@ -92,12 +101,15 @@ void MainGraph::removeAudioSrc2TrkConnection(int sourceIndex, int trackIndex, in
 	/** Remove Connection */
 	juce::AudioProcessorGraph::Connection connection =
 	{ {srcNodeID, srcChannel}, {trkNodeID, dstChannel} };
-	this->removeConnection(connection);
+	this->removeConnection(connection, this->getUpdateKind());
 	this->audioSrc2TrkConnectionList.removeAllInstancesOf(connection);
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, trackIndex);
-	UICallbackAPI<int>::invoke(UICallbackType::SeqChanged, sourceIndex);
+	this->invokeCallback(UICallbackType::TrackChanged, trackIndex);
+	this->invokeCallback(UICallbackType::SeqChanged, sourceIndex);
 }
 
 bool MainGraph::isMIDISrc2TrkConnected(int sourceIndex, int trackIndex) const {
@@ -7,7 +7,7 @@ void MainGraph::insertSource(int index, const juce::AudioChannelSet& type) {
 	juce::ScopedWriteLock locker(audioLock::getSourceLock());
 
 	/** Add To The Graph */
-	if (auto ptrNode = this->addNode(std::make_unique<SeqSourceProcessor>(type))) {
+	if (auto ptrNode = this->addNode(std::make_unique<SeqSourceProcessor>(type), {}, this->getUpdateKind())) {
 		/** Limit Index */
 		if (index < 0 || index > this->audioSourceNodeList.size()) {
 			index = this->audioSourceNodeList.size();
@@ -16,6 +16,11 @@ void MainGraph::insertSource(int index, const juce::AudioChannelSet& type) {
 		/** Add Node To The Source List */
 		this->audioSourceNodeList.insert(index, ptrNode);
 
+		/** Join The Transaction */
+		if (this->isInTransaction()) {
+			dynamic_cast<SeqSourceProcessor*>(ptrNode->getProcessor())->beginTransaction();
+		}
+
 		/** Prepare To Play */
 		ptrNode->getProcessor()->setPlayHead(this->getPlayHead());
 		ptrNode->getProcessor()->prepareToPlay(this->getSampleRate(), this->getBlockSize());
@@ -27,8 +32,11 @@ void MainGraph::insertSource(int index, const juce::AudioChannelSet& type) {
 			dynamic_cast<SeqSourceProcessor*>(node->getProcessor())->updateIndex(i);
 		}
 
+		/** Update Schedule */
+		this->updateSchedule();
+
 		/** Callback */
-		UICallbackAPI<int>::invoke(UICallbackType::SeqChanged, index);
+		this->invokeCallback(UICallbackType::SeqChanged, index);
 	}
 	else {
 		jassertfalse;
@@ -49,7 +57,7 @@ void MainGraph::removeSource(int index) {
 	this->midiI2SrcConnectionList.removeIf(
 		[this, nodeID = ptrNode->nodeID](const juce::AudioProcessorGraph::Connection& element) {
 			if (element.destination.nodeID == nodeID) {
-				this->removeConnection(element);
+				this->removeConnection(element, this->getUpdateKind());
 				return true;
 			}
 			return false;
@@ -59,7 +67,7 @@ void MainGraph::removeSource(int index) {
 	this->audioI2SrcConnectionList.removeIf(
 		[this, nodeID = ptrNode->nodeID](const juce::AudioProcessorGraph::Connection& element) {
 			if (element.destination.nodeID == nodeID) {
-				this->removeConnection(element);
+				this->removeConnection(element, this->getUpdateKind());
 				return true;
 			}
 			return false;
@@ -69,7 +77,7 @@ void MainGraph::removeSource(int index) {
 	this->midiSrc2TrkConnectionList.removeIf(
 		[this, nodeID = ptrNode->nodeID](const juce::AudioProcessorGraph::Connection& element) {
 			if (element.source.nodeID == nodeID) {
-				this->removeConnection(element);
+				this->removeConnection(element, this->getUpdateKind());
 				return true;
 			}
 			return false;
@@ -79,14 +87,14 @@ void MainGraph::removeSource(int index) {
 	this->audioSrc2TrkConnectionList.removeIf(
 		[this, nodeID = ptrNode->nodeID](const juce::AudioProcessorGraph::Connection& element) {
 			if (element.source.nodeID == nodeID) {
-				this->removeConnection(element);
+				this->removeConnection(element, this->getUpdateKind());
 				return true;
 			}
 			return false;
 		});
 
 	/** Remove Node From Graph */
-	this->removeNode(ptrNode->nodeID);
+	this->removeNode(ptrNode->nodeID, this->getUpdateKind());
 
 	/** Set Index */
 	for (int i = index; i < this->audioSourceNodeList.size(); i++) {
@@ -94,8 +102,11 @@ void MainGraph::removeSource(int index) {
 		dynamic_cast<SeqSourceProcessor*>(node->getProcessor())->updateIndex(i);
 	}
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::SeqChanged, index);
+	this->invokeCallback(UICallbackType::SeqChanged, index);
 }
 
 int MainGraph::getSourceNum() const {
@@ -114,7 +125,7 @@ void MainGraph::setSourceBypass(int index, bool bypass) {
 		node->setBypassed(bypass);
 
 		/** Callback */
-		UICallbackAPI<int>::invoke(UICallbackType::SeqChanged, index);
+		this->invokeCallback(UICallbackType::SeqChanged, index);
 	}
 }
 
@@ -140,11 +151,14 @@ void MainGraph::setMIDII2SrcConnection(int sourceIndex) {
 	juce::AudioProcessorGraph::Connection connection =
 	{ {this->midiInputNode->nodeID, this->midiChannelIndex},
 	{nodeID, this->midiChannelIndex} };
-	this->addConnection(connection);
+	this->addConnection(connection, this->getUpdateKind());
 	this->midiI2SrcConnectionList.add(connection);
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::SeqChanged, sourceIndex);
+	this->invokeCallback(UICallbackType::SeqChanged, sourceIndex);
 }
 
 void MainGraph::removeMIDII2SrcConnection(int sourceIndex) {
@@ -158,14 +172,17 @@ void MainGraph::removeMIDII2SrcConnection(int sourceIndex) {
 	this->midiI2SrcConnectionList.removeIf(
 		[this, nodeID](const juce::AudioProcessorGraph::Connection& element) {
 			if (element.destination.nodeID == nodeID) {
-				this->removeConnection(element);
+				this->removeConnection(element, this->getUpdateKind());
 				return true;
 			}
 			return false;
 		});
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::SeqChanged, sourceIndex);
+	this->invokeCallback(UICallbackType::SeqChanged, sourceIndex);
 }
 
 void MainGraph::setAudioI2SrcConnection(int sourceIndex, int srcChannel, int dstChannel) {
@@ -184,12 +201,15 @@ void MainGraph::setAudioI2SrcConnection(int sourceIndex, int srcChannel, int dst
 	juce::AudioProcessorGraph::Connection connection =
 	{ {this->audioInputNode->nodeID, srcChannel}, {nodeID, dstChannel} };
 	if (!this->isConnected(connection)) {
-		this->addConnection(connection);
+		this->addConnection(connection, this->getUpdateKind());
 		this->audioI2SrcConnectionList.add(connection);
 	}
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::SeqChanged, sourceIndex);
+	this->invokeCallback(UICallbackType::SeqChanged, sourceIndex);
 }
 
 void MainGraph::removeAudioI2SrcConnection(int sourceIndex, int srcChannel, int dstChannel) {
@@ -199,11 +219,14 @@ void MainGraph::removeAudioI2SrcConnection(int sourceIndex, int srcChannel, int
 
 	juce::AudioProcessorGraph::Connection connection =
 	{ {this->audioInputNode->nodeID, srcChannel}, {nodeID, dstChannel} };
-	this->removeConnection(connection);
+	this->removeConnection(connection, this->getUpdateKind());
 	this->audioI2SrcConnectionList.removeAllInstancesOf(connection);
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::SeqChanged, sourceIndex);
+	this->invokeCallback(UICallbackType::SeqChanged, sourceIndex);
 }
 
 bool MainGraph::isMIDII2SrcConnected(int sourceIndex) const {
@@ -378,6 +401,9 @@ utils::MidiConnectionList MainGraph::getSourceMidiOutputToTrackConnections(int i
 }
 
 void MainGraph::closeAllNote() {
+	/** Notes Already Sent To The MIDI Output */
+	this->noteCloseFlag = true;
+
 	for (auto& i : this->audioSourceNodeList) {
 		auto seqTrack = dynamic_cast<SeqSourceProcessor*>(i->getProcessor());
 		if (seqTrack) {
@@ -399,12 +425,15 @@ void MainGraph::removeIllegalAudioI2SrcConnections() {
 	this->audioI2SrcConnectionList.removeIf(
 		[this](const juce::AudioProcessorGraph::Connection& element) {
 			if (element.source.channelIndex >= this->getTotalNumInputChannels()) {
-				this->removeConnection(element);
+				this->removeConnection(element, this->getUpdateKind());
 				return true;
 			}
 			return false;
 		});
 
+	/** Update Schedule */
+	this->updateSchedule();
+
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::SeqChanged, -1);
+	this->invokeCallback(UICallbackType::SeqChanged, -1);
 }
@@ -2,6 +2,7 @@
 #include "../misc/PlayPosition.h"
 #include "../misc/AudioLock.h"
 #include "../misc/VMath.h"
+#include "../misc/EngineHealth.h"
 #include "../source/SourceManager.h"
 #include "../AudioConfig.h"
 #include "../uiCallback/UICallback.h"
@@ -9,6 +10,80 @@
 #include <VSP4.h>
 using namespace org::vocalsharp::vocalshaper;
 
+class FreezeThread final : public juce::Thread {
+public:
+	FreezeThread() = delete;
+	FreezeThread(SeqSourceProcessor* source, PluginDecorator* decorator, int generation,
+		double sampleRate, int blockSize, int totalSamples, int mainChannels, int renderChannels);
+
+public:
+	void run() override;
+
+private:
+	SeqSourceProcessor* const source = nullptr;
+	PluginDecorator* const decorator = nullptr;
+	const int generation;
+	const double sampleRate;
+	const int blockSize, totalSamples;
+	const int mainChannels, renderChannels;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FreezeThread)
+};
+
+FreezeThread::FreezeThread(SeqSourceProcessor* source, PluginDecorator* decorator, int generation,
+	double sampleRate, int blockSize, int totalSamples, int mainChannels, int renderChannels)
+	: Thread("Instrument Freeze"), source(source), decorator(decorator), generation(generation),
+	sampleRate(sampleRate), blockSize(blockSize), totalSamples(totalSamples),
+	mainChannels(mainChannels), renderChannels(renderChannels) {}
+
+void FreezeThread::run() {
+	auto data = std::make_shared<juce::AudioBuffer<float>>(this->mainChannels, this->totalSamples);
+
+	juce::AudioBuffer<float> buffer{ this->renderChannels, this->blockSize };
+	juce::MidiBuffer midiMessages;
+	for (int pos = 0; pos < this->totalSamples; pos += this->blockSize) {
+		/** Cancelled */
+		if (this->threadShouldExit()) {
+			MovablePlayHead::setThreadPositionInSamples(-1);
+			return;
+		}
+
+		/** Lock Sources And Plugins For The Block, Retry So A Cancel Under The Plugin Lock Isn't Blocked */
+		juce::ScopedTryReadLock sourceLocker(audioLock::getSourceLock());
+		juce::ScopedTryReadLock pluginLocker(audioLock::getPluginLock());
+		if (!(sourceLocker.isLocked() && pluginLocker.isLocked())) {
+			pos -= this->blockSize;
+			this->wait(1);
+			continue;
+		}
+
+		int length = std::min(this->blockSize, this->totalSamples - pos);
+		juce::AudioBuffer<float> block{
+			buffer.getArrayOfWritePointers(), this->renderChannels, 0, length };
+		vMath::zeroAllAudioData(block);
+		midiMessages.clear();
+
+		/** Plugins See The Render Position Instead Of The Transport */
+		MovablePlayHead::setThreadPositionInSamples(pos);
+		this->source->readSourceBlock(block, midiMessages, pos);
+		this->decorator->processBlock(block, midiMessages);
+
+		for (int i = 0; i < this->mainChannels; i++) {
+			vMath::copyAudioData(*data, block, pos, 0, i, i, length);
+		}
+	}
+	MovablePlayHead::setThreadPositionInSamples(-1);
+
+	/** Publish On The Message Thread */
+	juce::MessageManager::callAsync(
+		[source = SeqSourceProcessor::SafePointer{ this->source },
+		generation = this->generation, data, sampleRate = this->sampleRate] {
+			if (source) {
+				source->finishFreeze(generation, data, sampleRate);
+			}
+		});
+}
+
 SeqSourceProcessor::SeqSourceProcessor(const juce::AudioChannelSet& type)
 	: audioChannels(type) {
 	/** Set Channel Layout */
@@ -48,13 +123,17 @@ SeqSourceProcessor::SeqSourceProcessor(const juce::AudioChannelSet& type)
 	}
 
 	/** Set Level Size */
-	this->outputLevels.resize(type.size());
+	this->outputMeter.setChannelNum(type.size());
 
 	/** Default Color */
 	this->trackColor = utils::getDefaultColour();
 }
 
 SeqSourceProcessor::~SeqSourceProcessor() {
+	if (this->freezeThread) {
+		this->freezeThread->stopThread(3000);
+	}
+
 	this->releaseAudio();
 	this->releaseMIDI();
 }
@@ -64,7 +143,7 @@ void SeqSourceProcessor::updateIndex(int index) {
 	this->srcs.updateIndex(index);
 
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::SeqChanged, index);
+	this->invokeCallback(UICallbackType::SeqChanged, index);
 }
 
 int SeqSourceProcessor::addSeq(const SourceList::SeqBlock& block) {
@@ -138,7 +217,7 @@ void SeqSourceProcessor::setTrackName(const juce::String& name) {
 	}
 
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::SeqChanged, this->index);
+	this->invokeCallback(UICallbackType::SeqChanged, this->index);
 }
 
 const juce::String SeqSourceProcessor::getTrackName() const {
@@ -154,7 +233,7 @@ void SeqSourceProcessor::setTrackColor(const juce::Colour& color) {
 	}
 
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::SeqChanged, this->index);
+	this->invokeCallback(UICallbackType::SeqChanged, this->index);
 }
 
 const juce::Colour SeqSourceProcessor::getTrackColor() const {
@@ -182,7 +261,7 @@ void SeqSourceProcessor::setInstr(std::unique_ptr<juce::AudioPluginInstance> pro
 		ptrNode->setPlugin(std::move(processor), identifier, {});
 
 		/** Callback */
-		UICallbackAPI<int>::invoke(UICallbackType::InstrChanged, this->index);
+		this->invokeCallback(UICallbackType::InstrChanged, this->index);
 	}
 	else {
 		jassertfalse;
@@ -197,7 +276,7 @@ PluginDecorator::SafePointer SeqSourceProcessor::prepareInstr() {
 
 	/** Add Node */
 	if (auto ptrNode = this->addNode(
-		std::make_unique<PluginDecorator>(this, true, this->audioChannels))) {
+		std::make_unique<PluginDecorator>(this, true, this->audioChannels), {}, this->getUpdateKind())) {
 		/** Set Instr */
 		this->instr = ptrNode;
 
@@ -217,7 +296,7 @@ PluginDecorator::SafePointer SeqSourceProcessor::prepareInstr() {
 		}
 
 		/** Callback */
-		UICallbackAPI<int>::invoke(UICallbackType::InstrChanged, this->index);
+		this->invokeCallback(UICallbackType::InstrChanged, this->index);
 
 		return PluginDecorator::SafePointer{ decorator };
 	}
@@ -228,8 +307,17 @@ PluginDecorator::SafePointer SeqSourceProcessor::prepareInstr() {
 }
 
 void SeqSourceProcessor::removeInstr() {
+	/** Stop Rendering Before The Instrument Goes Away */
+	this->cancelFreeze();
+
 	juce::ScopedWriteLock pluginLocker(audioLock::getPluginLock());
 
+	/** The Cache Belongs To The Removed Instrument */
+	if (this->frozen) {
+		this->clearFreezeData();
+		this->instrOffline = false;
+	}
+
 	if (auto ptrNode = this->instr) {
 		/** Remove Instr */
 		this->instr = nullptr;
@@ -238,10 +326,10 @@ void SeqSourceProcessor::removeInstr() {
 		this->unlinkInstr();
 
 		/** Remove Node */
-		this->removeNode(ptrNode->nodeID);
+		this->removeNode(ptrNode->nodeID, this->getUpdateKind());
 
 		/** Callback */
-		UICallbackAPI<int>::invoke(UICallbackType::InstrChanged, this->index);
+		this->invokeCallback(UICallbackType::InstrChanged, this->index);
 	}
 }
 
@@ -310,13 +398,135 @@ void SeqSourceProcessor::setInstrOffline(bool offline) {
 	}
 
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::InstrChanged, this->index);
+	this->invokeCallback(UICallbackType::InstrChanged, this->index);
 }
 
 bool SeqSourceProcessor::getInstrOffline() const {
 	return this->instrOffline;
 }
 
+bool SeqSourceProcessor::freeze() {
+	auto decorator = this->getInstrProcessor();
+	if (!decorator) { return false; }
+	if (this->frozen || this->freezing) { return true; }
+
+	double sampleRate = this->getSampleRate();
+	int blockSize = this->getBlockSize();
+	if (sampleRate <= 0 || blockSize <= 0) { return false; }
+
+	/** Render Length With Instrument Tail */
+	double tailLength = juce::jlimit(0.0, SeqSourceProcessor::freezeTailLimit,
+		decorator->getTailLengthSeconds());
+	int totalSamples = std::ceil((this->getTailLengthSeconds() + tailLength) * sampleRate);
+	if (totalSamples <= 0) { return false; }
+
+	int mainChannels = this->audioChannels.size();
+	int renderChannels = std::max({ mainChannels,
+		decorator->getTotalNumInputChannels(), decorator->getTotalNumOutputChannels() });
+
+	{
+		/** Keep Audio Threads Away From The Instrument Until The Render Is Done */
+		juce::ScopedWriteLock pluginLocker(audioLock::getPluginLock());
+		this->freezing = true;
+	}
+
+	/** Keep Plugin State To Restore After Rendering */
+	this->freezeState.reset();
+	decorator->getStateInformation(this->freezeState);
+	decorator->setNonRealtime(true);
+	decorator->reset();
+
+	/** Render Without Holding The Plugin Lock */
+	this->freezeThread = std::make_unique<FreezeThread>(this, decorator, ++(this->freezeGeneration),
+		sampleRate, blockSize, totalSamples, mainChannels, renderChannels);
+	this->freezeThread->startThread();
+
+	/** Callback */
+	this->invokeCallback(UICallbackType::InstrChanged, this->index);
+
+	return true;
+}
+
+void SeqSourceProcessor::finishFreeze(int generation,
+	std::shared_ptr<const juce::AudioBuffer<float>> data, double sampleRate) {
+	/** Cancelled Or Restarted */
+	if (!this->freezing || generation != this->freezeGeneration) { return; }
+	if (this->freezeThread) {
+		this->freezeThread->stopThread(3000);
+		this->freezeThread = nullptr;
+	}
+
+	/** Sample Rate Changed While Rendering */
+	if (!juce::approximatelyEqual(sampleRate, this->getSampleRate())) {
+		this->cancelFreeze();
+		this->freeze();
+		return;
+	}
+
+	this->restoreFreezeInstr();
+
+	/** Play The Cache With The Instrument Offline */
+	this->freezeData = data;
+	this->freezeSampleRate = sampleRate;
+	this->updateFreezeCache();
+	this->frozen = true;
+	this->setInstrOffline(true);
+
+	/** The Instrument Is Already Unlinked */
+	this->freezing = false;
+}
+
+void SeqSourceProcessor::cancelFreeze() {
+	if (!this->freezing) { return; }
+
+	this->freezeGeneration++;
+	if (this->freezeThread) {
+		this->freezeThread->stopThread(3000);
+		this->freezeThread = nullptr;
+	}
+
+	this->restoreFreezeInstr();
+	this->freezing = false;
+
+	/** Callback */
+	this->invokeCallback(UICallbackType::InstrChanged, this->index);
+}
+
+void SeqSourceProcessor::restoreFreezeInstr() {
+	if (auto decorator = this->getInstrProcessor()) {
+		decorator->setNonRealtime(false);
+		decorator->reset();
+		decorator->setStateInformation(
+			this->freezeState.getData(), (int)this->freezeState.getSize());
+	}
+	this->freezeState.reset();
+}
+
+void SeqSourceProcessor::unfreeze() {
+	this->cancelFreeze();
+	if (!this->frozen) { return; }
+
+	this->setInstrOffline(false);
+	this->clearFreezeData();
+
+	/** Callback */
+	this->invokeCallback(UICallbackType::InstrChanged, this->index);
+}
+
+bool SeqSourceProcessor::getFrozen() const {
+	return this->frozen;
+}
+
+bool SeqSourceProcessor::isFreezing() const {
+	return this->freezing;
+}
+
+void SeqSourceProcessor::cancelFreezeRender() {
+	/** Restoring The Instrument After The Render Comes Here Too */
+	if (!this->freezeThread) { return; }
+	this->cancelFreeze();
+}
+
 uint64_t SeqSourceProcessor::getAudioRef() const {
 	return this->audioSourceRef;
 }
@@ -504,7 +714,7 @@ void SeqSourceProcessor::setCurrentMIDITrack(int trackIndex) {
 	}
 
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::SeqDataRefChanged, this->index);
+	this->invokeCallback(UICallbackType::SeqDataRefChanged, this->index);
 }
 
 int SeqSourceProcessor::getCurrentMIDITrack() const {
@@ -525,7 +735,7 @@ void SeqSourceProcessor::setRecording(RecordState recordState) {
 	this->recordingFlag = recordState;
 
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::SeqRecChanged, this->index);
+	this->invokeCallback(UICallbackType::SeqRecChanged, this->index);
 }
 
 SeqSourceProcessor::RecordState SeqSourceProcessor::getRecording() const {
@@ -541,7 +751,7 @@ void SeqSourceProcessor::setMute(bool mute) {
 	}
 
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::SeqMuteChanged, this->index);
+	this->invokeCallback(UICallbackType::SeqMuteChanged, this->index);
 }
 
 bool SeqSourceProcessor::getMute() const {
@@ -552,7 +762,7 @@ void SeqSourceProcessor::setInputMonitoring(bool inputMonitoring) {
 	this->inputMonitoring = inputMonitoring;
 
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::SeqInputMonitoringChanged, this->index);
+	this->invokeCallback(UICallbackType::SeqInputMonitoringChanged, this->index);
 }
 
 bool SeqSourceProcessor::getInputMonitoring() const {
@@ -560,8 +770,19 @@ bool SeqSourceProcessor::getInputMonitoring() const {
 }
 
 const juce::Array<float> SeqSourceProcessor::getOutputLevels() const {
-	juce::ScopedReadLock locker(audioLock::getLevelMeterLock());
-	return this->outputLevels;
+	return this->outputMeter.getRMSLevels();
+}
+
+const juce::Array<float> SeqSourceProcessor::getOutputPeakLevels() const {
+	return this->outputMeter.getPeakLevels();
+}
+
+const juce::Array<float> SeqSourceProcessor::getOutputTruePeakLevels() const {
+	return this->outputMeter.getTruePeakLevels();
+}
+
+const NodeProfiler::Usage SeqSourceProcessor::getCPUUsage() const {
+	return this->profiler.getUsage();
 }
 
 void SeqSourceProcessor::syncARAContext() {
@@ -588,16 +809,70 @@ void SeqSourceProcessor::writeRecordingDataToSource(
 }
 
 void SeqSourceProcessor::sendDirectMidiMessages(const juce::MidiMessage& message) {
-	juce::ScopedWriteLock locker(audioLock::getAudioControlLock());
-	this->directMessages.add(message);
+	this->sendDirectMidiMessages(message, juce::Time::getMillisecondCounterHiRes());
+}
+
+void SeqSourceProcessor::sendDirectMidiMessages(const juce::MidiMessage& message, double timeMs) {
+	/** Long SysEx Doesn't Fit In The Queue */
+	DirectMessage item;
+	int size = message.getRawDataSize();
+	if (size <= 0) { return; }
+	if (size > item.data.size()) {
+		EngineHealth::getInstance()->report(
+			EngineHealth::EventType::MIDIOverflow, this->getCurrentPositionInSamples());
+		return;
+	}
+
+	std::memcpy(item.data.data(), message.getRawData(), size);
+	item.size = size;
+	item.timeMs = timeMs;
+	if (!this->directMessages.push(item)) {
+		EngineHealth::getInstance()->report(
+			EngineHealth::EventType::MIDIOverflow, this->getCurrentPositionInSamples());
+		return;
+	}
+	this->lastDirectMessageTimeMs = juce::Time::getMillisecondCounterHiRes();
+}
+
+int64_t SeqSourceProcessor::getCurrentPositionInSamples() const {
+	if (auto playHead = this->getPlayHead()) {
+		if (auto pos = playHead->getPosition()) {
+			return pos->getTimeInSamples().orFallback(0);
+		}
+	}
+	return 0;
+}
+
+bool SeqSourceProcessor::isDirectMidiActive() const {
+	double lastTimeMs = this->lastDirectMessageTimeMs;
+	return lastTimeMs > 0
+		&& (juce::Time::getMillisecondCounterHiRes() - lastTimeMs) < SeqSourceProcessor::directMidiLiveTime;
 }
 
 void SeqSourceProcessor::prepareToPlay(
 	double sampleRate, int maximumExpectedSamplesPerBlock) {
+	/** The Instrument Can't Be Prepared While Rendering, Render Again With The New Settings */
+	if (this->freezeThread) {
+		this->cancelFreeze();
+		juce::MessageManager::callAsync([ptr = SeqSourceProcessor::SafePointer{ this }] {
+			if (ptr) {
+				ptr->freeze();
+			}
+			});
+	}
+
 	this->juce::AudioProcessorGraph::prepareToPlay(
 		sampleRate, maximumExpectedSamplesPerBlock);
 	SourceManager::getInstance()->prepareMIDIPlay(this->midiSourceRef);
 	SourceManager::getInstance()->prepareAudioPlay(this->audioSourceRef);
+
+	/** Note Close Buffer */
+	this->noteCloseTemp.ensureSize(4096);
+
+	/** Resample Frozen Data To The New Sample Rate */
+	if (this->frozen) {
+		this->updateFreezeCache();
+	}
 }
 
 void SeqSourceProcessor::processBlock(
@@ -606,6 +881,9 @@ void SeqSourceProcessor::processBlock(
 	if (buffer.getNumChannels() <= 0) { return; }
 	if (buffer.getNumSamples() <= 0) { return; }
 
+	/** Profile Including Instrument */
+	NodeProfiler::Scope profilerScope(this->profiler, buffer.getNumSamples(), this->getSampleRate());
+
 	if (!this->inputMonitoring) {
 		/** Clear MIDI Buffer */
 		midiMessages.clear();
@@ -628,86 +906,45 @@ void SeqSourceProcessor::processBlock(
 	/** Check Play State */
 	if (!position->getIsPlaying()) { isPlaying = false; }
 
-	if (isPlaying && !(this->isMute)) {
-		/** Get Time */
-		double startTime = position->getTimeInSeconds().orFallback(-1);
-		double sampleRate = this->getSampleRate();
-		double duration = buffer.getNumSamples() / sampleRate;
-		double endTime = startTime + duration;
-
-		int startTimeInSample = position->getTimeInSamples().orFallback(-1);
-		int durationInSample = buffer.getNumSamples();
-		int endTimeInSample = startTimeInSample + durationInSample;
-
-		int sourceLengthInSample = std::floor(this->getSourceLength() * sampleRate);
-
-		/** Find Hot Block */
-		auto index = this->srcs.match(startTime, endTime);
+	/** Get Time */
+	int startTimeInSample = -1;
+	if (isPlaying) {
+		startTimeInSample = position->getTimeInSamples().orFallback(-1);
+	}
 
+	if (isPlaying && !(this->isMute)) {
 		/** Copy Source Data */
-		for (int i = std::get<0>(index);
-			i <= std::get<1>(index) && i < this->srcs.size() && i >= 0; i++) {
-			/** Get Block */
-			auto [blockStartTime, blockEndTime, sourceOffset] = this->srcs.getUnchecked(i);
-			int blockStartTimeInSample = std::floor(blockStartTime * sampleRate);
-			int blockEndTimeInSample = std::floor(blockEndTime * sampleRate);
-			int sourceOffsetInSample = std::floor(sourceOffset * sampleRate);
-
-			/** Caculate Time */
-			int sourceStartTimeInSample = sourceOffsetInSample;
-			int sourceEndTimeInSample = sourceStartTimeInSample + sourceLengthInSample;
-			int dataStartTimeInSample = std::max(blockStartTimeInSample, sourceStartTimeInSample);
-			int dataEndTimeInSample = std::min(blockEndTimeInSample, sourceEndTimeInSample);
-
-			if (dataEndTimeInSample > dataStartTimeInSample) {
-				int hotStartTimeInSample = std::max(startTimeInSample, dataStartTimeInSample);
-				int hotEndTimeInSample = std::min(endTimeInSample, dataEndTimeInSample);
-				int hotLengthInSample = hotEndTimeInSample - hotStartTimeInSample;
-
-				if (hotLengthInSample > 0) {
-					int bufferOffsetInSample = hotStartTimeInSample - startTimeInSample;
-					int sourceOffsetInSample = hotStartTimeInSample - sourceStartTimeInSample;
-
-					/** Read Data */
-					this->readAudioData(buffer, bufferOffsetInSample,
-						sourceOffsetInSample, hotLengthInSample);
-					this->readMIDIData(midiMessages, sourceOffsetInSample,
-						hotStartTimeInSample, hotEndTimeInSample);
-				}
-			}
-		}
+		this->readSourceBlock(buffer, midiMessages, startTimeInSample);
 	}
 
 	/** Direct MIDI Messages */
-	for (auto& i : this->directMessages) {
-		midiMessages.addEvent(i, 0);
+	this->readDirectMessages(midiMessages, buffer.getNumSamples());
+
+	/** Close Notes Held Before This Block */
+	if (this->noteCloseFlag.exchange(false)) {
+		this->activeNotes.closeAllAhead(midiMessages, this->noteCloseTemp);
 	}
-	this->directMessages.clear();
 
 	/** Set Note State */
-	for (auto i : midiMessages) {
-		auto mes = i.getMessage();
-		if (mes.isNoteOn(!utils::regardVel0NoteAsNoteOff())) {
-			this->activeNoteSet.insert({ mes.getChannel(), mes.getNoteNumber() });
-		}
-		else if (mes.isNoteOff(utils::regardVel0NoteAsNoteOff())) {
-			this->activeNoteSet.erase({ mes.getChannel(), mes.getNoteNumber() });
+	this->activeNotes.update(midiMessages);
+
+	/** Process Instrument In Place, The Nested Graph Is Only Used When The Instrument Needs More Channels */
+	if (this->instr && !(this->instrOffline) && !(this->freezing)) {
+		int mainChannels = this->audioChannels.size();
+		if (!PluginDecorator::processNodeInPlace(
+			this->instr.get(), buffer, midiMessages, mainChannels, mainChannels)) {
+			this->juce::AudioProcessorGraph::processBlock(buffer, midiMessages);
 		}
 	}
 
-	/** Close Note */
-	if (this->noteCloseFlag) {
-		this->noteCloseFlag = false;
-
-		for (auto& i : this->activeNoteSet) {
-			midiMessages.addEvent(
-				juce::MidiMessage::noteOff(std::get<0>(i), std::get<1>(i)), 0);
-		}
+	/** Frozen Instrument Plays The Cache */
+	else if (this->frozen) {
+		this->readFreezeData(buffer, startTimeInSample);
 	}
 
-	/** Process Graph */
-	if (this->instr && !(this->instrOffline)) {
-		this->juce::AudioProcessorGraph::processBlock(buffer, midiMessages);
+	/** Silent Until The Freeze Render Is Done */
+	else if (this->freezing) {
+		vMath::zeroAllAudioData(buffer);
 	}
 
 	/** Process Mute */
@@ -715,11 +952,22 @@ void SeqSourceProcessor::processBlock(
 		vMath::zeroAllAudioData(buffer);
 	}
 
-	/** Update Level Meter */
-	for (int i = 0; i < buffer.getNumChannels() && i < this->outputLevels.size(); i++) {
-		this->outputLevels.getReference(i) =
-			buffer.getRMSLevel(i, 0, buffer.getNumSamples());
-	}
+	/** Update Level Meter, Nodes Run In Parallel And Only Write Their Own Levels */
+	this->outputMeter.process(buffer, this->getSampleRate());
+}
+
+void SeqSourceProcessor::readDirectMessages(juce::MidiBuffer& midiMessages, int numSamples) {
+	/** Messages Sent During The Last Block Keep Their Offsets In This Block */
+	double blockTimeMs = juce::Time::getMillisecondCounterHiRes();
+	double samplesPerMs = this->getSampleRate() / 1000;
+	double lastBlockTimeMs = this->lastDirectBlockTimeMs;
+	this->lastDirectBlockTimeMs = blockTimeMs;
+
+	this->directMessages.drain([&midiMessages, numSamples, samplesPerMs, lastBlockTimeMs](const DirectMessage& item) {
+		int offset = (item.timeMs - lastBlockTimeMs) * samplesPerMs;
+		offset = juce::jlimit(0, std::max(numSamples - 1, 0), offset);
+		midiMessages.addEvent(item.data.data(), item.size, offset);
+		});
 }
 
 double SeqSourceProcessor::getTailLengthSeconds() const {
@@ -727,6 +975,14 @@ double SeqSourceProcessor::getTailLengthSeconds() const {
 	return (size > 0) ? std::get<1>(this->srcs.getUnchecked(size - 1)) : 0;
 }
 
+int SeqSourceProcessor::getTransactionIndex() const {
+	return this->index;
+}
+
+void SeqSourceProcessor::transactionCommitted() {
+	this->rebuild();
+}
+
 void SeqSourceProcessor::clearGraph() {
 	this->setTrackName(juce::String{});
 	this->setTrackColor(juce::Colour{});
@@ -756,6 +1012,12 @@ bool SeqSourceProcessor::parse(
 		}
 	}
 	this->setInstrOffline(mes->offline());
+	if (mes->offline()) {
+		/** Play The Instrument If The Frozen Data Is Lost */
+		if (!this->loadFreezeData(config.freezeDir)) {
+			this->setInstrOffline(false);
+		}
+	}
 
 	if (!mes->audiosrc().empty()) {
 		this->applyAudio();
@@ -807,6 +1069,7 @@ std::unique_ptr<google::protobuf::Message> SeqSourceProcessor::serialize(
 		}
 	}
 	mes->set_offline(this->getInstrOffline());
+	this->saveFreezeData(config.freezeDir);
 
 	if (this->isAudioValid()) {
 		juce::String name = this->getAudioFileName();
@@ -829,6 +1092,158 @@ std::unique_ptr<google::protobuf::Message> SeqSourceProcessor::serialize(
 	return std::unique_ptr<google::protobuf::Message>(mes.release());
 }
 
+void SeqSourceProcessor::readSourceBlock(juce::AudioBuffer<float>& buffer,
+	juce::MidiBuffer& midiMessages, int startTimeInSample) const {
+	if (startTimeInSample < 0) { return; }
+
+	double sampleRate = this->getSampleRate();
+	double startTime = startTimeInSample / sampleRate;
+	double duration = buffer.getNumSamples() / sampleRate;
+	double endTime = startTime + duration;
+
+	int durationInSample = buffer.getNumSamples();
+	int endTimeInSample = startTimeInSample + durationInSample;
+
+	int sourceLengthInSample = std::floor(this->getSourceLength() * sampleRate);
+
+	/** Find Hot Block */
+	auto blocks = this->srcs.readBlocks();
+	auto index = this->srcs.match(*blocks, startTime, endTime);
+
+	/** Copy Source Data */
+	for (int i = std::get<0>(index);
+		i <= std::get<1>(index) && i < blocks->size() && i >= 0; i++) {
+		/** Get Block */
+		auto [blockStartTime, blockEndTime, sourceOffset] = blocks->getUnchecked(i);
+		int blockStartTimeInSample = std::floor(blockStartTime * sampleRate);
+		int blockEndTimeInSample = std::floor(blockEndTime * sampleRate);
+		int sourceOffsetInSample = std::floor(sourceOffset * sampleRate);
+
+		/** Caculate Time */
+		int sourceStartTimeInSample = sourceOffsetInSample;
+		int sourceEndTimeInSample = sourceStartTimeInSample + sourceLengthInSample;
+		int dataStartTimeInSample = std::max(blockStartTimeInSample, sourceStartTimeInSample);
+		int dataEndTimeInSample = std::min(blockEndTimeInSample, sourceEndTimeInSample);
+
+		if (dataEndTimeInSample > dataStartTimeInSample) {
+			int hotStartTimeInSample = std::max(startTimeInSample, dataStartTimeInSample);
+			int hotEndTimeInSample = std::min(endTimeInSample, dataEndTimeInSample);
+			int hotLengthInSample = hotEndTimeInSample - hotStartTimeInSample;
+
+			if (hotLengthInSample > 0) {
+				int bufferOffsetInSample = hotStartTimeInSample - startTimeInSample;
+				int sourceOffsetInSample = hotStartTimeInSample - sourceStartTimeInSample;
+
+				/** Read Data */
+				this->readAudioData(buffer, bufferOffsetInSample,
+					sourceOffsetInSample, hotLengthInSample);
+				this->readMIDIData(midiMessages, sourceOffsetInSample,
+					hotStartTimeInSample, hotEndTimeInSample);
+			}
+		}
+	}
+}
+
+void SeqSourceProcessor::readFreezeData(
+	juce::AudioBuffer<float>& buffer, int startTimeInSample) const {
+	vMath::zeroAllAudioData(buffer);
+	if (startTimeInSample < 0) { return; }
+
+	AudioSnapshot<FreezeCache>::Reader cache{ this->freezeCache };
+	auto data = cache->data.get();
+	if (!data) { return; }
+
+	int length = std::min(buffer.getNumSamples(), data->getNumSamples() - startTimeInSample);
+	if (length <= 0) { return; }
+
+	int channels = std::min(buffer.getNumChannels(), data->getNumChannels());
+	for (int i = 0; i < channels; i++) {
+		vMath::copyAudioData(buffer, *data, 0, startTimeInSample, i, i, length);
+	}
+}
+
+void SeqSourceProcessor::updateFreezeCache() {
+	auto cache = std::make_unique<FreezeCache>();
+
+	double sampleRate = this->getSampleRate();
+	if (this->freezeData && this->freezeSampleRate > 0 && sampleRate > 0) {
+		if (juce::approximatelyEqual(sampleRate, this->freezeSampleRate)) {
+			cache->data = this->freezeData;
+		}
+		else {
+			/** Resample To Device Sample Rate */
+			double ratio = this->freezeSampleRate / sampleRate;
+			int srcLength = this->freezeData->getNumSamples();
+			int length = std::ceil(srcLength / ratio);
+
+			auto data = std::make_shared<juce::AudioBuffer<float>>(
+				this->freezeData->getNumChannels(), length);
+			for (int i = 0; i < data->getNumChannels(); i++) {
+				juce::LagrangeInterpolator interpolator;
+				interpolator.process(ratio, this->freezeData->getReadPointer(i),
+					data->getWritePointer(i), length, srcLength, 0);
+			}
+			cache->data = data;
+		}
+	}
+
+	this->freezeCache.publish(std::move(cache));
+}
+
+void SeqSourceProcessor::clearFreezeData() {
+	this->frozen = false;
+	this->freezeData = nullptr;
+	this->freezeSampleRate = 0;
+	this->freezeCache.publish(std::make_unique<FreezeCache>());
+}
+
+bool SeqSourceProcessor::saveFreezeData(const juce::String& freezeDir) const {
+	if (freezeDir.isEmpty()) { return false; }
+
+	juce::File file = utils::getFreezeDataFile(freezeDir, this->index);
+	file.deleteFile();
+	if (!(this->frozen && this->freezeData)) { return true; }
+
+	/** Float Wave Keeps The Rendered Data Lossless */
+	file.getParentDirectory().createDirectory();
+	auto stream = file.createOutputStream();
+	if (!stream) { return false; }
+
+	juce::WavAudioFormat format;
+	std::unique_ptr<juce::AudioFormatWriter> writer{ format.createWriterFor(
+		stream.get(), this->freezeSampleRate, this->freezeData->getNumChannels(), 32, {}, 0) };
+	if (!writer) { return false; }
+	stream.release();
+
+	return writer->writeFromAudioSampleBuffer(
+		*(this->freezeData), 0, this->freezeData->getNumSamples());
+}
+
+bool SeqSourceProcessor::loadFreezeData(const juce::String& freezeDir) {
+	if (freezeDir.isEmpty()) { return false; }
+
+	/** Offline Without Freezing */
+	juce::File file = utils::getFreezeDataFile(freezeDir, this->index);
+	if (!file.existsAsFile()) { return true; }
+
+	juce::WavAudioFormat format;
+	std::unique_ptr<juce::AudioFormatReader> reader{
+		format.createReaderFor(file.createInputStream().release(), true) };
+	if (!reader) { return false; }
+
+	auto data = std::make_shared<juce::AudioBuffer<float>>(
+		this->audioChannels.size(), (int)reader->lengthInSamples);
+	data->clear();
+	if (!reader->read(data.get(), 0, data->getNumSamples(), 0, true, true)) { return false; }
+
+	this->freezeData = data;
+	this->freezeSampleRate = reader->sampleRate;
+	this->updateFreezeCache();
+	this->frozen = true;
+
+	return true;
+}
+
 void SeqSourceProcessor::readAudioData(
 	juce::AudioBuffer<float>& buffer, int bufferOffset,
 	int dataOffset, int length) const {
@@ -921,7 +1336,7 @@ void SeqSourceProcessor::writeAudioSource(int type,
 				(int)((overlapEndTime - overlapStartTime) * sampleRate) };
 			for (int j = 0; j < audioTemp.getNumChannels(); j++) {
 				vMath::copyAudioData(audioTemp, audioChannelTemp,
-					0, (int)(overlapStartTime * sampleRate), j, j, audioTemp.getNumChannels());
+					0, (int)(overlapStartTime * sampleRate), j, j, audioTemp.getNumSamples());
 			}
 
 			/** Add Data */
@@ -990,22 +1405,22 @@ void SeqSourceProcessor::linkInstr() {
 	if (auto ptrNode = this->instr) {
 		/** Unlink Main IO */
 		this->removeConnection({ { this->midiInputNode->nodeID, this->midiChannelIndex },
-			{ this->midiOutputNode->nodeID, this->midiChannelIndex } });
+			{ this->midiOutputNode->nodeID, this->midiChannelIndex } }, this->getUpdateKind());
 		for (int i = 0; i < this->audioChannels.size(); i++) {
 			this->removeConnection({ { this->audioInputNode->nodeID, i },
-				{ this->audioOutputNode->nodeID, i } });
+				{ this->audioOutputNode->nodeID, i } }, this->getUpdateKind());
 		}
 
 		/** Link Instr IO */
 		this->addConnection({ { this->midiInputNode->nodeID, this->midiChannelIndex },
-			{ ptrNode->nodeID, this->midiChannelIndex } });
+			{ ptrNode->nodeID, this->midiChannelIndex } }, this->getUpdateKind());
 		this->addConnection({ { ptrNode->nodeID, this->midiChannelIndex },
-			{ this->midiOutputNode->nodeID, this->midiChannelIndex } });
+			{ this->midiOutputNode->nodeID, this->midiChannelIndex } }, this->getUpdateKind());
 		for (int i = 0; i < this->audioChannels.size(); i++) {
 			this->addConnection({ { this->audioInputNode->nodeID, i },
-				{ ptrNode->nodeID, i } });
+				{ ptrNode->nodeID, i } }, this->getUpdateKind());
 			this->addConnection({ { ptrNode->nodeID, i },
-				{ this->audioOutputNode->nodeID, i } });
+				{ this->audioOutputNode->nodeID, i } }, this->getUpdateKind());
 		}
 	}
 }
@@ -1014,22 +1429,22 @@ void SeqSourceProcessor::unlinkInstr() {
 	if (auto ptrNode = this->instr) {
 		/** Unlink Instr IO */
 		this->removeConnection({ { this->midiInputNode->nodeID, this->midiChannelIndex },
-			{ ptrNode->nodeID, this->midiChannelIndex } });
+			{ ptrNode->nodeID, this->midiChannelIndex } }, this->getUpdateKind());
 		this->removeConnection({ { ptrNode->nodeID, this->midiChannelIndex },
-			{ this->midiOutputNode->nodeID, this->midiChannelIndex } });
+			{ this->midiOutputNode->nodeID, this->midiChannelIndex } }, this->getUpdateKind());
 		for (int i = 0; i < this->audioChannels.size(); i++) {
 			this->removeConnection({ { this->audioInputNode->nodeID, i },
-				{ ptrNode->nodeID, i } });
+				{ ptrNode->nodeID, i } }, this->getUpdateKind());
 			this->removeConnection({ { ptrNode->nodeID, i },
-				{ this->audioOutputNode->nodeID, i } });
+				{ this->audioOutputNode->nodeID, i } }, this->getUpdateKind());
 		}
 
 		/** Link Main IO */
 		this->addConnection({ { this->midiInputNode->nodeID, this->midiChannelIndex },
-			{ this->midiOutputNode->nodeID, this->midiChannelIndex } });
+			{ this->midiOutputNode->nodeID, this->midiChannelIndex } }, this->getUpdateKind());
 		for (int i = 0; i < this->audioChannels.size(); i++) {
 			this->addConnection({ { this->audioInputNode->nodeID, i },
-				{ this->audioOutputNode->nodeID, i } });
+				{ this->audioOutputNode->nodeID, i } }, this->getUpdateKind());
 		}
 	}
 }
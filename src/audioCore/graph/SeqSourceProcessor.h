@@ -4,9 +4,16 @@
 
 #include "SourceList.h"
 #include "PluginDecorator.h"
+#include "GraphTransaction.h"
+#include "../misc/AudioSnapshot.h"
+#include "../misc/ActiveNoteTable.h"
+#include "../misc/RealtimeMPSCFifo.h"
+#include "../misc/LevelMeter.h"
+#include "../misc/NodeProfiler.h"
 #include "../project/Serializable.h"
 
 class SeqSourceProcessor final : public juce::AudioProcessorGraph,
+	public GraphTransaction,
 	public Serializable {
 public:
 	SeqSourceProcessor() = delete;
@@ -44,6 +51,20 @@ public:
 	void setInstrOffline(bool offline);
 	bool getInstrOffline() const;
 
+	/**
+	 * @brief	Render the source through the instrument into a cache on a background thread,
+	 *			then play the cache with the instrument offline.
+	 * @attention	The track is silent until the render is done. Returns false if the render can't start.
+	 */
+	bool freeze();
+	void unfreeze();
+	bool getFrozen() const;
+	bool isFreezing() const;
+	/**
+	 * @brief	Cancel a running freeze render before the instrument is prepared, loaded or replaced.
+	 */
+	void cancelFreezeRender();
+
 	uint64_t getAudioRef() const;
 	uint64_t getMIDIRef() const;
 
@@ -89,6 +110,9 @@ public:
 	bool getInputMonitoring() const;
 
 	const juce::Array<float> getOutputLevels() const;
+	const juce::Array<float> getOutputPeakLevels() const;
+	const juce::Array<float> getOutputTruePeakLevels() const;
+	const NodeProfiler::Usage getCPUUsage() const;
 
 	using ChannelLink = std::tuple<int, int>;
 	using ChannelLinkList = juce::Array<ChannelLink>;
@@ -98,7 +122,18 @@ public:
 		const juce::MidiMessageSequence& midiData, const juce::AudioSampleBuffer& audioData,
 		const ChannelLinkList& audioLinks);
 
+	/**
+	 * @brief	Play a message on this track from any thread without locking.
+	 * @attention	Time is in juce::Time::getMillisecondCounterHiRes() milliseconds. Messages keep their relative timing
+	 *			and are played one block later.
+	 */
 	void sendDirectMidiMessages(const juce::MidiMessage& message);
+	void sendDirectMidiMessages(const juce::MidiMessage& message, double timeMs);
+	/**
+	 * @brief	Whether direct messages were sent within directMidiLiveTime. The track is played live meanwhile.
+	 */
+	bool isDirectMidiActive() const;
+	static constexpr double directMidiLiveTime = 10000;
 
 public:
 	void prepareToPlay(double sampleRate, int maximumExpectedSamplesPerBlock) override;
@@ -143,14 +178,32 @@ private:
 	const juce::AudioChannelSet audioChannels;
 
 	SourceList srcs;
-	std::set<std::tuple<int, int>> activeNoteSet;
+	ActiveNoteTable activeNotes;
 	std::atomic_bool noteCloseFlag = false;
+	juce::MidiBuffer noteCloseTemp;
 
 	juce::AudioProcessorGraph::Node::Ptr audioInputNode, audioOutputNode;
 	juce::AudioProcessorGraph::Node::Ptr midiInputNode, midiOutputNode;
 	juce::AudioProcessorGraph::Node::Ptr instr = nullptr;
 	std::atomic_bool instrOffline = false;
 
+	/** Frozen Instrument Output At Render Sample Rate, Published To The Audio Thread At Device Sample Rate */
+	struct FreezeCache final {
+		std::shared_ptr<const juce::AudioBuffer<float>> data;
+	};
+	std::atomic_bool frozen = false;
+	std::shared_ptr<const juce::AudioBuffer<float>> freezeData;
+	double freezeSampleRate = 0;
+	AudioSnapshot<FreezeCache> freezeCache;
+	static constexpr double freezeTailLimit = 10;
+
+	/** Freezing Instrument Is Kept Away From The Audio Thread */
+	std::atomic_bool freezing = false;
+	int freezeGeneration = 0;
+	juce::MemoryBlock freezeState;
+	std::unique_ptr<juce::Thread> freezeThread = nullptr;
+	friend class FreezeThread;
+
 	juce::String trackName;
 	juce::Colour trackColor;
 
@@ -162,9 +215,20 @@ private:
 	std::atomic_bool isMute = false;
 	std::atomic_bool inputMonitoring = false;
 
-	juce::Array<float> outputLevels;
+	LevelMeter outputMeter;
+	NodeProfiler profiler;
+
+	struct DirectMessage final {
+		std::array<uint8_t, 16> data{};
+		int size = 0;
+		double timeMs = 0;
+	};
+	RealtimeMPSCFifo<DirectMessage, 512> directMessages;
+	double lastDirectBlockTimeMs = 0;
+	std::atomic<double> lastDirectMessageTimeMs = 0;
 
-	juce::Array<juce::MidiMessage> directMessages;
+	void readDirectMessages(juce::MidiBuffer& midiMessages, int numSamples);
+	int64_t getCurrentPositionInSamples() const;
 
 	struct SourceInfo final {
 		double audioSampleRate = 0;
@@ -179,6 +243,20 @@ private:
 	void readMIDIData(juce::MidiBuffer& buffer, int baseTime,
 		int startTime, int endTime) const;
 
+	void readSourceBlock(juce::AudioBuffer<float>& buffer,
+		juce::MidiBuffer& midiMessages, int startTimeInSample) const;
+	void readFreezeData(juce::AudioBuffer<float>& buffer, int startTimeInSample) const;
+
+	void finishFreeze(int generation,
+		std::shared_ptr<const juce::AudioBuffer<float>> data, double sampleRate);
+	void cancelFreeze();
+	void restoreFreezeInstr();
+
+	void updateFreezeCache();
+	void clearFreezeData();
+	bool saveFreezeData(const juce::String& freezeDir) const;
+	bool loadFreezeData(const juce::String& freezeDir);
+
 	void writeMIDISource(int type,
 		double startTime, double currentTime, double sampleRate,
 		const juce::MidiMessageSequence& midiData);
@@ -186,6 +264,9 @@ private:
 		double startTime, double currentTime, double sampleRate,
 		const juce::AudioSampleBuffer& audioData, const ChannelLinkList& audioLinks);
 
+	int getTransactionIndex() const override;
+	void transactionCommitted() override;
+
 	void initAudio(double sampleRate, double length);
 	void initMIDI();
 
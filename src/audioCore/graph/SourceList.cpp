@@ -1,5 +1,4 @@
 ﻿#include "SourceList.h"
-#include "../misc/AudioLock.h"
 #include "../uiCallback/UICallback.h"
 #include <VSP4.h>
 using namespace org::vocalsharp::vocalshaper;
@@ -8,30 +7,34 @@ void SourceList::updateIndex(int index) {
 	this->index = index;
 }
 
-std::tuple<int, int> SourceList::match(double startTime, double endTime) const {
+SourceList::BlockReader SourceList::readBlocks() const {
+	return BlockReader{ this->blocks };
+}
+
+std::tuple<int, int> SourceList::match(const BlockList& list, double startTime, double endTime) const {
 	/** Empty */
-	if (this->list.isEmpty()) { return { -1, -1 }; }
+	if (list.isEmpty()) { return { -1, -1 }; }
 
 	/** Search Range */
-	int sLow = 0, sHigh = this->list.size() - 1;
+	int sLow = 0, sHigh = list.size() - 1;
 
 	/** Result Var */
 	int start = this->lastIndex;
 
 	do {
 		/** Try To Use Last Index */
-		if (this->lastIndex >= 0 && this->lastIndex < this->list.size()) {
+		if (this->lastIndex >= 0 && this->lastIndex < list.size()) {
 			/** Try Last Index */
-			auto& lastSeq = this->list.getReference(this->lastIndex);
+			auto& lastSeq = list.getReference(this->lastIndex);
 			if (std::get<0>(lastSeq) <= startTime && std::get<1>(lastSeq) > endTime) {
 				/** Last Index Match */
 				break;
 			}
 			else if (std::get<1>(lastSeq) <= startTime) {
 				/** After Last Index */
-				if (this->lastIndex < this->list.size() - 1) {
+				if (this->lastIndex < list.size() - 1) {
 					/** Try Next Index */
-					auto& nextSeq = this->list.getReference(this->lastIndex + 1);
+					auto& nextSeq = list.getReference(this->lastIndex + 1);
 					if (std::get<1>(lastSeq) <= startTime && std::get<1>(nextSeq) > startTime) {
 						/** Next Index Match */
 						start = this->lastIndex + 1;
@@ -54,7 +57,7 @@ std::tuple<int, int> SourceList::match(double startTime, double endTime) const {
 		}
 
 		/** Binary Search */
-		start = this->binarySearchStart(sLow, sHigh, startTime);
+		start = SourceList::binarySearchStart(list, sLow, sHigh, startTime);
 		if (start > -1) {
 			break;
 		}
@@ -64,7 +67,7 @@ std::tuple<int, int> SourceList::match(double startTime, double endTime) const {
 	} while (false);
 	
 	/** Found Result */
-	int end = this->seqSearchEnd(start, this->list.size() - 1, endTime);
+	int end = SourceList::seqSearchEnd(list, start, list.size() - 1, endTime);
 
 	if (end <= -1) { return { -1, -1 }; }
 	return { start, this->lastIndex = end };
@@ -87,12 +90,23 @@ int SourceList::size() const {
 }
 
 int SourceList::add(const SourceList::SeqBlock& block) {
-	/** Get Lock */
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
+	int index = this->addInternal(block);
+	if (index > -1) {
+		this->publishBlocks();
+	}
+	return index;
+}
 
+void SourceList::remove(int index) {
+	if (this->removeInternal(index)) {
+		this->publishBlocks();
+	}
+}
+
+int SourceList::addInternal(const SeqBlock& block) {
 	/** Get Insert Place */
 	int index = this->list.isEmpty()
-		? 0 : this->binarySearchInsert(0, this->list.size() - 1, std::get<0>(block));
+		? 0 : SourceList::binarySearchInsert(this->list, 0, this->list.size() - 1, std::get<0>(block));
 	if (index < 0) { jassertfalse; return -1; }
 
 	/** Check Overlap */
@@ -115,20 +129,21 @@ int SourceList::add(const SourceList::SeqBlock& block) {
 	return index;
 }
 
-void SourceList::remove(int index) {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
+bool SourceList::removeInternal(int index) {
 	if (index >= 0 && index < this->list.size()) {
 		this->list.remove(index);
 
 		/** Callback */
 		UICallbackAPI<int, int>::invoke(
 			UICallbackType::SeqBlockChanged, this->index, index);
+
+		return true;
 	}
+
+	return false;
 }
 
 bool SourceList::split(int index, double time) {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
-
 	if (index >= 0 && index < this->list.size()) {
 		auto [startTime, endTime, offset] = this->list.getUnchecked(index);
 		if (startTime < time && time < endTime) {
@@ -136,6 +151,7 @@ bool SourceList::split(int index, double time) {
 
 			this->list.insert(index, { startTime, time, offset });
 			this->list.insert(index + 1, { time, endTime, offset });
+			this->publishBlocks();
 
 			/** Callback */
 			UICallbackAPI<int, int>::invoke(
@@ -151,8 +167,6 @@ bool SourceList::split(int index, double time) {
 }
 
 bool SourceList::stickWithNext(int index) {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
-
 	if (index >= 0 && index < this->list.size() - 1) {
 		auto [startTimeFirst, endTimeFirst, offsetFirst] = this->list.getUnchecked(index);
 		auto [startTimeSecond, endTimeSecond, offsetSecond] = this->list.getUnchecked(index + 1);
@@ -162,6 +176,7 @@ bool SourceList::stickWithNext(int index) {
 			this->list.remove(index);
 
 			this->list.insert(index, { startTimeFirst, endTimeSecond, offsetFirst });
+			this->publishBlocks();
 
 			/** Callback */
 			UICallbackAPI<int, int>::invoke(
@@ -177,17 +192,19 @@ bool SourceList::stickWithNext(int index) {
 }
 
 int SourceList::resetTime(int index, const SeqBlock& block) {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
-
 	if (index < 0 || index >= this->list.size()) { return -1; }
-	this->remove(index);
-	return this->add(block);
+
+	/** Publish Once To Avoid Audio Thread Seeing The Removed State */
+	this->removeInternal(index);
+	int newIndex = this->addInternal(block);
+	this->publishBlocks();
+
+	return newIndex;
 }
 
 void SourceList::clearGraph() {
-	juce::ScopedWriteLock locker(audioLock::getAudioLock());
 	this->list.clear();
-	this->lastIndex = -1;
+	this->publishBlocks();
 
 	/** Callback */
 	UICallbackAPI<int, int>::invoke(
@@ -224,11 +241,15 @@ std::unique_ptr<google::protobuf::Message> SourceList::serialize(
 	return std::unique_ptr<google::protobuf::Message>(mes.release());
 }
 
-int SourceList::binarySearchInsert(int low, int high, double t) const {
+void SourceList::publishBlocks() {
+	this->blocks.publish(std::make_unique<BlockList>(this->list));
+}
+
+int SourceList::binarySearchInsert(const BlockList& list, int low, int high, double t) {
 	while (low <= high) {
 		int mid = low + (high - low) / 2;
 
-		auto& current = this->list.getReference(mid);
+		auto& current = list.getReference(mid);
 		if (mid == low) {
 			if (t < std::get<0>(current)) {
 				return 0;
@@ -240,7 +261,7 @@ int SourceList::binarySearchInsert(int low, int high, double t) const {
 			}
 		}
 
-		auto& next = this->list.getReference(mid + 1);
+		auto& next = list.getReference(mid + 1);
 		if (t >= std::get<0>(current) && t < std::get<0>(next)) {
 			return mid + 1;
 		}
@@ -257,11 +278,11 @@ int SourceList::binarySearchInsert(int low, int high, double t) const {
 	return -1;
 }
 
-int SourceList::binarySearchStart(int low, int high, double t) const {
+int SourceList::binarySearchStart(const BlockList& list, int low, int high, double t) {
 	while (low <= high) {
 		int mid = low + (high - low) / 2;
 
-		auto& current = this->list.getReference(mid);
+		auto& current = list.getReference(mid);
 		if (mid == low) {
 			if (t < std::get<1>(current)) {
 				return low;
@@ -276,7 +297,7 @@ int SourceList::binarySearchStart(int low, int high, double t) const {
 			}
 		}
 
-		auto& next = this->list.getReference(mid + 1);
+		auto& next = list.getReference(mid + 1);
 		if (t >= std::get<0>(current) && t < std::get<0>(next)) {
 			return mid + 1;
 		}
@@ -293,9 +314,9 @@ int SourceList::binarySearchStart(int low, int high, double t) const {
 	return -1;
 }
 
-int SourceList::seqSearchEnd(int low, int high, double t) const {
+int SourceList::seqSearchEnd(const BlockList& list, int low, int high, double t) {
 	for (int i = low; i <= high; i++) {
-		auto& current = this->list.getReference(i);
+		auto& current = list.getReference(i);
 
 		if (i == low && t < std::get<0>(current)) {
 			return -1;
@@ -304,7 +325,7 @@ int SourceList::seqSearchEnd(int low, int high, double t) const {
 			return i;
 		}
 
-		auto& next = this->list.getReference(i + 1);
+		auto& next = list.getReference(i + 1);
 		if (t >= std::get<0>(current) && t < std::get<0>(next)) {
 			return i;
 		}
@@ -2,6 +2,7 @@
 
 #include <JuceHeader.h>
 #include "../project/Serializable.h"
+#include "../misc/AudioSnapshot.h"
 
 class SourceList final : public Serializable {
 public:
@@ -14,21 +15,27 @@ public:
 	 */
 	using SeqBlock = std::tuple<
 		double, double, double>;
+	using BlockList = juce::Array<SeqBlock>;
+	using BlockReader = AudioSnapshot<BlockList>::Reader;
 
 	/**
-	 * @attention Call this only on audio thread. Get the lock before use this method.
+	 * @attention Call this only on audio thread. Keep the reader alive while using the blocks.
 	 */
-	std::tuple<int, int> match(double startTime, double endTime) const;
+	BlockReader readBlocks() const;
 	/**
-	 * @attention Get the lock before use this method.
+	 * @attention Call this only on audio thread.
+	 */
+	std::tuple<int, int> match(const BlockList& blocks, double startTime, double endTime) const;
+	/**
+	 * @attention Call this only on message thread.
 	 */
 	const SeqBlock get(int index) const;
 	/**
-	 * @attention Get the lock before use this method.
+	 * @attention Call this only on message thread.
 	 */
 	const SeqBlock getUnchecked(int index) const;
 	/**
-	 * @attention Get the lock before use this method.
+	 * @attention Call this only on message thread.
 	 */
 	const SeqBlock& getReference(int index) const;
 	int size() const;
@@ -52,12 +59,17 @@ public:
 private:
 	int index = -1;
 
-	juce::Array<SeqBlock, juce::CriticalSection> list;
+	BlockList list;
+	AudioSnapshot<BlockList> blocks;
 	mutable int lastIndex = -1;
 
-	int binarySearchInsert(int low, int high, double t) const;
-	int binarySearchStart(int low, int high, double t) const;
-	int seqSearchEnd(int low, int high, double t) const;
+	int addInternal(const SeqBlock& block);
+	bool removeInternal(int index);
+	void publishBlocks();
+
+	static int binarySearchInsert(const BlockList& list, int low, int high, double t);
+	static int binarySearchStart(const BlockList& list, int low, int high, double t);
+	static int seqSearchEnd(const BlockList& list, int low, int high, double t);
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SourceList)
 };
@@ -18,6 +18,8 @@ void SourceRecordProcessor::prepareToPlay(
 
 void SourceRecordProcessor::processBlock(
 	juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) {
+	NodeProfiler::Scope profilerScope(this->profiler, buffer.getNumSamples(), this->getSampleRate());
+
 	/** Check Play State */
 	auto playHead = this->getPlayHead();
 	if (!playHead) { return; }
@@ -45,6 +47,10 @@ double SourceRecordProcessor::getTailLengthSeconds() const {
 	return 0;
 }
 
+const NodeProfiler::Usage SourceRecordProcessor::getCPUUsage() const {
+	return this->profiler.getUsage();
+}
+
 void SourceRecordProcessor::numChannelsChanged() {
 	RecordTemp::getInstance()->setInputChannelNum(this->getTotalNumInputChannels());
 }
@@ -4,6 +4,7 @@
 
 #include "../project/Serializable.h"
 #include "../uiCallback/LimitedCall.h"
+#include "../misc/NodeProfiler.h"
 
 class MainGraph;
 
@@ -36,6 +37,8 @@ public:
 
 	double getTailLengthSeconds() const override;
 
+	const NodeProfiler::Usage getCPUUsage() const;
+
 	class SafePointer {
 	private:
 		juce::WeakReference<SourceRecordProcessor> weakRef;
@@ -60,6 +63,7 @@ public:
 private:
 	MainGraph* const parent;
 	LimitedCall limitedCall;
+	NodeProfiler profiler;
 
 	void numChannelsChanged() override;
 
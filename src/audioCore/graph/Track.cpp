@@ -10,6 +10,11 @@ using namespace org::vocalsharp::vocalshaper;
 
 Track::Track(const juce::AudioChannelSet& type)
 	: audioChannels(type) {
+	/** Pan Sides */
+	for (int i = 0; i < type.size() && i < Track::maxChannels; i++) {
+		this->panSides[i] = Track::getPanSide(type.getTypeOfChannel(i));
+	}
+
 	/** Set Effects */
 	this->setGain(0);
 	this->setPan(0);
@@ -68,7 +73,7 @@ Track::Track(const juce::AudioChannelSet& type)
 		{ {this->midiInputNode->nodeID, this->midiChannelIndex}, {this->midiOutputNode->nodeID, this->midiChannelIndex} });
 
 	/** Set Level Size */
-	this->outputLevels.resize(mainBusOutputChannels);
+	this->outputMeter.setChannelNum(mainBusOutputChannels);
 
 	/** Default Color */
 	this->trackColor = utils::getDefaultColour();
@@ -78,7 +83,7 @@ void Track::updateIndex(int index) {
 	this->index = index;
 
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, index);
+	this->invokeCallback(UICallbackType::TrackChanged, index);
 }
 
 bool Track::addAdditionalAudioBus() {
@@ -115,13 +120,13 @@ bool Track::addAdditionalAudioBus() {
 	/** Connect Bus To Plugin Dock */
 	for (int i = oldNum; i < newNum; i++) {
 		this->addConnection({ {this->audioInputNode->nodeID, i},
-			{this->pluginDockNode->nodeID, i} });
+			{this->pluginDockNode->nodeID, i} }, this->getUpdateKind());
 		this->addConnection({ {this->pluginDockNode->nodeID, i},
-			{this->audioOutputNode->nodeID, i} });
+			{this->audioOutputNode->nodeID, i} }, this->getUpdateKind());
 	}
 
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, this->index);
+	this->invokeCallback(UICallbackType::TrackChanged, this->index);
 
 	return true;
 }
@@ -157,10 +162,10 @@ bool Track::removeAdditionalAudioBus() {
 	}
 
 	/** Auto Remove Connection */
-	this->removeIllegalConnections();
+	this->removeIllegalConnections(this->getUpdateKind());
 
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, this->index);
+	this->invokeCallback(UICallbackType::TrackChanged, this->index);
 
 	return true;
 }
@@ -174,7 +179,7 @@ void Track::setMute(bool mute) {
 	this->isMute = mute;
 
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackMuteChanged, this->index);
+	this->invokeCallback(UICallbackType::TrackMuteChanged, this->index);
 }
 
 bool Track::getMute() const {
@@ -182,27 +187,22 @@ bool Track::getMute() const {
 }
 
 void Track::setGain(float gain) {
-	auto& gainDsp = this->gainAndPanner.get<0>();
-	gainDsp.setGainDecibels(gain);
+	this->gainValue = gain;
 
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackGainChanged, this->index);
+	this->invokeCallback(UICallbackType::TrackGainChanged, this->index);
 }
 
 float Track::getGain() const {
-	auto& gainDsp = this->gainAndPanner.get<0>();
-	return gainDsp.getGainDecibels();
+	return this->gainValue;
 }
 
 void Track::setPan(float pan) {
 	pan = juce::jlimit(-1.0f, 1.0f, pan);
 	this->panValue = pan;
 
-	auto& panDsp = this->gainAndPanner.get<1>();
-	panDsp.setPan(pan);
-
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackPanChanged, this->index);
+	this->invokeCallback(UICallbackType::TrackPanChanged, this->index);
 }
 
 float Track::getPan() const {
@@ -210,23 +210,51 @@ float Track::getPan() const {
 }
 
 void Track::setSlider(float slider) {
-	auto& sliderDsp = this->slider.get<0>();
-	sliderDsp.setGainLinear(slider);
+	this->sliderValue = slider;
 
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackFaderChanged, this->index);
+	this->invokeCallback(UICallbackType::TrackFaderChanged, this->index);
 }
 
 float Track::getSlider() const {
-	auto& sliderDsp = this->slider.get<0>();
-	return sliderDsp.getGainLinear();
+	return this->sliderValue;
+}
+
+int Track::addAutomationPoint(AutomationType type, double time, float value) {
+	if (type < AutomationType::Gain || type >= AutomationType::TypeNum) { return -1; }
+	if (type == AutomationType::Pan) { value = juce::jlimit(-1.0f, 1.0f, value); }
+
+	/** Edit A Copy, The Audio Thread Keeps Reading The Old Lanes */
+	auto automation = std::make_unique<TrackAutomation>(this->automation.getLatest());
+	int index = automation->lanes[(int)type].addPoint(time, value);
+	this->automation.publish(std::move(automation));
+
+	return index;
+}
+
+void Track::removeAutomationPoint(AutomationType type, int index) {
+	if (type < AutomationType::Gain || type >= AutomationType::TypeNum) { return; }
+
+	auto automation = std::make_unique<TrackAutomation>(this->automation.getLatest());
+	automation->lanes[(int)type].removePoint(index);
+	this->automation.publish(std::move(automation));
+}
+
+int Track::getAutomationPointNum(AutomationType type) const {
+	if (type < AutomationType::Gain || type >= AutomationType::TypeNum) { return 0; }
+	return this->automation.getLatest().lanes[(int)type].getPointNum();
+}
+
+const AutomationLane::Point Track::getAutomationPoint(AutomationType type, int index) const {
+	if (type < AutomationType::Gain || type >= AutomationType::TypeNum) { return {}; }
+	return this->automation.getLatest().lanes[(int)type].getPoint(index);
 }
 
 void Track::setTrackName(const juce::String& name) {
 	this->trackName = name;
 
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, this->index);
+	this->invokeCallback(UICallbackType::TrackChanged, this->index);
 }
 
 const juce::String Track::getTrackName() const {
@@ -237,7 +265,7 @@ void Track::setTrackColor(const juce::Colour& color) {
 	this->trackColor = color;
 
 	/** Callback */
-	UICallbackAPI<int>::invoke(UICallbackType::TrackChanged, this->index);
+	this->invokeCallback(UICallbackType::TrackChanged, this->index);
 }
 
 const juce::Colour Track::getTrackColor() const {
@@ -257,19 +285,13 @@ void Track::prepareToPlay(double sampleRate, int maximumExpectedSamplesPerBlock)
 		return;
 	}
 
-	if (this->audioChannels.size() > 0) {
-		/** Prepare Gain And Panner */
-		this->gainAndPanner.prepare(juce::dsp::ProcessSpec(
-			sampleRate, maximumExpectedSamplesPerBlock,
-			this->audioChannels.size()
-		));
-
-		/** Prepare Slider */
-		this->slider.prepare(juce::dsp::ProcessSpec(
-			sampleRate, maximumExpectedSamplesPerBlock,
-			this->audioChannels.size()
-		));
-	}
+	/** Start From The Current Gains Without Ramping */
+	int mainChannels = std::min(this->audioChannels.size(), Track::maxChannels);
+	std::array<float, Track::maxChannels> gains{};
+	this->getPreGains(gains, mainChannels, false, false);
+	this->preGains.reset(gains);
+	this->getPostGains(gains, mainChannels, false);
+	this->postGains.reset(gains);
 
 	/** Prepare Current Graph */
 	this->AudioProcessorGraph::prepareToPlay(sampleRate, maximumExpectedSamplesPerBlock);
@@ -284,6 +306,26 @@ void Track::setPlayHead(juce::AudioPlayHead* newPlayHead) {
 	}
 }
 
+int Track::getTransactionIndex() const {
+	return this->index;
+}
+
+void Track::transactionBegan() {
+	if (auto pluginDock = this->getPluginDock()) {
+		pluginDock->beginTransaction();
+	}
+}
+
+void Track::transactionCommitted() {
+	if (auto pluginDock = this->getPluginDock()) {
+		if (pluginDock->isInTransaction()) {
+			pluginDock->commitTransaction();
+		}
+	}
+
+	this->rebuild();
+}
+
 void Track::clearGraph() {
 	auto plugins = dynamic_cast<PluginDock*>(this->pluginDockNode->getProcessor());
 	if (plugins) {
@@ -300,11 +342,23 @@ void Track::clearGraph() {
 	this->setGain(0);
 	this->setPan(0);
 	this->setSlider(1);
+	this->automation.publish(std::make_unique<TrackAutomation>());
 }
 
 const juce::Array<float> Track::getOutputLevels() const {
-	juce::ScopedReadLock locker(audioLock::getLevelMeterLock());
-	return this->outputLevels;
+	return this->outputMeter.getRMSLevels();
+}
+
+const juce::Array<float> Track::getOutputPeakLevels() const {
+	return this->outputMeter.getPeakLevels();
+}
+
+const juce::Array<float> Track::getOutputTruePeakLevels() const {
+	return this->outputMeter.getTruePeakLevels();
+}
+
+const NodeProfiler::Usage Track::getCPUUsage() const {
+	return this->profiler.getUsage();
 }
 
 bool Track::parse(
@@ -335,6 +389,8 @@ bool Track::parse(
 	this->setPan(mes->panner());
 	this->setSlider(mes->slider());
 
+	this->loadAutomationData(config.automationDir);
+
 	return true;
 }
 
@@ -357,9 +413,88 @@ std::unique_ptr<google::protobuf::Message> Track::serialize(
 	mes->set_panner(this->getPan());
 	mes->set_slider(this->getSlider());
 
+	this->saveAutomationData(config.automationDir);
+
 	return std::unique_ptr<google::protobuf::Message>(mes.release());
 }
 
+constexpr std::array<const char*, (int)Track::AutomationType::TypeNum> automationTypeNameList{
+	"gain", "pan", "slider" };
+
+const juce::var Track::getAutomationData() const {
+	auto& automation = this->automation.getLatest();
+
+	juce::DynamicObject::Ptr result = new juce::DynamicObject;
+	bool automated = false;
+	for (int i = 0; i < automation.lanes.size(); i++) {
+		if (!automation.lanes[i].isEmpty()) {
+			result->setProperty(automationTypeNameList[i], automation.lanes[i].toVar());
+			automated = true;
+		}
+	}
+
+	juce::Array<juce::var> effects;
+	if (auto pluginDock = this->getPluginDock()) {
+		for (int i = 0; i < pluginDock->getPluginNum(); i++) {
+			auto effect = pluginDock->getPluginProcessor(i);
+			auto data = effect ? effect->getAutomationData() : juce::var{};
+			automated |= !data.isVoid();
+			effects.add(data);
+		}
+	}
+	result->setProperty("effects", effects);
+
+	return automated ? juce::var{ result.get() } : juce::var{};
+}
+
+void Track::setAutomationData(const juce::var& data) {
+	auto automation = std::make_unique<TrackAutomation>();
+	for (int i = 0; i < automation->lanes.size(); i++) {
+		automation->lanes[i].fromVar(data.getProperty(automationTypeNameList[i], {}));
+	}
+	this->automation.publish(std::move(automation));
+
+	if (auto effects = data.getProperty("effects", {}).getArray()) {
+		if (auto pluginDock = this->getPluginDock()) {
+			for (int i = 0; i < effects->size() && i < pluginDock->getPluginNum(); i++) {
+				if (auto effect = pluginDock->getPluginProcessor(i)) {
+					effect->setAutomationData(effects->getReference(i));
+				}
+			}
+		}
+	}
+}
+
+bool Track::saveAutomationData(const juce::String& automationDir) const {
+	if (automationDir.isEmpty()) { return false; }
+
+	juce::File file = utils::getAutomationDataFile(automationDir, this->index);
+	file.deleteFile();
+
+	auto data = this->getAutomationData();
+	if (data.isVoid()) { return true; }
+
+	file.getParentDirectory().createDirectory();
+	juce::FileOutputStream stream(file);
+	if (!stream.openedOk()) { return false; }
+
+	juce::JSON::writeToStream(stream, data, true);
+	return true;
+}
+
+bool Track::loadAutomationData(const juce::String& automationDir) {
+	if (automationDir.isEmpty()) { return false; }
+
+	juce::File file = utils::getAutomationDataFile(automationDir, this->index);
+	if (!file.existsAsFile()) { return false; }
+
+	auto data = juce::JSON::parse(file);
+	if (!data.isObject()) { return false; }
+
+	this->setAutomationData(data);
+	return true;
+}
+
 bool Track::canAddBus(bool isInput) const {
 	return isInput;
 }
@@ -372,30 +507,55 @@ void Track::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& mid
 	/** Check Buffer Is Empty */
 	if (buffer.getNumChannels() <= 0) { return; }
 	if (buffer.getNumSamples() <= 0) { return; }
+
+	/** Profile Including Plugins */
+	NodeProfiler::Scope profilerScope(this->profiler, buffer.getNumSamples(), this->getSampleRate());
+
+	/** Automation Is Only Read While Playing */
+	int mainChannels = std::min({ this->audioChannels.size(), buffer.getNumChannels(), Track::maxChannels });
+	AudioSnapshot<TrackAutomation>::Reader automation{ this->automation };
+	auto& gainLane = automation->lanes[(int)AutomationType::Gain];
+	auto& panLane = automation->lanes[(int)AutomationType::Pan];
+	auto& sliderLane = automation->lanes[(int)AutomationType::Slider];
+	bool playing = false;
+	double blockTime = 0;
+	if (auto playHead = this->getPlayHead()) {
+		if (auto pos = playHead->getPosition()) {
+			playing = pos->getIsPlaying();
+			blockTime = pos->getTimeInSeconds().orFallback(0);
+		}
+	}
+	
+	bool gainAutomated = playing && !gainLane.isEmpty();
+	bool panAutomated = playing && !panLane.isEmpty();
+	bool sliderAutomated = playing && !sliderLane.isEmpty();
+	std::array<float, Track::maxChannels> gains;
 	
 	/** Process Gain And Panner */
-	int mainChannels = this->audioChannels.size();
-	auto block = juce::dsp::AudioBlock<float>(buffer).getSubsetChannelBlock(
-		0, mainChannels);
-	this->gainAndPanner.process(juce::dsp::ProcessContextReplacing<float>(block));
-
-	/** Process Current Graph */
-	this->AudioProcessorGraph::processBlock(buffer, midiMessages);
-
-	/** Process Mute */
-	if (this->isMute) {
-		block.fill(0);
+	this->getPreGains(gains, mainChannels, gainAutomated, panAutomated);
+	Track::processChannelGains(buffer, mainChannels, this->preGains, gains, this->getSampleRate());
+	if (gainAutomated) {
+		Track::processGainAutomation(gainLane, buffer, mainChannels, blockTime, this->getSampleRate(), true);
+	}
+	if (panAutomated) {
+		this->processPanAutomation(panLane, buffer, mainChannels, blockTime, this->getSampleRate());
 	}
 
-	/** Process Slider */
-	this->slider.process(juce::dsp::ProcessContextReplacing<float>(block));
+	/** Process Plugin Dock In Place, Track MIDI Passes Through Unchanged */
+	if (auto pluginDock = this->getPluginDock()) {
+		pluginDock->processChain(buffer, midiMessages);
+	}
 
-	/** Update Level Meter */
-	for (int i = 0; i < buffer.getNumChannels() && i < this->outputLevels.size(); i++) {
-		this->outputLevels.getReference(i) =
-			buffer.getRMSLevel(i, 0, buffer.getNumSamples());
+	/** Process Mute And Slider */
+	this->getPostGains(gains, mainChannels, sliderAutomated);
+	Track::processChannelGains(buffer, mainChannels, this->postGains, gains, this->getSampleRate());
+	if (sliderAutomated && !this->isMute) {
+		Track::processGainAutomation(sliderLane, buffer, mainChannels, blockTime, this->getSampleRate(), false);
 	}
 
+	/** Update Level Meter, Nodes Run In Parallel And Only Write Their Own Levels */
+	this->outputMeter.process(buffer, this->getSampleRate());
+
 	/** Render */
 	if (Renderer::getInstance()->getRendering()) {
 		if (auto playHead = this->getPlayHead()) {
@@ -406,3 +566,141 @@ void Track::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& mid
 		}
 	}
 }
+
+void Track::processGainAutomation(const AutomationLane& lane, juce::AudioBuffer<float>& buffer,
+	int channels, double startTime, double sampleRate, bool isDecibels) {
+	/** The Lane Interpolates In Decibels, So Decibel Ramps Are Converted In Short Linear Pieces */
+	lane.forEachSegment(startTime, buffer.getNumSamples(), sampleRate,
+		[&buffer, channels, isDecibels](int startSample, int length, float startValue, float endValue) {
+			int step = (isDecibels && startValue != endValue) ? Track::gainAutomationStep : length;
+			for (int offset = 0; offset < length; offset += step) {
+				int size = std::min(step, length - offset);
+				float pieceStart = startValue + (endValue - startValue) * offset / length;
+				float pieceEnd = startValue + (endValue - startValue) * (offset + size) / length;
+
+				float startGain = isDecibels ? juce::Decibels::decibelsToGain(pieceStart) : pieceStart;
+				float endGain = isDecibels ? juce::Decibels::decibelsToGain(pieceEnd) : pieceEnd;
+				for (int i = 0; i < channels; i++) {
+					vMath::applyGainRamp(buffer, startGain, endGain, startSample + offset, i, size);
+				}
+			}
+		});
+}
+
+void Track::processPanAutomation(const AutomationLane& lane, juce::AudioBuffer<float>& buffer,
+	int channels, double startTime, double sampleRate) const {
+	auto applyPan = [this, &buffer, channels](int startSample, int length, float startPan, float endPan) {
+		std::array<float, Track::maxChannels> startGains, endGains;
+		for (int i = 0; i < channels; i++) {
+			startGains[i] = Track::getPanGain(this->panSides[i], startPan);
+			endGains[i] = Track::getPanGain(this->panSides[i], endPan);
+		}
+		vMath::applyChannelGains(buffer, startGains.data(), endGains.data(), startSample, channels, length);
+	};
+
+	lane.forEachSegment(startTime, buffer.getNumSamples(), sampleRate,
+		[&applyPan](int startSample, int length, float startValue, float endValue) {
+			/** The Rule Bends At Center, Split Ramps Crossing It */
+			if (startValue * endValue < 0 && length > 1) {
+				int cross = juce::jlimit(1, length - 1,
+					juce::roundToInt(length * startValue / (startValue - endValue)));
+				float crossValue = startValue + (endValue - startValue) * cross / length;
+				applyPan(startSample, cross, startValue, crossValue);
+				applyPan(startSample + cross, length - cross, crossValue, endValue);
+				return;
+			}
+			applyPan(startSample, length, startValue, endValue);
+		});
+}
+
+void Track::getPreGains(std::array<float, Track::maxChannels>& gains, int channels,
+	bool gainAutomated, bool panAutomated) const {
+	float gain = gainAutomated ? 1.f : juce::Decibels::decibelsToGain(this->gainValue.load());
+	float pan = panAutomated ? 0.f : this->panValue.load();
+	for (int i = 0; i < channels; i++) {
+		gains[i] = gain * Track::getPanGain(this->panSides[i], pan);
+	}
+}
+
+void Track::getPostGains(std::array<float, Track::maxChannels>& gains, int channels,
+	bool sliderAutomated) const {
+	float gain = this->isMute ? 0.f : (sliderAutomated ? 1.f : this->sliderValue.load());
+	for (int i = 0; i < channels; i++) {
+		gains[i] = gain;
+	}
+}
+
+void Track::processChannelGains(juce::AudioBuffer<float>& buffer, int channels,
+	GainRamp& ramp, const std::array<float, Track::maxChannels>& target, double sampleRate) {
+	int numSamples = buffer.getNumSamples();
+	int rampLength = std::max(1, (int)(sampleRate * Track::gainRampSeconds));
+
+	/** A New Target Starts A Linear Ramp Of The Ramp Length From The Current Gain */
+	for (int i = 0; i < channels; i++) {
+		if (std::abs(target[i] - ramp.target[i]) >= 1.0e-6f) {
+			ramp.target[i] = target[i];
+			ramp.increment[i] = (target[i] - ramp.current[i]) / rampLength;
+			ramp.remaining[i] = rampLength;
+		}
+	}
+
+	/** Split Where A Channel Ends Its Ramp, All Channels Still Go In One Pass Per Piece */
+	std::array<float, Track::maxChannels> pieceEnd;
+	for (int startSample = 0; startSample < numSamples;) {
+		int length = numSamples - startSample;
+		for (int i = 0; i < channels; i++) {
+			if (ramp.remaining[i] > 0) {
+				length = std::min(length, ramp.remaining[i]);
+			}
+		}
+
+		for (int i = 0; i < channels; i++) {
+			if (ramp.remaining[i] <= 0) {
+				pieceEnd[i] = ramp.current[i];
+				continue;
+			}
+
+			ramp.remaining[i] -= length;
+			pieceEnd[i] = (ramp.remaining[i] > 0)
+				? (ramp.current[i] + ramp.increment[i] * length) : ramp.target[i];
+		}
+
+		vMath::applyChannelGains(buffer, ramp.current.data(), pieceEnd.data(), startSample, channels, length);
+		std::copy(pieceEnd.begin(), pieceEnd.begin() + channels, ramp.current.begin());
+		startSample += length;
+	}
+}
+
+int Track::getPanSide(juce::AudioChannelSet::ChannelType type) {
+	switch (type) {
+	case juce::AudioChannelSet::left:
+	case juce::AudioChannelSet::leftSurround:
+	case juce::AudioChannelSet::leftCentre:
+	case juce::AudioChannelSet::leftSurroundSide:
+	case juce::AudioChannelSet::leftSurroundRear:
+	case juce::AudioChannelSet::wideLeft:
+	case juce::AudioChannelSet::topFrontLeft:
+	case juce::AudioChannelSet::topRearLeft:
+	case juce::AudioChannelSet::topSideLeft:
+		return -1;
+	case juce::AudioChannelSet::right:
+	case juce::AudioChannelSet::rightSurround:
+	case juce::AudioChannelSet::rightCentre:
+	case juce::AudioChannelSet::rightSurroundSide:
+	case juce::AudioChannelSet::rightSurroundRear:
+	case juce::AudioChannelSet::wideRight:
+	case juce::AudioChannelSet::topFrontRight:
+	case juce::AudioChannelSet::topRearRight:
+	case juce::AudioChannelSet::topSideRight:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+float Track::getPanGain(int side, float pan) {
+	/** Same Balanced Rule As juce::dsp::Panner, Centre Channels Keep Unity Gain */
+	if (side < 0) { return std::min(1.f, 1.f - pan); }
+	if (side > 0) { return std::min(1.f, 1.f + pan); }
+	return 1.f;
+}
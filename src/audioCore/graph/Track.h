@@ -2,9 +2,15 @@
 
 #include <JuceHeader.h>
 #include "PluginDock.h"
+#include "GraphTransaction.h"
+#include "../misc/LevelMeter.h"
+#include "../misc/NodeProfiler.h"
+#include "../misc/AudioSnapshot.h"
+#include "../misc/AutomationLane.h"
 #include "../project/Serializable.h"
 
 class Track final : public juce::AudioProcessorGraph,
+	public GraphTransaction,
 	public Serializable {
 public:
 	Track() = delete;
@@ -31,6 +37,18 @@ public:
 	void setSlider(float slider);
 	float getSlider() const;
 
+	/**
+	 * @brief	Gain points are in decibels, pan points in [-1, 1] and slider points are linear gain.
+	 * @attention	Automated values replace the static value while playing.
+	 */
+	enum class AutomationType {
+		Gain, Pan, Slider, TypeNum
+	};
+	int addAutomationPoint(AutomationType type, double time, float value);
+	void removeAutomationPoint(AutomationType type, int index);
+	int getAutomationPointNum(AutomationType type) const;
+	const AutomationLane::Point getAutomationPoint(AutomationType type, int index) const;
+
 	void setTrackName(const juce::String& name);
 	const juce::String getTrackName() const;
 	void setTrackColor(const juce::Colour& color);
@@ -46,6 +64,9 @@ public:
 	void clearGraph();
 
 	const juce::Array<float> getOutputLevels() const;
+	const juce::Array<float> getOutputPeakLevels() const;
+	const juce::Array<float> getOutputTruePeakLevels() const;
+	const NodeProfiler::Usage getCPUUsage() const;
 
 	class SafePointer {
 	private:
@@ -84,21 +105,69 @@ private:
 
 	juce::AudioProcessorGraph::Node::Ptr pluginDockNode;
 
-	juce::dsp::ProcessorChain<juce::dsp::Gain<float>, juce::dsp::Panner<float>> gainAndPanner;
-	juce::dsp::ProcessorChain<juce::dsp::Gain<float>> slider;
 	std::atomic<bool> isMute = false;
-
+	std::atomic<float> gainValue = 0.0;
 	std::atomic<float> panValue = 0.0;
+	std::atomic<float> sliderValue = 1.0;
+
+	/** Gain, Pan, Mute And Fader Are Folded Into Per Channel Gains Applied In One Pass */
+	static constexpr int maxChannels = 64;
+	static constexpr double gainRampSeconds = 0.05;
+	/** Decibel Automation Is Applied In Linear Pieces Of This Many Samples */
+	static constexpr int gainAutomationStep = 16;
+	/** -1 For Left Side Channels, 1 For Right Side Channels, 0 For Others */
+	std::array<int, Track::maxChannels> panSides{};
+	/** Linear Ramps Toward The Latest Target Gains, Only Touched By The Audio Thread */
+	struct GainRamp final {
+		std::array<float, Track::maxChannels> current{}, target{}, increment{};
+		std::array<int, Track::maxChannels> remaining{};
+
+		void reset(const std::array<float, Track::maxChannels>& gains) {
+			this->current = this->target = gains;
+			this->increment.fill(0.f);
+			this->remaining.fill(0);
+		};
+	};
+	GainRamp preGains, postGains;
 
 	juce::String trackName;
 	juce::Colour trackColor;
 
-	juce::Array<float> outputLevels;
+	LevelMeter outputMeter;
+	NodeProfiler profiler;
+
+	struct TrackAutomation final {
+		std::array<AutomationLane, (int)AutomationType::TypeNum> lanes;
+	};
+	AudioSnapshot<TrackAutomation> automation;
+
+	const juce::var getAutomationData() const;
+	void setAutomationData(const juce::var& data);
+	bool saveAutomationData(const juce::String& automationDir) const;
+	bool loadAutomationData(const juce::String& automationDir);
+
+	static void processGainAutomation(const AutomationLane& lane, juce::AudioBuffer<float>& buffer,
+		int channels, double startTime, double sampleRate, bool isDecibels);
+	void processPanAutomation(const AutomationLane& lane, juce::AudioBuffer<float>& buffer,
+		int channels, double startTime, double sampleRate) const;
+
+	void getPreGains(std::array<float, Track::maxChannels>& gains, int channels,
+		bool gainAutomated, bool panAutomated) const;
+	void getPostGains(std::array<float, Track::maxChannels>& gains, int channels,
+		bool sliderAutomated) const;
+	static void processChannelGains(juce::AudioBuffer<float>& buffer, int channels,
+		GainRamp& ramp, const std::array<float, Track::maxChannels>& target, double sampleRate);
+	static int getPanSide(juce::AudioChannelSet::ChannelType type);
+	static float getPanGain(int side, float pan);
 
 private:
 	bool canAddBus(bool isInput) const override;
 	bool canRemoveBus(bool isInput) const override;
 
+	int getTransactionIndex() const override;
+	void transactionBegan() override;
+	void transactionCommitted() override;
+
 	void processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) override;
 
 	JUCE_DECLARE_WEAK_REFERENCEABLE(Track)
@@ -0,0 +1,108 @@
+﻿#include "ActiveNoteTable.h"
+#include "../Utils.h"
+#include <bit>
+
+void ActiveNoteTable::noteOn(int channel, int note) {
+	int c = channel - 1;
+	if (c < 0 || c >= ActiveNoteTable::channelNum) { return; }
+	if (note < 0 || note >= ActiveNoteTable::noteNum) { return; }
+
+	auto& count = this->counts[c][note];
+	if (count < UINT8_MAX) { count++; }
+
+	this->bits[c][note / ActiveNoteTable::wordBits] |= (1ULL << (note % ActiveNoteTable::wordBits));
+	this->channelMask |= (1U << c);
+}
+
+void ActiveNoteTable::noteOff(int channel, int note) {
+	int c = channel - 1;
+	if (c < 0 || c >= ActiveNoteTable::channelNum) { return; }
+	if (note < 0 || note >= ActiveNoteTable::noteNum) { return; }
+
+	auto& count = this->counts[c][note];
+	if (count == 0) { return; }
+	if (--count > 0) { return; }
+
+	auto& word = this->bits[c][note / ActiveNoteTable::wordBits];
+	word &= ~(1ULL << (note % ActiveNoteTable::wordBits));
+
+	/** Channel Empty */
+	bool channelEmpty = true;
+	for (auto i : this->bits[c]) {
+		channelEmpty &= (i == 0);
+	}
+	if (channelEmpty) {
+		this->channelMask &= ~(1U << c);
+	}
+}
+
+bool ActiveNoteTable::isActive(int channel, int note) const {
+	int c = channel - 1;
+	if (c < 0 || c >= ActiveNoteTable::channelNum) { return false; }
+	if (note < 0 || note >= ActiveNoteTable::noteNum) { return false; }
+
+	return this->counts[c][note] > 0;
+}
+
+bool ActiveNoteTable::isEmpty() const {
+	return this->channelMask == 0;
+}
+
+void ActiveNoteTable::update(const juce::MidiBuffer& midiMessages) {
+	bool vel0NoteOff = utils::regardVel0NoteAsNoteOff();
+	for (auto i : midiMessages) {
+		auto mes = i.getMessage();
+		if (mes.isNoteOn(!vel0NoteOff)) {
+			this->noteOn(mes.getChannel(), mes.getNoteNumber());
+		}
+		else if (mes.isNoteOff(vel0NoteOff)) {
+			this->noteOff(mes.getChannel(), mes.getNoteNumber());
+		}
+	}
+}
+
+void ActiveNoteTable::closeAll(juce::MidiBuffer& midiMessages, int samplePosition) {
+	/** Only Visit Set Bits */
+	uint32_t channels = this->channelMask;
+	while (channels != 0) {
+		int c = std::countr_zero(channels);
+		channels &= (channels - 1);
+
+		for (int w = 0; w < ActiveNoteTable::wordNum; w++) {
+			uint64_t word = this->bits[c][w];
+			while (word != 0) {
+				int note = w * ActiveNoteTable::wordBits + std::countr_zero(word);
+				word &= (word - 1);
+
+				/** One Note Off For Each Stacked Note On */
+				for (int i = 0; i < this->counts[c][note]; i++) {
+					midiMessages.addEvent(
+						juce::MidiMessage::noteOff(c + 1, note), samplePosition);
+				}
+				this->counts[c][note] = 0;
+			}
+			this->bits[c][w] = 0;
+		}
+	}
+	this->channelMask = 0;
+}
+
+void ActiveNoteTable::closeAllAhead(juce::MidiBuffer& midiMessages, juce::MidiBuffer& temp) {
+	if (this->isEmpty()) { return; }
+
+	/** Events At The Block Start Come After The Note Offs */
+	temp.clear();
+	this->closeAll(temp, 0);
+	temp.addEvents(midiMessages, 0, -1, 0);
+	midiMessages.swapWith(temp);
+}
+
+void ActiveNoteTable::clear() {
+	for (auto& i : this->counts) {
+		i.fill(0);
+	}
+	for (auto& i : this->bits) {
+		i.fill(0);
+	}
+	this->channelMask = 0;
+}
@@ -0,0 +1,47 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * Notes held on each MIDI channel, in a fixed table so the audio thread never allocates.
+ * Every note keeps a counter of unmatched note on events, and a bit per note lets
+ * closing all notes visit only the notes that are actually held.
+ */
+class ActiveNoteTable final {
+public:
+	ActiveNoteTable() = default;
+
+	/**
+	 * @attention	Channel starts from 1.
+	 */
+	void noteOn(int channel, int note);
+	void noteOff(int channel, int note);
+	bool isActive(int channel, int note) const;
+	bool isEmpty() const;
+
+	void update(const juce::MidiBuffer& midiMessages);
+	/**
+	 * @brief	Add a note off for every unmatched note on and clear the table.
+	 */
+	void closeAll(juce::MidiBuffer& midiMessages, int samplePosition);
+	/**
+	 * @brief	Add a note off at the block start ahead of every event in the block for every unmatched note on,
+	 *			and clear the table. Call this before updating the table with the block.
+	 * @attention	The temp buffer should be preallocated, its content is replaced.
+	 */
+	void closeAllAhead(juce::MidiBuffer& midiMessages, juce::MidiBuffer& temp);
+	void clear();
+
+	static constexpr int channelNum = 16;
+	static constexpr int noteNum = 128;
+
+private:
+	static constexpr int wordBits = 64;
+	static constexpr int wordNum = ActiveNoteTable::noteNum / ActiveNoteTable::wordBits;
+
+	std::array<std::array<uint8_t, ActiveNoteTable::noteNum>, ActiveNoteTable::channelNum> counts{};
+	std::array<std::array<uint64_t, ActiveNoteTable::wordNum>, ActiveNoteTable::channelNum> bits{};
+	uint32_t channelMask = 0;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ActiveNoteTable)
+};
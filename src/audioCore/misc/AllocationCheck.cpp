@@ -0,0 +1,83 @@
+﻿#include "AllocationCheck.h"
+
+#if VS_REALTIME_ALLOCATION_CHECK_ENABLED
+
+#include <cstdlib>
+#include <new>
+
+namespace allocationCheck {
+	static thread_local int noAllocationDepth = 0;
+	static std::atomic_uint64_t violationNum = 0;
+
+	static void checkAllocation() {
+		if (noAllocationDepth <= 0) { return; }
+
+		violationNum++;
+
+		/** Assertion Logging Allocates Too */
+		int depthTemp = noAllocationDepth;
+		noAllocationDepth = 0;
+		jassertfalse;
+		noAllocationDepth = depthTemp;
+	}
+
+	ScopedNoAllocation::ScopedNoAllocation() {
+		noAllocationDepth++;
+	}
+
+	ScopedNoAllocation::~ScopedNoAllocation() {
+		noAllocationDepth--;
+	}
+
+	ScopedAllocationAllowed::ScopedAllocationAllowed()
+		: depthTemp(noAllocationDepth) {
+		noAllocationDepth = 0;
+	}
+
+	ScopedAllocationAllowed::~ScopedAllocationAllowed() {
+		noAllocationDepth = this->depthTemp;
+	}
+
+	uint64_t getViolationNum() {
+		return violationNum;
+	}
+}
+
+void* operator new(std::size_t size) {
+	allocationCheck::checkAllocation();
+	if (auto ptr = std::malloc(size ? size : 1)) {
+		return ptr;
+	}
+	throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size) {
+	return ::operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+	allocationCheck::checkAllocation();
+	return std::malloc(size ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+	return ::operator new(size, std::nothrow);
+}
+
+void operator delete(void* ptr) noexcept {
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+	std::free(ptr);
+}
+
+#endif
@@ -0,0 +1,58 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * Debug check for heap allocations on realtime paths.
+ * Only active in debug builds configured with VS_REALTIME_ALLOCATION_CHECK, where the global
+ * operator new asserts while a ScopedNoAllocation is alive on the calling thread.
+ */
+#if JUCE_DEBUG && VS_REALTIME_ALLOCATION_CHECK
+#define VS_REALTIME_ALLOCATION_CHECK_ENABLED 1
+#else
+#define VS_REALTIME_ALLOCATION_CHECK_ENABLED 0
+#endif
+
+namespace allocationCheck {
+#if VS_REALTIME_ALLOCATION_CHECK_ENABLED
+	class ScopedNoAllocation final {
+	public:
+		ScopedNoAllocation();
+		~ScopedNoAllocation();
+
+	private:
+		JUCE_DECLARE_NON_COPYABLE(ScopedNoAllocation)
+	};
+
+	/**
+	 * @brief	Allow allocations inside a ScopedNoAllocation, for calls into plugin code.
+	 */
+	class ScopedAllocationAllowed final {
+	public:
+		ScopedAllocationAllowed();
+		~ScopedAllocationAllowed();
+
+	private:
+		const int depthTemp;
+
+		JUCE_DECLARE_NON_COPYABLE(ScopedAllocationAllowed)
+	};
+
+	uint64_t getViolationNum();
+
+#else
+	inline uint64_t getViolationNum() { return 0; };
+
+#endif
+}
+
+/** Scoped Checks, Nothing Is Left Behind When The Check Is Compiled Out */
+#if VS_REALTIME_ALLOCATION_CHECK_ENABLED
+#define VS_SCOPED_NO_ALLOCATION \
+	allocationCheck::ScopedNoAllocation JUCE_JOIN_MACRO(noAllocationChecker, __LINE__)
+#define VS_SCOPED_ALLOCATION_ALLOWED \
+	allocationCheck::ScopedAllocationAllowed JUCE_JOIN_MACRO(allocationAllowedChecker, __LINE__)
+#else
+#define VS_SCOPED_NO_ALLOCATION
+#define VS_SCOPED_ALLOCATION_ALLOWED
+#endif
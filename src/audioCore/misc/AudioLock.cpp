@@ -8,7 +8,6 @@ namespace audioLock {
 		juce::ReadWriteLock pluginLock;
 		juce::ReadWriteLock positionLock;
 		juce::ReadWriteLock audioControlLock;
-		juce::ReadWriteLock levelMeterLock;
 	};
 
 	static LockHelper* lock = new LockHelper;
@@ -32,8 +31,4 @@ namespace audioLock {
 	juce::ReadWriteLock& getAudioControlLock() {
 		return lock->audioControlLock;
 	}
-
-	juce::ReadWriteLock& getLevelMeterLock() {
-		return lock->levelMeterLock;
-	}
 }
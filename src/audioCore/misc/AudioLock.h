@@ -8,5 +8,4 @@ namespace audioLock {
 	juce::ReadWriteLock& getPluginLock();
 	juce::ReadWriteLock& getPositionLock();
 	juce::ReadWriteLock& getAudioControlLock();
-	juce::ReadWriteLock& getLevelMeterLock();
 }
@@ -0,0 +1,107 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * Immutable data published by the message thread and read by audio threads without locking.
+ * Replaced data is retired and only deleted on the publisher side once every reader that started
+ * before it was retired has finished, so the audio thread never blocks and never frees memory.
+ * Readers are counted per epoch in two slots, a steady stream of readers doesn't keep old data alive.
+ */
+template<typename T>
+class AudioSnapshot final {
+public:
+	AudioSnapshot() : current(new T{}) {};
+	~AudioSnapshot() {
+		delete this->current.load();
+		for (auto& [ptr, epoch] : this->retired) {
+			delete ptr;
+		}
+	};
+
+	/**
+	 * @attention	Call this only on message thread.
+	 */
+	void publish(std::unique_ptr<T> data) {
+		if (!data) { return; }
+
+		juce::ScopedLock locker(this->publishLock);
+		auto ptr = this->current.exchange(data.release());
+		this->retired.add({ ptr, this->epoch.load() });
+		this->collectInternal();
+	};
+
+	/**
+	 * @attention	Call this only on message thread.
+	 */
+	void collect() {
+		juce::ScopedLock locker(this->publishLock);
+		this->collectInternal();
+	};
+
+	/**
+	 * @attention	Call this only on message thread.
+	 */
+	const T& getLatest() const {
+		return *(this->current.load());
+	};
+
+	class Reader final {
+	public:
+		Reader() = delete;
+		explicit Reader(const AudioSnapshot<T>& snapshot)
+			: snapshot(snapshot) {
+			/** Register Reader In The Current Epoch Before Loading So The Publisher Can't Free It */
+			while (true) {
+				this->epoch = this->snapshot.epoch.load();
+				this->snapshot.readerNum[this->epoch & 1].fetch_add(1);
+				if (this->snapshot.epoch.load() == this->epoch) { break; }
+				this->snapshot.readerNum[this->epoch & 1].fetch_sub(1);
+			}
+			this->data = this->snapshot.current.load();
+		};
+		~Reader() {
+			this->snapshot.readerNum[this->epoch & 1].fetch_sub(1);
+		};
+
+		const T& operator*() const noexcept { return *(this->data); };
+		const T* operator->() const noexcept { return this->data; };
+
+	private:
+		const AudioSnapshot<T>& snapshot;
+		const T* data = nullptr;
+		uint64_t epoch = 0;
+
+		JUCE_DECLARE_NON_COPYABLE(Reader)
+	};
+
+private:
+	std::atomic<T*> current;
+	mutable std::atomic_uint64_t epoch = 1;
+	mutable std::array<std::atomic_int, 2> readerNum{};
+
+	juce::Array<std::pair<T*, uint64_t>> retired;
+	juce::CriticalSection publishLock;
+
+	void collectInternal() {
+		/** Readers Of The Last Epoch Are Still Active */
+		uint64_t currentEpoch = this->epoch.load();
+		if (this->readerNum[(currentEpoch - 1) & 1].load() != 0) { return; }
+
+		/** Data Retired Before The Current Epoch Is Only Seen By Finished Readers */
+		this->retired.removeIf([currentEpoch](const std::pair<T*, uint64_t>& item) {
+			if (item.second < currentEpoch) {
+				delete item.first;
+				return true;
+			}
+			return false;
+			});
+
+		/** New Readers Go To The Drained Slot, So Data Retired In This Epoch Can Be Freed Next Time */
+		if (!this->retired.isEmpty()) {
+			this->epoch.store(currentEpoch + 1);
+		}
+	};
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AudioSnapshot)
+};
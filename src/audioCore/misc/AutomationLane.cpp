@@ -0,0 +1,89 @@
+﻿#include "AutomationLane.h"
+
+int AutomationLane::addPoint(double time, float value) {
+	int index = this->getNextIndex(time);
+
+	/** Replace Point At The Same Time */
+	if (index > 0 && this->points.getReference(index - 1).time == time) {
+		this->points.getReference(index - 1).value = value;
+		return index - 1;
+	}
+
+	this->points.insert(index, { time, value });
+	return index;
+}
+
+void AutomationLane::removePoint(int index) {
+	this->points.remove(index);
+}
+
+void AutomationLane::clear() {
+	this->points.clear();
+}
+
+int AutomationLane::getPointNum() const {
+	return this->points.size();
+}
+
+const AutomationLane::Point AutomationLane::getPoint(int index) const {
+	return this->points[index];
+}
+
+bool AutomationLane::isEmpty() const {
+	return this->points.isEmpty();
+}
+
+float AutomationLane::getValue(double time) const {
+	return this->interpolate(this->getNextIndex(time), time);
+}
+
+double AutomationLane::getNextPointTime(double time) const {
+	int index = this->getNextIndex(time);
+	if (index >= this->points.size()) {
+		return std::numeric_limits<double>::infinity();
+	}
+	return this->points.getReference(index).time;
+}
+
+const juce::var AutomationLane::toVar() const {
+	juce::Array<juce::var> result;
+	for (auto& i : this->points) {
+		result.add(juce::Array<juce::var>{ i.time, i.value });
+	}
+	return result;
+}
+
+bool AutomationLane::fromVar(const juce::var& data) {
+	this->clear();
+
+	auto array = data.getArray();
+	if (!array) { return false; }
+
+	for (auto& i : *array) {
+		auto point = i.getArray();
+		if (!point || point->size() < 2) { continue; }
+		this->addPoint((double)(point->getReference(0)), (float)(point->getReference(1)));
+	}
+	return true;
+}
+
+int AutomationLane::getNextIndex(double time) const {
+	auto it = std::upper_bound(this->points.begin(), this->points.end(), time,
+		[](double t, const Point& point) { return t < point.time; });
+	return (int)(it - this->points.begin());
+}
+
+float AutomationLane::interpolate(int nextIndex, double time) const {
+	int size = this->points.size();
+	if (size <= 0) { return 0.f; }
+	if (nextIndex <= 0) { return this->points.getReference(0).value; }
+	if (nextIndex >= size) { return this->points.getReference(size - 1).value; }
+
+	auto& start = this->points.getReference(nextIndex - 1);
+	auto& end = this->points.getReference(nextIndex);
+	double length = end.time - start.time;
+	if (length <= 0) { return end.value; }
+
+	double pos = juce::jlimit(0.0, 1.0, (time - start.time) / length);
+	return (float)(start.value + (end.value - start.value) * pos);
+}
@@ -0,0 +1,77 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * Breakpoints of one automated value, sorted by time in seconds and linearly interpolated.
+ * Lanes are edited on the message thread and handed to the audio thread as immutable copies,
+ * so evaluating a block costs one binary search plus one step per breakpoint inside the block.
+ */
+class AutomationLane final {
+public:
+	AutomationLane() = default;
+
+	struct Point final {
+		double time = 0;
+		float value = 0.f;
+	};
+
+	/**
+	 * @brief	Add a point and return its index.
+	 * @attention	A point already at the same time gets the new value instead.
+	 */
+	int addPoint(double time, float value);
+	void removePoint(int index);
+	void clear();
+
+	int getPointNum() const;
+	const Point getPoint(int index) const;
+	bool isEmpty() const;
+
+	float getValue(double time) const;
+	/**
+	 * @brief	Get the time of the first point after the time, or infinity if there is none.
+	 */
+	double getNextPointTime(double time) const;
+
+	/**
+	 * @brief	Call func(startSample, length, startValue, endValue) for every linear segment of a block.
+	 * @attention	The end value belongs to the first sample after the segment, as vMath::applyGainRamp expects.
+	 */
+	template<typename Func>
+	void forEachSegment(double startTime, int numSamples, double sampleRate, Func&& func) const {
+		if (this->points.isEmpty() || numSamples <= 0 || sampleRate <= 0) { return; }
+
+		int size = this->points.size();
+		int next = this->getNextIndex(startTime);
+		for (int startSample = 0; startSample < numSamples;) {
+			double segmentStartTime = startTime + startSample / sampleRate;
+			while (next < size && this->points.getReference(next).time <= segmentStartTime) {
+				next++;
+			}
+
+			/** Segments End On The First Sample At Or After The Next Point */
+			int endSample = numSamples;
+			if (next < size) {
+				endSample = juce::jlimit(startSample + 1, numSamples,
+					(int)std::ceil((this->points.getReference(next).time - startTime) * sampleRate));
+			}
+
+			func(startSample, endSample - startSample,
+				this->interpolate(next, segmentStartTime),
+				this->interpolate(next, startTime + endSample / sampleRate));
+			startSample = endSample;
+		}
+	};
+
+	const juce::var toVar() const;
+	bool fromVar(const juce::var& data);
+
+private:
+	juce::Array<Point> points;
+
+	int getNextIndex(double time) const;
+	float interpolate(int nextIndex, double time) const;
+
+	JUCE_LEAK_DETECTOR(AutomationLane)
+};
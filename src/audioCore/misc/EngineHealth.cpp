@@ -0,0 +1,117 @@
+﻿#include "EngineHealth.h"
+
+#include "Device.h"
+#include "PlayPosition.h"
+
+EngineHealth::~EngineHealth() {
+	this->stopTimer();
+}
+
+void EngineHealth::report(EventType type, int64_t position, int count) {
+	if (type < EventType::MissedLock || type >= EventType::TypeNum) { return; }
+
+	/** Events Dropped While The Queue Is Full Are Still Counted */
+	this->counts[(int)type].fetch_add(count, std::memory_order_relaxed);
+	this->events.push({ type, juce::Time::currentTimeMillis(), position, count });
+}
+
+uint64_t EngineHealth::getCount(EventType type) const {
+	if (type < EventType::MissedLock || type >= EventType::TypeNum) { return 0; }
+	return this->counts[(int)type].load(std::memory_order_relaxed);
+}
+
+const juce::Array<EngineHealth::Event> EngineHealth::getEvents() const {
+	return this->history;
+}
+
+void EngineHealth::clear() {
+	for (auto& i : this->counts) {
+		i = 0;
+	}
+	this->history.clear();
+}
+
+const juce::String EngineHealth::getTypeName(EventType type) {
+	switch (type) {
+	case EventType::MissedLock:
+		return "Missed Lock";
+	case EventType::Overrun:
+		return "Overrun";
+	case EventType::MIDIOverflow:
+		return "MIDI Overflow";
+	case EventType::DeviceXRun:
+		return "Device XRun";
+	default:
+		break;
+	}
+	return "Unknown";
+}
+
+const juce::String EngineHealth::toString(const Event& event) {
+	return juce::Time{ event.timeMs }.formatted("%H:%M:%S.")
+		+ juce::String{ event.timeMs % 1000 }.paddedLeft('0', 3) + " "
+		+ EngineHealth::getTypeName(event.type)
+		+ " x" + juce::String{ event.count }
+		+ " @" + juce::String{ event.position };
+}
+
+void EngineHealth::timerCallback() {
+	/** Audio Events */
+	this->events.drain([this](const Event& event) {
+		this->addEvent(event);
+		});
+
+	/** Device XRuns */
+	this->checkDeviceXRun();
+}
+
+void EngineHealth::addEvent(const Event& event) {
+	this->history.add(event);
+	if (this->history.size() > EngineHealth::historySize) {
+		this->history.removeRange(0, this->history.size() - EngineHealth::historySize);
+	}
+}
+
+void EngineHealth::checkDeviceXRun() {
+	auto device = Device::getInstance()->getCurrentAudioDevice();
+	if (!device) {
+		this->lastDeviceName = juce::String{};
+		this->lastDeviceXRunNum = -1;
+		return;
+	}
+
+	/** Device Changed */
+	int xrunNum = device->getXRunCount();
+	if (device->getName() != this->lastDeviceName) {
+		this->lastDeviceName = device->getName();
+		this->lastDeviceXRunNum = xrunNum;
+		return;
+	}
+
+	/** Not Supported By The Device */
+	if (xrunNum < 0) { return; }
+
+	if (xrunNum > this->lastDeviceXRunNum && this->lastDeviceXRunNum >= 0) {
+		int count = xrunNum - this->lastDeviceXRunNum;
+		auto position = PlayPosition::getInstance()->getPosition();
+
+		this->counts[(int)EventType::DeviceXRun].fetch_add(count, std::memory_order_relaxed);
+		this->addEvent({ EventType::DeviceXRun, juce::Time::currentTimeMillis(),
+			position->getTimeInSamples().orFallback(0), count });
+	}
+	this->lastDeviceXRunNum = xrunNum;
+}
+
+EngineHealth* EngineHealth::getInstance() {
+	return EngineHealth::instance
+		? EngineHealth::instance : (EngineHealth::instance = new EngineHealth());
+}
+
+void EngineHealth::releaseInstance() {
+	if (EngineHealth::instance) {
+		delete EngineHealth::instance;
+		EngineHealth::instance = nullptr;
+	}
+}
+
+EngineHealth* EngineHealth::instance = nullptr;
@@ -0,0 +1,70 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+#include "RealtimeMPSCFifo.h"
+
+/**
+ * Counts engine problems that end up as dropouts and keeps the latest of them with time and play position.
+ * Audio threads report into a queue, the message thread moves the events into the history.
+ */
+class EngineHealth final : public juce::Timer,
+	private juce::DeletedAtShutdown {
+public:
+	EngineHealth() = default;
+	~EngineHealth() override;
+
+	enum class EventType : int {
+		MissedLock = 0,
+		Overrun,
+		MIDIOverflow,
+		DeviceXRun,
+		TypeNum
+	};
+	struct Event final {
+		EventType type = EventType::MissedLock;
+		juce::int64 timeMs = 0;
+		int64_t position = 0;
+		int count = 0;
+	};
+
+	/**
+	 * @attention	Any thread can report, parallel nodes report at the same time.
+	 */
+	void report(EventType type, int64_t position, int count = 1);
+
+	uint64_t getCount(EventType type) const;
+	/**
+	 * @brief	Oldest first.
+	 * @attention	Call this only on message thread.
+	 */
+	const juce::Array<Event> getEvents() const;
+	void clear();
+
+	static const juce::String getTypeName(EventType type);
+	static const juce::String toString(const Event& event);
+
+	static constexpr int historySize = 1024;
+
+public:
+	void timerCallback() override;
+
+private:
+	std::array<std::atomic_uint64_t, (int)EventType::TypeNum> counts{};
+	RealtimeMPSCFifo<Event, 256> events;
+	juce::Array<Event> history;
+
+	juce::String lastDeviceName;
+	int lastDeviceXRunNum = -1;
+
+	void addEvent(const Event& event);
+	void checkDeviceXRun();
+
+public:
+	static EngineHealth* getInstance();
+	static void releaseInstance();
+
+private:
+	static EngineHealth* instance;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(EngineHealth)
+};
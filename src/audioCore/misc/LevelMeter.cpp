@@ -0,0 +1,78 @@
+﻿#include "LevelMeter.h"
+
+void LevelMeter::setChannelNum(int num) {
+	this->channelNum = juce::jlimit(0, LevelMeter::maxChannels, num);
+}
+
+int LevelMeter::getChannelNum() const {
+	return this->channelNum;
+}
+
+void LevelMeter::process(const juce::AudioBuffer<float>& buffer, double sampleRate) {
+	int numSamples = buffer.getNumSamples();
+	if (numSamples <= 0) { return; }
+
+	int maxHoldSamples = sampleRate * LevelMeter::peakHoldSeconds;
+	bool truePeakEnabled = LevelMeter::truePeakEnabled;
+
+	int num = std::min(buffer.getNumChannels(), this->channelNum.load());
+	for (int i = 0; i < num; i++) {
+		auto& channel = this->channels[i];
+
+		/** RMS, Peak And True Peak In One Call */
+		auto data = vMath::getLevelData(buffer, 0, i, numSamples,
+			truePeakEnabled ? channel.truePeakHistory.data() : nullptr);
+
+		channel.rms.store(std::sqrt(data.sumSquare / numSamples), std::memory_order_relaxed);
+		channel.peak.store(LevelMeter::holdPeak(channel.peakHold,
+			channel.peakHoldSamples, data.peak, numSamples, maxHoldSamples), std::memory_order_relaxed);
+		channel.truePeak.store(truePeakEnabled ? LevelMeter::holdPeak(channel.truePeakHold,
+			channel.truePeakHoldSamples, data.truePeak, numSamples, maxHoldSamples) : 0.f, std::memory_order_relaxed);
+	}
+}
+
+const juce::Array<float> LevelMeter::getRMSLevels() const {
+	return this->getLevels(&Channel::rms);
+}
+
+const juce::Array<float> LevelMeter::getPeakLevels() const {
+	return this->getLevels(&Channel::peak);
+}
+
+const juce::Array<float> LevelMeter::getTruePeakLevels() const {
+	return this->getLevels(&Channel::truePeak);
+}
+
+void LevelMeter::setTruePeakEnabled(bool enabled) {
+	LevelMeter::truePeakEnabled = enabled;
+}
+
+bool LevelMeter::getTruePeakEnabled() {
+	return LevelMeter::truePeakEnabled;
+}
+
+const juce::Array<float> LevelMeter::getLevels(std::atomic<float> Channel::* level) const {
+	juce::Array<float> result;
+
+	int num = this->channelNum;
+	result.resize(num);
+	for (int i = 0; i < num; i++) {
+		result.getReference(i) = (this->channels[i].*level).load(std::memory_order_relaxed);
+	}
+
+	return result;
+}
+
+float LevelMeter::holdPeak(float& hold, int& holdSamples, float peak, int numSamples, int maxHoldSamples) {
+	/** New Peak Or Hold Time Expired */
+	if (peak >= hold || holdSamples <= 0) {
+		hold = peak;
+		holdSamples = maxHoldSamples;
+	}
+	else {
+		holdSamples -= numSamples;
+	}
+	return hold;
+}
+
+std::atomic_bool LevelMeter::truePeakEnabled = false;
@@ -0,0 +1,53 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+#include "VMath.h"
+
+/**
+ * Output levels of a node, written by the thread processing the node and read by the UI without locking.
+ * Peaks are held on the audio side, so any number of readers see the same values.
+ */
+class LevelMeter final {
+public:
+	LevelMeter() = default;
+
+	/**
+	 * @attention	Call this only on message thread.
+	 */
+	void setChannelNum(int num);
+	int getChannelNum() const;
+
+	void process(const juce::AudioBuffer<float>& buffer, double sampleRate);
+
+	const juce::Array<float> getRMSLevels() const;
+	const juce::Array<float> getPeakLevels() const;
+	const juce::Array<float> getTruePeakLevels() const;
+
+	/**
+	 * @brief	Also measure the 4x oversampled true peak on every meter.
+	 */
+	static void setTruePeakEnabled(bool enabled);
+	static bool getTruePeakEnabled();
+
+	static constexpr int maxChannels = 64;
+	static constexpr double peakHoldSeconds = 1.5;
+
+private:
+	struct Channel final {
+		std::atomic<float> rms = 0.f, peak = 0.f, truePeak = 0.f;
+
+		/** Only Touched By The Writer */
+		float peakHold = 0.f, truePeakHold = 0.f;
+		int peakHoldSamples = 0, truePeakHoldSamples = 0;
+		std::array<float, vMath::truePeakHistorySize> truePeakHistory{};
+	};
+	std::array<Channel, maxChannels> channels;
+	std::atomic_int channelNum = 0;
+
+	static std::atomic_bool truePeakEnabled;
+
+	const juce::Array<float> getLevels(std::atomic<float> Channel::* level) const;
+	static float holdPeak(float& hold, int& holdSamples, float peak, int numSamples, int maxHoldSamples);
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LevelMeter)
+};
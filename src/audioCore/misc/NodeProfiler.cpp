@@ -0,0 +1,53 @@
+﻿#include "NodeProfiler.h"
+
+NodeProfiler::Scope::Scope(NodeProfiler& profiler, int numSamples, double sampleRate)
+	: profiler(profiler), numSamples(numSamples), sampleRate(sampleRate),
+	startTicks(juce::Time::getHighResolutionTicks()) {}
+
+NodeProfiler::Scope::~Scope() {
+	this->profiler.add(juce::Time::getHighResolutionTicks() - this->startTicks,
+		this->numSamples, this->sampleRate);
+}
+
+void NodeProfiler::add(juce::int64 ticks, int numSamples, double sampleRate) {
+	if (numSamples <= 0 || sampleRate <= 0) { return; }
+
+	/** Cost In Percent Of Deadline */
+	static const double ticksPerSecond = juce::Time::getHighResolutionTicksPerSecond();
+	double deadline = numSamples / sampleRate;
+	float usage = (ticks / ticksPerSecond) / deadline * 100;
+
+	/** Write History */
+	int index = this->writeIndex.load(std::memory_order_relaxed);
+	this->history[index].store(usage, std::memory_order_relaxed);
+	this->writeIndex.store((index + 1) % NodeProfiler::historySize, std::memory_order_relaxed);
+	if (this->count.load(std::memory_order_relaxed) < NodeProfiler::historySize) {
+		this->count.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+const NodeProfiler::Usage NodeProfiler::getUsage() const {
+	int num = this->count.load(std::memory_order_relaxed);
+	if (num <= 0) { return {}; }
+
+	/** Copy History */
+	std::array<float, NodeProfiler::historySize> temp{};
+	for (int i = 0; i < num; i++) {
+		temp[i] = this->history[i].load(std::memory_order_relaxed);
+	}
+
+	/** Average And Max */
+	Usage result;
+	for (int i = 0; i < num; i++) {
+		result.average += temp[i];
+		result.max = std::max(result.max, temp[i]);
+	}
+	result.average /= num;
+
+	/** Percentile */
+	int percentileIndex = std::min((int)(num * NodeProfiler::percentilePoint), num - 1);
+	std::nth_element(temp.begin(), temp.begin() + percentileIndex, temp.begin() + num);
+	result.percentile = temp[percentileIndex];
+
+	return result;
+}
@@ -0,0 +1,48 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * Processing time of a graph node, as a percentage of the block deadline.
+ * Each node is processed by a single thread per block, so every profiler has one writer
+ * and the history works as a per-thread buffer without any synchronization on the audio side.
+ */
+class NodeProfiler final {
+public:
+	NodeProfiler() = default;
+
+	struct Usage final {
+		float average = 0.f, max = 0.f, percentile = 0.f;
+	};
+
+	class Scope final {
+	public:
+		Scope() = delete;
+		Scope(NodeProfiler& profiler, int numSamples, double sampleRate);
+		~Scope();
+
+	private:
+		NodeProfiler& profiler;
+		const int numSamples;
+		const double sampleRate;
+		const juce::int64 startTicks;
+
+		JUCE_DECLARE_NON_COPYABLE(Scope)
+	};
+
+	void add(juce::int64 ticks, int numSamples, double sampleRate);
+
+	/**
+	 * @attention	Call this only on message thread.
+	 */
+	const Usage getUsage() const;
+
+	static constexpr int historySize = 256;
+	static constexpr double percentilePoint = 0.95;
+
+private:
+	std::array<std::atomic<float>, historySize> history{};
+	std::atomic_int writeIndex = 0, count = 0;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(NodeProfiler)
+};
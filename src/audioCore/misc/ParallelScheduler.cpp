@@ -0,0 +1,207 @@
+﻿#include "ParallelScheduler.h"
+
+ParallelScheduler::WorkQueue::WorkQueue()
+	: tasks(new std::atomic_int[ParallelScheduler::maxTaskNum]) {}
+
+void ParallelScheduler::WorkQueue::reset() {
+	this->top = 0;
+	this->bottom = 0;
+}
+
+void ParallelScheduler::WorkQueue::push(int task) {
+	int64_t b = this->bottom.load();
+	this->tasks[b % ParallelScheduler::maxTaskNum].store(task);
+	this->bottom.store(b + 1);
+}
+
+int ParallelScheduler::WorkQueue::take() {
+	int64_t b = this->bottom.load() - 1;
+	this->bottom.store(b);
+	int64_t t = this->top.load();
+
+	/** Empty */
+	if (t > b) {
+		this->bottom.store(b + 1);
+		return -1;
+	}
+
+	/** Get Task */
+	int task = this->tasks[b % ParallelScheduler::maxTaskNum].load();
+
+	/** Last Task Races With Thieves */
+	if (t == b) {
+		if (!this->top.compare_exchange_strong(t, t + 1)) {
+			task = -1;
+		}
+		this->bottom.store(b + 1);
+	}
+
+	return task;
+}
+
+int ParallelScheduler::WorkQueue::steal() {
+	int64_t t = this->top.load();
+	int64_t b = this->bottom.load();
+
+	/** Empty */
+	if (t >= b) { return -1; }
+
+	/** Get Task */
+	int task = this->tasks[t % ParallelScheduler::maxTaskNum].load();
+	if (!this->top.compare_exchange_strong(t, t + 1)) {
+		return -1;
+	}
+
+	return task;
+}
+
+ParallelScheduler::WorkerThread::WorkerThread(ParallelScheduler* parent, int index)
+	: Thread("Audio Worker " + juce::String(index)), parent(parent), index(index) {}
+
+void ParallelScheduler::WorkerThread::wakeUp() {
+	/** Never Release The Semaphore Twice Before The Worker Takes It */
+	if (!this->wakeUpRequested.exchange(true)) {
+		this->wakeUpSemaphore.release();
+	}
+}
+
+void ParallelScheduler::WorkerThread::stop() {
+	this->signalThreadShouldExit();
+	this->wakeUp();
+	this->stopThread(3000);
+}
+
+void ParallelScheduler::WorkerThread::run() {
+	while (!this->threadShouldExit()) {
+		/** Wait For Block */
+		this->wakeUpSemaphore.acquire();
+		this->wakeUpRequested = false;
+		if (this->threadShouldExit()) { break; }
+
+		/** Process Tasks */
+		this->parent->activeNum++;
+		if (auto job = this->parent->currentJob.load()) {
+			this->parent->runTasks(*job, this->index);
+		}
+		this->parent->activeNum--;
+	}
+}
+
+ParallelScheduler::ParallelScheduler()
+	: pendingNum(new std::atomic_int[ParallelScheduler::maxTaskNum]) {
+	this->setThreadNum(0);
+}
+
+ParallelScheduler::~ParallelScheduler() {
+	this->stopThreads();
+}
+
+void ParallelScheduler::setThreadNum(int num) {
+	/** Limit Num */
+	num = juce::jlimit(0, std::max(juce::SystemStats::getNumCpus() - 1, 0), num);
+
+	/** Stop Current Threads */
+	this->stopThreads();
+
+	/** Create Queues */
+	this->queues.clear();
+	for (int i = 0; i < num + 1; i++) {
+		this->queues.add(std::make_unique<WorkQueue>());
+	}
+
+	/** Create Threads */
+	for (int i = 0; i < num; i++) {
+		auto thread = std::make_unique<WorkerThread>(this, i + 1);
+		thread->startRealtimeThread(juce::Thread::RealtimeOptions{});
+		this->threads.add(std::move(thread));
+	}
+}
+
+int ParallelScheduler::getThreadNum() const {
+	return this->threads.size();
+}
+
+void ParallelScheduler::process(const TaskGraph& graph, TaskFunc& func) {
+	/** Check Size */
+	int taskNum = graph.predecessorNum.size();
+	if (taskNum <= 0) { return; }
+	if (taskNum > ParallelScheduler::maxTaskNum) { jassertfalse; return; }
+
+	/** Reset State */
+	for (auto i : this->queues) {
+		i->reset();
+	}
+	this->remainingNum = taskNum;
+
+	/** Spread Ready Tasks Over Queues Before Workers Wake */
+	int queueNum = this->queues.size();
+	int readyNum = 0;
+	for (int i = 0; i < taskNum; i++) {
+		int num = graph.predecessorNum.getUnchecked(i);
+		this->pendingNum[i] = num;
+		if (num == 0) {
+			this->queues.getUnchecked(readyNum % queueNum)->push(i);
+			readyNum++;
+		}
+	}
+
+	/** Wake Workers */
+	this->jobTemp = { &graph, &func };
+	this->currentJob = &(this->jobTemp);
+	int wakeNum = std::min(this->threads.size(), taskNum - 1);
+	for (int i = 0; i < wakeNum; i++) {
+		this->threads.getUnchecked(i)->wakeUp();
+	}
+
+	/** Process On Current Thread */
+	this->runTasks(this->jobTemp, 0);
+
+	/** Wait For Workers Leaving The Job */
+	this->currentJob = nullptr;
+	while (this->activeNum.load() > 0) {
+		juce::Thread::yield();
+	}
+}
+
+void ParallelScheduler::runTasks(const Job& job, int queueIndex) {
+	auto queue = this->queues.getUnchecked(queueIndex);
+
+	while (this->remainingNum.load() > 0) {
+		/** Get Task */
+		int task = queue->take();
+		if (task < 0) {
+			task = this->findTask(queueIndex);
+		}
+		if (task < 0) {
+			juce::Thread::yield();
+			continue;
+		}
+
+		/** Process Task */
+		(*job.func)(task);
+
+		/** Release Successors */
+		for (auto i : job.graph->successors.getReference(task)) {
+			if (--(this->pendingNum[i]) == 0) {
+				queue->push(i);
+			}
+		}
+		this->remainingNum--;
+	}
+}
+
+int ParallelScheduler::findTask(int queueIndex) {
+	int queueNum = this->queues.size();
+	for (int i = 1; i < queueNum; i++) {
+		int task = this->queues.getUnchecked((queueIndex + i) % queueNum)->steal();
+		if (task > -1) { return task; }
+	}
+	return -1;
+}
+
+void ParallelScheduler::stopThreads() {
+	for (auto i : this->threads) {
+		i->stop();
+	}
+	this->threads.clear();
+}
@@ -0,0 +1,91 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+#include <semaphore>
+
+class ParallelScheduler final {
+public:
+	ParallelScheduler();
+	~ParallelScheduler();
+
+	/**
+	 * Tasks with their successors and the number of tasks each one waits for.
+	 */
+	struct TaskGraph final {
+		juce::Array<int> predecessorNum;
+		juce::Array<juce::Array<int>> successors;
+	};
+	using TaskFunc = juce::dsp::FixedSizeFunction<64, void(int)>;
+
+	/**
+	 * @brief	Set the number of worker threads besides the caller of process().
+	 * @attention	Don't call this while process() is running.
+	 */
+	void setThreadNum(int num);
+	int getThreadNum() const;
+
+	/**
+	 * @brief	Run every task once in dependency order and return when all tasks are finished.
+	 * @attention	Call this only on audio thread.
+	 */
+	void process(const TaskGraph& graph, TaskFunc& func);
+
+	static constexpr int maxTaskNum = 4096;
+
+private:
+	/** Fixed size Chase-Lev deque. The owner pushes and takes at the bottom, thieves steal from the top. */
+	class WorkQueue final {
+	public:
+		WorkQueue();
+
+		void reset();
+		void push(int task);
+		int take();
+		int steal();
+
+	private:
+		std::unique_ptr<std::atomic_int[]> tasks;
+		std::atomic_int64_t top = 0, bottom = 0;
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WorkQueue)
+	};
+
+	class WorkerThread final : public juce::Thread {
+	public:
+		WorkerThread() = delete;
+		WorkerThread(ParallelScheduler* parent, int index);
+
+		void wakeUp();
+		void stop();
+
+		void run() override;
+
+	private:
+		ParallelScheduler* const parent;
+		const int index;
+		std::binary_semaphore wakeUpSemaphore{ 0 };
+		std::atomic_bool wakeUpRequested = false;
+
+		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(WorkerThread)
+	};
+
+	struct Job final {
+		const TaskGraph* graph = nullptr;
+		TaskFunc* func = nullptr;
+	};
+
+	juce::OwnedArray<WorkerThread> threads;
+	juce::OwnedArray<WorkQueue> queues;
+	std::unique_ptr<std::atomic_int[]> pendingNum;
+
+	Job jobTemp;
+	std::atomic<const Job*> currentJob = nullptr;
+	std::atomic_int remainingNum = 0;
+	std::atomic_int activeNum = 0;
+
+	void runTasks(const Job& job, int queueIndex);
+	int findTask(int queueIndex);
+	void stopThreads();
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ParallelScheduler)
+};
@@ -9,9 +9,17 @@ juce::Optional<juce::AudioPlayHead::PositionInfo> MovablePlayHead::getPosition()
 	std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
 	std::chrono::nanoseconds ns
 		= std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch());
-	this->position.setHostTimeNs((uint64_t)ns.count());
+	auto result = this->position;
+	result.setHostTimeNs((uint64_t)ns.count());
+
+	/** Rendering Ahead Of The Transport */
+	if (MovablePlayHead::threadPosition >= 0) {
+		result.setTimeInSamples(MovablePlayHead::threadPosition);
+		AudioSnapshot<TempoTemp>::Reader tempo(this->tempoSnapshot);
+		MovablePlayHead::updatePositionByTimeInSample(result, *tempo, this->sampleRate);
+	}
 
-	return juce::makeOptional(this->position);
+	return juce::makeOptional(result);
 }
 
 bool MovablePlayHead::canControlTransport() {
@@ -184,6 +192,10 @@ void MovablePlayHead::updateTempoTemp() {
 	juce::ScopedWriteLock locker(audioLock::getPositionLock());
 	this->tempoTemp.update(this->tempos);
 
+	auto snapshot = std::make_unique<TempoTemp>();
+	snapshot->update(this->tempos);
+	this->tempoSnapshot.publish(std::move(snapshot));
+
 	UICallbackAPI<void>::invoke(UICallbackType::TempoChanged);
 }
 
@@ -243,6 +255,10 @@ bool MovablePlayHead::checkOverflow() const {
 	return this->overflowFlag;
 }
 
+void MovablePlayHead::setThreadPositionInSamples(int64_t sampleNum) {
+	MovablePlayHead::threadPosition = sampleNum;
+}
+
 int MovablePlayHead::addTempoLabelTempo(
 	double time, double tempo, int newIndex) {
 	/** Insert Label */
@@ -421,15 +437,36 @@ void MovablePlayHead::updatePositionByTimeInSecond() {
 }
 
 void MovablePlayHead::updatePositionByTimeInSample() {
-	uint64_t sample = this->position.getTimeInSamples().orFallback(0);
+	this->updatePositionByTimeInSample(this->position);
+}
+
+void MovablePlayHead::updatePositionByTimeInSample(juce::AudioPlayHead::PositionInfo& info) const {
+	uint64_t sample = info.getTimeInSamples().orFallback(0);
 	double time = sample / this->sampleRate;
-	this->position.setTimeInSeconds(time);
+	info.setTimeInSeconds(time);
 	double timeQuarter = this->toQuarter(time);
-	this->position.setPpqPosition(timeQuarter);
+	info.setPpqPosition(timeQuarter);
 
 	auto [barCount, barPpq] = this->toBarQ(timeQuarter);
-	this->position.setBarCount(barCount);
-	this->position.setPpqPositionOfLastBarStart(barPpq);
+	info.setBarCount(barCount);
+	info.setPpqPositionOfLastBarStart(barPpq);
+}
+
+void MovablePlayHead::updatePositionByTimeInSample(juce::AudioPlayHead::PositionInfo& info,
+	const TempoTemp& tempo, double sampleRate) {
+	uint64_t sample = info.getTimeInSamples().orFallback(0);
+	double time = sample / sampleRate;
+	info.setTimeInSeconds(time);
+	int tempIndex = tempo.selectBySec(time);
+	double timeQuarter = tempo.secToQuarter(time, tempIndex);
+	info.setPpqPosition(timeQuarter);
+
+	double timeBar = tempo.quarterToBar(timeQuarter, tempIndex);
+	double quarterPerBar = tempo.getQuarterPerBar(tempIndex);
+	int barCount = std::floor(timeBar);
+	double quarterInBar = (timeBar - barCount) * quarterPerBar;
+	info.setBarCount(barCount);
+	info.setPpqPositionOfLastBarStart(timeQuarter - quarterInBar);
 }
 
 int MovablePlayHead::getTempoInsertIndex(double time) const {
@@ -509,6 +546,8 @@ int MovablePlayHead::getBeatTypeLabelIndex(int typeIndex) const {
 	return -1;
 }
 
+thread_local int64_t MovablePlayHead::threadPosition = -1;
+
 PlayPosition* PlayPosition::getInstance() {
 	return PlayPosition::instance ? PlayPosition::instance : (PlayPosition::instance = new PlayPosition());
 }
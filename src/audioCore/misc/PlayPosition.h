@@ -2,6 +2,7 @@
 
 #include <JuceHeader.h>
 #include "TempoTemp.h"
+#include "AudioSnapshot.h"
 
 class MovablePlayHead : public juce::AudioPlayHead {
 public:
@@ -52,6 +53,12 @@ public:
 	void setOverflow();
 	bool checkOverflow() const;
 
+	/**
+	 * @brief	Let processors on the calling thread see the transport at another sample position.
+	 * @attention	Pass -1 to follow the transport again.
+	 */
+	static void setThreadPositionInSamples(int64_t sampleNum);
+
 	int addTempoLabelTempo(double time, double tempo, int newIndex = -1);
 	int addTempoLabelBeat(double time, int numerator, int denominator, int newIndex = -1);
 	void removeTempoLabel(int index);
@@ -76,6 +83,8 @@ protected:
 	mutable juce::AudioPlayHead::PositionInfo position;
 	juce::Array<juce::MidiMessage> tempos;
 	TempoTemp tempoTemp;
+	/** Published Copy Of The Tempo Temp For Threads Rendering Without The Position Lock */
+	AudioSnapshot<TempoTemp> tempoSnapshot;
 	std::atomic_short timeFormat = 480;
 	std::atomic<double> sampleRate = 48000;
 	std::atomic_bool overflowFlag = false;
@@ -88,6 +97,11 @@ protected:
 
 	void updatePositionByTimeInSecond();
 	void updatePositionByTimeInSample();
+	void updatePositionByTimeInSample(juce::AudioPlayHead::PositionInfo& info) const;
+	static void updatePositionByTimeInSample(juce::AudioPlayHead::PositionInfo& info,
+		const TempoTemp& tempo, double sampleRate);
+
+	static thread_local int64_t threadPosition;
 
 private:
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MovablePlayHead)
@@ -0,0 +1,67 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * Fixed size single producer single consumer queue.
+ * The audio thread pushes without locking or allocating, the message thread drains it.
+ * Items pushed while the queue is full are dropped and counted.
+ */
+template<typename T, int Capacity>
+class RealtimeFifo final {
+public:
+	RealtimeFifo() = default;
+
+	/**
+	 * @attention	Call this only on the producer thread.
+	 */
+	bool push(const T& item) {
+		int start1 = 0, size1 = 0, start2 = 0, size2 = 0;
+		this->fifo.prepareToWrite(1, start1, size1, start2, size2);
+		if (size1 + size2 < 1) {
+			this->overflowNum.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		this->data[(size1 > 0) ? start1 : start2] = item;
+		this->fifo.finishedWrite(1);
+		return true;
+	};
+
+	/**
+	 * @brief	Count an item the producer couldn't push.
+	 */
+	void addOverflow() {
+		this->overflowNum.fetch_add(1, std::memory_order_relaxed);
+	};
+
+	/**
+	 * @brief	Pass every queued item to the function in push order.
+	 * @attention	Call this only on the consumer thread.
+	 */
+	template<typename Func>
+	void drain(Func&& func) {
+		int start1 = 0, size1 = 0, start2 = 0, size2 = 0;
+		this->fifo.prepareToRead(this->fifo.getNumReady(), start1, size1, start2, size2);
+
+		for (int i = 0; i < size1; i++) {
+			func(this->data[start1 + i]);
+		}
+		for (int i = 0; i < size2; i++) {
+			func(this->data[start2 + i]);
+		}
+
+		this->fifo.finishedRead(size1 + size2);
+	};
+
+	uint64_t getOverflowNum() const {
+		return this->overflowNum.load(std::memory_order_relaxed);
+	};
+
+private:
+	juce::AbstractFifo fifo{ Capacity };
+	std::array<T, Capacity> data{};
+	std::atomic_uint64_t overflowNum = 0;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RealtimeFifo)
+};
@@ -0,0 +1,83 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * Fixed size multiple producer single consumer queue.
+ * Any thread pushes without locking or allocating, the audio thread drains it.
+ * Each slot carries a sequence number, so a producer only claims a slot with one compare and swap
+ * and the consumer never sees a slot before its producer finished writing it.
+ * Items pushed while the queue is full are dropped and counted.
+ */
+template<typename T, int Capacity>
+class RealtimeMPSCFifo final {
+	static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+
+public:
+	RealtimeMPSCFifo() {
+		for (int i = 0; i < Capacity; i++) {
+			this->slots[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	};
+
+	bool push(const T& item) {
+		auto pos = this->writePos.load(std::memory_order_relaxed);
+		while (true) {
+			auto& slot = this->slots[pos & (Capacity - 1)];
+			auto sequence = slot.sequence.load(std::memory_order_acquire);
+			auto diff = (int64_t)sequence - (int64_t)pos;
+
+			/** Slot Free, Try To Claim It */
+			if (diff == 0) {
+				if (this->writePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					slot.item = item;
+					slot.sequence.store(pos + 1, std::memory_order_release);
+					return true;
+				}
+			}
+
+			/** Full */
+			else if (diff < 0) {
+				this->overflowNum.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+
+			/** Another Producer Claimed It */
+			else {
+				pos = this->writePos.load(std::memory_order_relaxed);
+			}
+		}
+	};
+
+	/**
+	 * @brief	Pass every queued item to the function in push order.
+	 * @attention	Call this only on the consumer thread.
+	 */
+	template<typename Func>
+	void drain(Func&& func) {
+		while (true) {
+			auto& slot = this->slots[this->readPos & (Capacity - 1)];
+			if (slot.sequence.load(std::memory_order_acquire) != this->readPos + 1) { break; }
+
+			func(slot.item);
+			slot.sequence.store(this->readPos + Capacity, std::memory_order_release);
+			this->readPos++;
+		}
+	};
+
+	uint64_t getOverflowNum() const {
+		return this->overflowNum.load(std::memory_order_relaxed);
+	};
+
+private:
+	struct Slot final {
+		std::atomic_uint64_t sequence = 0;
+		T item{};
+	};
+	std::array<Slot, Capacity> slots;
+	std::atomic_uint64_t writePos = 0;
+	uint64_t readPos = 0;
+	std::atomic_uint64_t overflowNum = 0;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RealtimeMPSCFifo)
+};
@@ -0,0 +1,211 @@
+﻿#include "RenderCache.h"
+
+#include "../graph/MainGraph.h"
+#include "../source/SourceManager.h"
+
+const juce::String RenderCache::getTrackFingerprint(
+	MainGraph* graph, int trackIndex, const juce::String& settings) {
+	if (!graph) { return {}; }
+	if (trackIndex < 0 || trackIndex >= graph->getTrackNum()) { return {}; }
+
+	juce::MemoryOutputStream stream;
+	stream.writeString(settings);
+
+	/** Walk Every Track Upstream, Sums Depend On All Their Inputs */
+	juce::Array<int> tracks{ trackIndex };
+	juce::Array<int> sources;
+	for (int i = 0; i < tracks.size(); i++) {
+		int index = tracks.getUnchecked(i);
+
+		/** Live Input Isn't Known Before Rendering */
+		if (!graph->getTrackInputFromDeviceConnections(index).isEmpty()
+			|| !graph->getTrackMidiInputFromDeviceConnections(index).isEmpty()) {
+			return {};
+		}
+
+		if (!RenderCache::writeTrack(stream, graph, index)) { return {}; }
+
+		for (auto& [src, srcc, dst, dstc] : graph->getTrackInputFromTrackConnections(index)) {
+			stream.writeInt(src);
+			stream.writeInt(srcc);
+			stream.writeInt(dstc);
+			tracks.addIfNotAlreadyThere(src);
+		}
+		for (auto& [src, srcc, dst, dstc] : graph->getTrackInputFromSrcConnections(index)) {
+			stream.writeInt(src);
+			stream.writeInt(srcc);
+			stream.writeInt(dstc);
+			sources.addIfNotAlreadyThere(src);
+		}
+		for (auto& [src, dst] : graph->getTrackMidiInputFromSrcConnections(index)) {
+			stream.writeInt(src);
+			sources.addIfNotAlreadyThere(src);
+		}
+	}
+
+	/** Sources Feeding Those Tracks */
+	for (auto i : sources) {
+		if (!RenderCache::writeSource(stream, graph, i)) { return {}; }
+	}
+
+	return juce::SHA256{ stream.getMemoryBlock() }.toHexString();
+}
+
+bool RenderCache::restore(int trackIndex, const juce::String& fingerprint, const juce::File& file) const {
+	if (fingerprint.isEmpty()) { return false; }
+
+	juce::GenericScopedLock locker(this->lock);
+
+	auto it = this->stems.find(trackIndex);
+	if (it == this->stems.end()) { return false; }
+
+	auto& [cachedFingerprint, cacheFile] = it->second;
+	if (cachedFingerprint != fingerprint || !cacheFile.existsAsFile()) { return false; }
+
+	if (file.exists()) {
+		file.deleteFile();
+	}
+	return cacheFile.copyFileTo(file);
+}
+
+bool RenderCache::store(int trackIndex, const juce::String& fingerprint,
+	const juce::File& file, const juce::File& cacheDir) {
+	if (fingerprint.isEmpty() || !file.existsAsFile()) { return false; }
+
+	juce::GenericScopedLock locker(this->lock);
+
+	/** One Stem For Each Track */
+	this->stems.erase(trackIndex);
+
+	if (!cacheDir.isDirectory() && !cacheDir.createDirectory()) { return false; }
+	auto cacheFile = utils::getRenderCacheFile(
+		cacheDir.getFullPathName(), trackIndex, file.getFileExtension());
+	if (cacheFile.exists()) {
+		cacheFile.deleteFile();
+	}
+	if (!file.copyFileTo(cacheFile)) { return false; }
+
+	this->stems.insert(std::make_pair(trackIndex, std::make_tuple(fingerprint, cacheFile)));
+	return true;
+}
+
+void RenderCache::clear() {
+	juce::GenericScopedLock locker(this->lock);
+	this->stems.clear();
+}
+
+bool RenderCache::writeTrack(juce::OutputStream& stream, MainGraph* graph, int index) {
+	auto track = graph->getTrackProcessor(index);
+	if (!track) { return false; }
+
+	stream.writeInt(index);
+	stream.writeString(track->getAudioChannelSet().getSpeakerArrangementAsString());
+	stream.writeInt(track->getAdditionalAudioBusNum());
+	stream.writeBool(graph->getTrackBypass(index));
+	stream.writeBool(track->getMute());
+	stream.writeFloat(track->getGain());
+	stream.writeFloat(track->getPan());
+	stream.writeFloat(track->getSlider());
+
+	/** Automation */
+	for (int type = 0; type < (int)Track::AutomationType::TypeNum; type++) {
+		auto automationType = (Track::AutomationType)type;
+		int pointNum = track->getAutomationPointNum(automationType);
+		stream.writeInt(pointNum);
+		for (int i = 0; i < pointNum; i++) {
+			auto point = track->getAutomationPoint(automationType, i);
+			stream.writeDouble(point.time);
+			stream.writeFloat(point.value);
+		}
+	}
+
+	/** Effects */
+	if (auto pluginDock = track->getPluginDock()) {
+		stream.writeInt(pluginDock->getPluginNum());
+		for (int i = 0; i < pluginDock->getPluginNum(); i++) {
+			if (!RenderCache::writePlugin(stream,
+				pluginDock->getPluginProcessor(i), pluginDock->getPluginBypass(i))) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool RenderCache::writeSource(juce::OutputStream& stream, MainGraph* graph, int index) {
+	auto source = graph->getSourceProcessor(index);
+	if (!source) { return false; }
+
+	/** Live Input Isn't Known Before Rendering */
+	if (!graph->getSourceInputFromDeviceConnections(index).isEmpty()
+		|| !graph->getSourceMidiInputFromDeviceConnections(index).isEmpty()) {
+		return false;
+	}
+
+	stream.writeInt(index);
+	stream.writeString(source->getAudioChannelSet().getSpeakerArrangementAsString());
+	stream.writeBool(graph->getSourceBypass(index));
+	stream.writeBool(source->getMute());
+
+	/** Source Data */
+	auto manager = SourceManager::getInstance();
+	stream.writeInt64((juce::int64)manager->getVersion(
+		source->getAudioRef(), SourceManager::SourceType::Audio));
+	stream.writeInt64((juce::int64)manager->getVersion(
+		source->getMIDIRef(), SourceManager::SourceType::MIDI));
+	stream.writeInt(source->getCurrentMIDITrack());
+
+	/** Blocks */
+	stream.writeInt(source->getSeqNum());
+	for (int i = 0; i < source->getSeqNum(); i++) {
+		auto [startTime, endTime, offset] = source->getSeq(i);
+		stream.writeDouble(startTime);
+		stream.writeDouble(endTime);
+		stream.writeDouble(offset);
+	}
+
+	/** Instrument */
+	stream.writeBool(source->getInstrOffline());
+	stream.writeBool(source->getFrozen());
+	if (auto instr = source->getInstrProcessor()) {
+		if (!RenderCache::writePlugin(stream, instr, source->getInstrumentBypass())) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool RenderCache::writePlugin(juce::OutputStream& stream, PluginDecorator* plugin, bool bypassed) {
+	if (!plugin) {
+		stream.writeString({});
+		return true;
+	}
+
+	/** The Plugin Keeps Its Own Copy Of The Audio */
+	if (plugin->isARAValid()) { return false; }
+
+	stream.writeString(plugin->getPluginIdentifier());
+	stream.writeBool(bypassed);
+	stream.writeInt(plugin->getMIDIChannel());
+	stream.writeBool(plugin->getMIDICCIntercept());
+
+	/** State */
+	juce::MemoryBlock state;
+	plugin->getStateInformation(state);
+	stream.writeInt64((juce::int64)state.getSize());
+	stream.write(state.getData(), state.getSize());
+
+	/** MIDI CC */
+	int paramNum = plugin->getPluginParamList().size();
+	stream.writeInt(paramNum);
+	for (int i = 0; i < paramNum; i++) {
+		stream.writeInt(plugin->getParamCCConnection(i));
+	}
+
+	/** Automation */
+	stream.writeString(juce::JSON::toString(plugin->getAutomationData(), true));
+
+	return true;
+}
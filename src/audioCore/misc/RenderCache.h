@@ -0,0 +1,45 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+
+class MainGraph;
+class PluginDecorator;
+
+/**
+ * Keeps the last rendered stem of each track together with the fingerprint of everything it was rendered from.
+ * While the fingerprint doesn't change, the stem is copied from the cache instead of encoded again.
+ */
+class RenderCache final {
+public:
+	RenderCache() = default;
+
+	/**
+	 * @brief	Get the fingerprint of the track and of every source, track and connection feeding it.
+	 * @attention	Call this on the message thread. Empty if the output can't be known before rendering,
+	 *			like tracks fed by devices or ARA plugins.
+	 */
+	static const juce::String getTrackFingerprint(
+		MainGraph* graph, int trackIndex, const juce::String& settings);
+
+	/**
+	 * @brief	Copy the cached stem of the track to the file if it was rendered with the same fingerprint.
+	 */
+	bool restore(int trackIndex, const juce::String& fingerprint, const juce::File& file) const;
+	/**
+	 * @brief	Keep a copy of the rendered stem in the cache directory.
+	 */
+	bool store(int trackIndex, const juce::String& fingerprint,
+		const juce::File& file, const juce::File& cacheDir);
+	void clear();
+
+private:
+	juce::CriticalSection lock;
+	/** Fingerprint, Cache File */
+	std::map<int, std::tuple<juce::String, juce::File>> stems;
+
+	static bool writeTrack(juce::OutputStream& stream, MainGraph* graph, int index);
+	static bool writeSource(juce::OutputStream& stream, MainGraph* graph, int index);
+	static bool writePlugin(juce::OutputStream& stream, PluginDecorator* plugin, bool bypassed);
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RenderCache)
+};
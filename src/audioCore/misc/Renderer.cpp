@@ -6,6 +6,7 @@
 #include "../plugin/PluginLoader.h"
 #include "../misc/VMath.h"
 #include "../misc/AudioLock.h"
+#include "../uiCallback/UICallback.h"
 
 class RenderThread final : public juce::Thread {
 public:
@@ -31,6 +32,24 @@ private:
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RenderThread)
 };
 
+class StemEncodeJob final : public juce::ThreadPoolJob {
+public:
+	StemEncodeJob() = delete;
+	StemEncodeJob(Renderer* renderer, StemWriter* stem, int id);
+
+	JobStatus runJob() override;
+
+private:
+	Renderer* const renderer = nullptr;
+	StemWriter* const stem = nullptr;
+	const int id = -1;
+	double lastProgress = -1;
+
+	void reportProgress(double progress);
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StemEncodeJob)
+};
+
 RenderThread::RenderThread(Renderer* renderer)
 	: Thread("Render Thread"), renderer(renderer) {}
 
@@ -57,11 +76,22 @@ void RenderThread::run() {
 	/** Reset Play Head State */
 	AudioCore::getInstance()->stop();
 
+	/** Copy Unchanged Stems From The Render Cache */
+	bool needRender = this->renderer->restoreCachedStems(this->dir, this->name, this->extension);
+
+	/** Buffers Reused By Every Block */
+	int blockSize = this->renderer->getCurrentRenderBlockSize();
+	int channels = std::max({ mainGraph->getTotalNumInputChannels(),
+		mainGraph->getTotalNumOutputChannels(), 1 });
+	juce::AudioSampleBuffer audio(channels, blockSize);
+	juce::MidiBuffer midi;
+	midi.ensureSize(4096);
+
 	/** Buffer Audio */
-	{
+	if (needRender) {
 		double bufferArea = this->renderer->audioBufferArea;
 		int bufferLength = bufferArea * this->renderer->sampleRate;
-		int bufferBlockNum = std::ceil(bufferLength / this->renderer->bufferSize);
+		int bufferBlockNum = (bufferLength + blockSize - 1) / blockSize;
 
 		for (int i = 0; i < bufferBlockNum; i++) {
 			/** Stop */
@@ -70,14 +100,19 @@ void RenderThread::run() {
 			}
 
 			/** Render */
-			juce::AudioSampleBuffer audio(1, this->renderer->bufferSize);
-			juce::MidiBuffer midi;
+			vMath::zeroAllAudioData(audio);
+			midi.clear();
 			mainGraph->processBlock(audio, midi);
 		}
 	}
 
+	/** Render Range With Pre-Roll */
+	double sampleRate = this->renderer->sampleRate;
+	double startTime = this->renderer->rangeStartTime;
+	double preRollStartTime = std::max(startTime - this->renderer->preRollTime, 0.0);
+
 	/** Set Play Head State */
-	AudioCore::getInstance()->setPositon(0);
+	AudioCore::getInstance()->setPositon(preRollStartTime);
 	AudioCore::getInstance()->play();
 
 	/** Rendering Mode */
@@ -87,44 +122,131 @@ void RenderThread::run() {
 	juce::ScopedReadLock sourceLocker(audioLock::getSourceLock());
 	double totalLength = mainGraph->getTailLengthSeconds();
 	totalLength = std::min(totalLength, INT_MAX / PlayPosition::getInstance()->getSampleRate());
+	double endTime = std::min(this->renderer->rangeEndTime, totalLength);
 
 	/** Reset Play Position */
-	PlayPosition::getInstance()->setPositionInSamples(0);
+	PlayPosition::getInstance()->setPositionInSamples(std::llround(preRollStartTime * sampleRate));
+
+	/** Output Length Doesn't Depend On Block Size */
+	{
+		juce::GenericScopedLock locker(this->renderer->lock);
+		this->renderer->renderStart = std::llround(startTime * sampleRate);
+		this->renderer->renderLength = std::max((int)std::ceil((endTime - startTime) * sampleRate), 0);
+	}
+
+	/** Stream Stems To Files While Rendering */
+	this->renderer->openFiles(this->dir, this->name, this->extension,
+		this->metaData, this->bitDepth, this->quality);
 
 	/** Render Each Block */
+	auto startTicks = juce::Time::getHighResolutionTicks();
 	juce::GenericScopedLock graphLocker(mainGraph->getCallbackLock());
-	while (PlayPosition::getInstance()->getPosition()
-		->getTimeInSeconds().orFallback(0) < totalLength) {
+	while (needRender && PlayPosition::getInstance()->getPosition()
+		->getTimeInSeconds().orFallback(0) < endTime) {
 		/** Stop */
 		if (juce::Thread::currentThreadShouldExit()) {
 			break;
 		}
 
 		/** Render */
-		juce::AudioSampleBuffer audio(1, this->renderer->bufferSize);
-		juce::MidiBuffer midi;
+		vMath::zeroAllAudioData(audio);
+		midi.clear();
 		mainGraph->processBlock(audio, midi);
 	}
 
+	/** Stopped Before The End */
+	bool aborted = juce::Thread::currentThreadShouldExit();
+
+	/** Realtime Factor */
+	double renderedLength = std::max(std::min(endTime, PlayPosition::getInstance()->getPosition()
+		->getTimeInSeconds().orFallback(0)) - preRollStartTime, 0.0);
+	this->renderer->setLastRenderTime(renderedLength, juce::Time::highResolutionTicksToSeconds(
+		juce::Time::getHighResolutionTicks() - startTicks));
+
 	/** Reset Rendering Mode */
 	this->renderer->setRendering(false);
 
 	/** Unisolate Main Graph */
 	juce::MessageManager::callAsync(
-		[] {
+		[threadNum = this->renderer->lastParallelThreadNum] {
 			if (auto ac = AudioCore::getInstanceWithoutCreate()) {
 				ac->stop();
+
+				/** Back To Realtime Processing */
+				if (auto graph = ac->getGraph()) {
+					juce::ScopedWriteLock locker(audioLock::getAudioLock());
+					graph->setNonRealtime(false);
+					graph->setParallelThreadNum(threadNum);
+				}
+
+				/** The Player Prepares The Graph With The Device Buffer Size Again */
 				ac->setIsolation(false);
 			}});
 	
 	/** Save Audio */
-	this->renderer->saveFile(this->dir, this->name, this->extension,
-		this->metaData, this->bitDepth, this->quality);
+	if (aborted) {
+		this->renderer->abortFiles();
+	}
+	else if (this->renderer->saveFile()) {
+		this->renderer->storeCachedStems();
+	}
 
 	/** Clear Buffer */
 	this->renderer->releaseBuffer();
 }
 
+StemEncodeJob::StemEncodeJob(Renderer* renderer, StemWriter* stem, int id)
+	: ThreadPoolJob("Stem Encode Job"), renderer(renderer), stem(stem), id(id) {}
+
+StemEncodeJob::JobStatus StemEncodeJob::runJob() {
+	/** Check Stem */
+	if (!this->renderer || !this->stem) { return JobStatus::jobHasFinished; }
+
+	/** Encode Ready Samples */
+	int encodedNum = 0;
+	while (!this->shouldExit()) {
+		int num = this->stem->drain();
+		if (num <= 0) { break; }
+		encodedNum += num;
+	}
+
+	/** Cancelled, The Renderer Deletes The File */
+	if (this->shouldExit()) {
+		return JobStatus::jobHasFinished;
+	}
+
+	/** Progress */
+	int64_t totalLength = this->stem->getTotalLength();
+	if (encodedNum > 0 && totalLength > 0) {
+		this->reportProgress(this->stem->getWrittenNum() / (double)totalLength);
+	}
+
+	/** The Track Pushes Nothing After Finishing Is Set */
+	if (this->renderer->encodeFinishing && this->stem->isDrained()) {
+		this->stem->close();
+		this->reportProgress(1.0);
+		this->renderer->encodeEvent.signal();
+		return JobStatus::jobHasFinished;
+	}
+
+	/** Let Other Stems Run When The Pool Has Fewer Threads Than Stems */
+	if (encodedNum <= 0) {
+		this->stem->waitForData(5);
+	}
+	return JobStatus::jobNeedsRunningAgain;
+}
+
+void StemEncodeJob::reportProgress(double progress) {
+	/** Limit Message Rate */
+	if (progress < 1.0 && progress - this->lastProgress < 0.01) { return; }
+	this->lastProgress = progress;
+
+	juce::MessageManager::callAsync(
+		[id = this->id, progress] {
+			UICallbackAPI<int, double>::invoke(UICallbackType::RenderProgress, id, progress);
+		});
+}
+
 Renderer::Renderer() {
 	/** Render Thread */
 	this->renderThread = std::unique_ptr<juce::Thread>(new RenderThread(this));
@@ -134,11 +256,15 @@ Renderer::~Renderer() {
 	if (this->renderThread) {
 		this->renderThread->stopThread(3000);
 	}
+	if (this->encoderPool) {
+		this->encoderPool->removeAllJobs(true, 3000);
+	}
 }
 
 bool Renderer::start(const juce::Array<int>& tracks, const juce::String& path,
 	const juce::String& name, const juce::String& extension,
-	const juce::StringPairArray& metaData, int bitDepth, int quality) {
+	const juce::StringPairArray& metaData, int bitDepth, int quality,
+	double startTime, double endTime, double preRollTime, bool snapToBlocks) {
 	/** Async Protection */
 	if (PluginLoader::getInstance()->isRunning()) { return false; }
 
@@ -151,6 +277,13 @@ bool Renderer::start(const juce::Array<int>& tracks, const juce::String& path,
 	auto graph = AudioCore::getInstance()->getGraph();
 	if (!graph) { return false; }
 
+	/** Freezing Instruments Are Rendered Off The Graph */
+	for (int i = 0; i < graph->getSourceNum(); i++) {
+		if (auto seq = graph->getSourceProcessor(i)) {
+			if (seq->isFreezing()) { return false; }
+		}
+	}
+
 	Renderer::RenderTaskList tasks;
 	for (auto& i : tracks) {
 		if (i >= 0 && i < graph->getTrackNum()) {
@@ -167,6 +300,16 @@ bool Renderer::start(const juce::Array<int>& tracks, const juce::String& path,
 		return false;
 	}
 
+	/** Render Range */
+	auto [rangeStart, rangeEnd] = Renderer::getRenderRange(startTime, endTime, snapToBlocks);
+	if (rangeEnd <= rangeStart) { return false; }
+	{
+		juce::GenericScopedLock locker(this->lock);
+		this->rangeStartTime = rangeStart;
+		this->rangeEndTime = rangeEnd;
+		this->preRollTime = std::max(preRollTime, 0.0);
+	}
+
 	/** Prepare Thread */
 	if (auto thread = dynamic_cast<RenderThread*>(this->renderThread.get())) {
 		thread->prepare(dir, name, extension,
@@ -178,6 +321,7 @@ bool Renderer::start(const juce::Array<int>& tracks, const juce::String& path,
 
 	/** Set Tasks */
 	this->prepareToRender(tasks);
+	this->prepareCache(extension, metaData, bitDepth, quality);
 
 	/** Isolate Main Graph */
 	AudioCore::getInstance()->setIsolation(true);
@@ -187,14 +331,25 @@ bool Renderer::start(const juce::Array<int>& tracks, const juce::String& path,
 	AudioCore::getInstance()->stop();
 
 	/** Prepare Main Graph */
+	int blockSize = this->getCurrentRenderBlockSize();
 	{
 		juce::GenericScopedLock locker(this->lock);
-		graph->prepareToPlay(this->sampleRate, this->bufferSize);
+		graph->setNonRealtime(true);
+		graph->prepareToPlay(this->sampleRate, blockSize);
+	}
+
+	/** Render Tracks On Every Core */
+	{
+		juce::ScopedWriteLock locker(audioLock::getAudioLock());
+		this->lastParallelThreadNum = graph->getParallelThreadNum();
+		graph->setParallelThreadNum(juce::SystemStats::getNumCpus() - 1);
+		this->lastRenderThreadNum = graph->getParallelThreadNum() + 1;
+		this->lastRenderBlockSize = blockSize;
 	}
 
 	/** Process Block To Close All MIDI Notes */
 	{
-		juce::AudioSampleBuffer audio(1, this->bufferSize);
+		juce::AudioSampleBuffer audio(1, blockSize);
 		juce::MidiBuffer midi;
 		graph->processBlock(audio, midi);
 	}
@@ -218,18 +373,7 @@ void Renderer::updateSampleRateAndBufferSize(
 	double sampleRate, int bufferSize) {
 	juce::GenericScopedLock locker(this->lock);
 
-	if (this->sampleRate != sampleRate) {
-		/** Clear Buffer */
-		for (auto& i : this->buffers) {
-			auto& [id, channels, buffer] = i.second;
-
-			int newSize =
-				std::ceil(buffer.getNumSamples() * (sampleRate / this->sampleRate));
-			buffer.setSize(channels.size(), newSize, false, true, true);
-		}
-
-		this->sampleRate = sampleRate;
-	}
+	this->sampleRate = sampleRate;
 	this->bufferSize = bufferSize;
 }
 
@@ -237,39 +381,185 @@ bool Renderer::getRendering() const {
 	return this->rendering;
 }
 
+void Renderer::setRenderBlockSize(int size) {
+	this->renderBlockSize = juce::jlimit(0, Renderer::maxRenderBlockSize, size);
+}
+
+int Renderer::getRenderBlockSize() const {
+	return this->renderBlockSize;
+}
+
+const std::tuple<double, double> Renderer::getLastRenderTime() const {
+	return { this->lastRenderLength.load(), this->lastRenderCost.load() };
+}
+
+double Renderer::getLastRealtimeFactor() const {
+	double cost = this->lastRenderCost;
+	return (cost > 0) ? (this->lastRenderLength / cost) : 0;
+}
+
+int Renderer::getLastRenderBlockSize() const {
+	return this->lastRenderBlockSize;
+}
+
+int Renderer::getLastRenderThreadNum() const {
+	return this->lastRenderThreadNum;
+}
+
+int Renderer::getLastCachedStemNum() const {
+	return this->lastCachedStemNum;
+}
+
+void Renderer::setRenderCacheEnabled(bool enabled) {
+	this->renderCacheEnabled = enabled;
+	if (!enabled) {
+		this->cache.clear();
+	}
+}
+
+bool Renderer::getRenderCacheEnabled() const {
+	return this->renderCacheEnabled;
+}
+
+int Renderer::getCurrentRenderBlockSize() const {
+	int size = this->renderBlockSize;
+	return (size > 0) ? size : std::max(this->bufferSize, 1);
+}
+
+void Renderer::setLastRenderTime(double length, double cost) {
+	this->lastRenderLength = length;
+	this->lastRenderCost = cost;
+}
+
 void Renderer::prepareToRender(const RenderTaskList& tasks) {
 	juce::GenericScopedLock locker(this->lock);
 
 	this->releaseBuffer();
 
+	this->renderStart = std::llround(this->rangeStartTime * this->sampleRate);
+	this->renderLength = std::ceil((this->rangeEndTime - this->rangeStartTime) * this->sampleRate);
+
+	this->tasks = tasks;
+}
+
+const std::tuple<double, double> Renderer::getRenderRange(
+	double startTime, double endTime, bool snapToBlocks) {
 	auto graph = AudioCore::getInstance()->getGraph();
-	double totalLength = graph ? graph->getTailLengthSeconds() : 0;
-	int bufferSize = std::ceil(totalLength * this->sampleRate);
+	if (!graph) { return { 0, 0 }; }
+
+	/** Limit To Project Length */
+	double totalLength = graph->getTailLengthSeconds();
+	if (endTime < 0) { endTime = totalLength; }
+	startTime = juce::jlimit(0.0, totalLength, startTime);
+	endTime = juce::jlimit(0.0, totalLength, endTime);
+
+	/** Extend To The Blocks Cut By The Range */
+	if (snapToBlocks) {
+		double snapStart = startTime, snapEnd = endTime;
+		for (int i = 0; i < graph->getSourceNum(); i++) {
+			auto source = graph->getSourceProcessor(i);
+			if (!source) { continue; }
+
+			for (int j = 0; j < source->getSeqNum(); j++) {
+				auto [blockStart, blockEnd, offset] = source->getSeq(j);
+				if (blockStart < startTime && blockEnd > startTime) {
+					snapStart = std::min(snapStart, blockStart);
+				}
+				if (blockStart < endTime && blockEnd > endTime) {
+					snapEnd = std::max(snapEnd, blockEnd);
+				}
+			}
+		}
+		startTime = std::max(snapStart, 0.0);
+		endTime = snapEnd;
+	}
+
+	return { startTime, endTime };
+}
+
+void Renderer::prepareCache(const juce::String& extension,
+	const juce::StringPairArray& metaData, int bitDepth, int quality) {
+	juce::GenericScopedLock locker(this->lock);
 
-	for (auto& [ptr, id, channels] : tasks) {
-		juce::AudioBuffer<float> buffer;
-		buffer.setSize(channels.size(), bufferSize, false, true, true);
-		this->buffers.insert(std::make_pair(
-			ptr, std::make_tuple(id, channels, buffer)));
+	this->fingerprints.clear();
+	this->cacheDir = utils::getRenderCacheDir(utils::getProjectDir().getFullPathName());
+	if (!this->renderCacheEnabled) { return; }
+
+	auto graph = AudioCore::getInstance()->getGraph();
+	if (!graph) { return; }
+
+	/** Everything Shared By The Stems */
+	juce::String settings;
+	settings << this->sampleRate << "|" << this->getCurrentRenderBlockSize() << "|"
+		<< this->rangeStartTime << "|" << this->rangeEndTime << "|" << this->preRollTime << "|"
+		<< extension << "|" << bitDepth << "|" << quality << "|"
+		<< metaData.getDescription() << "|" << PluginDecorator::getMIDICCSplitSize() << "|";
+	for (auto& [time, tempo, numerator, denominator, isTempo] : PlayPosition::getInstance()->getTempoDataList()) {
+		settings << time << "," << tempo << "," << numerator << "," << denominator << "," << (int)isTempo << ";";
+	}
+
+	for (auto& [ptr, id, channels] : this->tasks) {
+		auto fingerprint = RenderCache::getTrackFingerprint(graph, id,
+			settings + "|" + channels.getSpeakerArrangementAsString());
+		if (fingerprint.isNotEmpty()) {
+			this->fingerprints.insert(std::make_pair(ptr, fingerprint));
+		}
+	}
+}
+
+bool Renderer::restoreCachedStems(const juce::File& dir,
+	const juce::String& name, const juce::String& extension) {
+	juce::GenericScopedLock locker(this->lock);
+
+	RenderTaskList dirtyTasks;
+	int cachedNum = 0;
+	for (auto& task : this->tasks) {
+		auto& [ptr, id, channels] = task;
+
+		/** Copy The Stem Rendered With The Same Fingerprint */
+		auto it = this->fingerprints.find(ptr);
+		if (it != this->fingerprints.end()) {
+			auto file = dir.getChildFile(name + "_" + juce::String(id) + extension);
+			if (this->cache.restore(id, it->second, file)) {
+				cachedNum++;
+				juce::MessageManager::callAsync(
+					[id = id] {
+						UICallbackAPI<int, double>::invoke(UICallbackType::RenderProgress, id, 1.0);
+					});
+				continue;
+			}
+		}
+
+		dirtyTasks.add(task);
 	}
+
+	this->tasks = dirtyTasks;
+	this->lastCachedStemNum = cachedNum;
+	return !this->tasks.isEmpty();
 }
 
-void Renderer::saveFile(const juce::File& dir,
+void Renderer::storeCachedStems() {
+	juce::GenericScopedLock locker(this->lock);
+
+	for (auto& [ptr, stem] : this->stems) {
+		auto it = this->fingerprints.find(ptr);
+		if (it == this->fingerprints.end()) { continue; }
+
+		/** Only Complete Stems */
+		if (stem->getWrittenNum() < stem->getTotalLength()) { continue; }
+
+		this->cache.store(this->stemIds[ptr], it->second, stem->getFile(), this->cacheDir);
+	}
+}
+
+void Renderer::openFiles(const juce::File& dir,
 	const juce::String& name, const juce::String& extension,
 	const juce::StringPairArray& metaData, int bitDepth, int quality) {
 	/** Lock */
 	juce::GenericScopedLock locker(this->lock);
 
-	/** Save Each Buffer */
-	for (auto& i : this->buffers) {
-		/** Stop */
-		if (juce::Thread::currentThreadShouldExit()) {
-			break;
-		}
-
-		/** Get Buffer */
-		auto& [id, channels, buffer] = i.second;
-		
+	/** Open Each Stem */
+	for (auto& [ptr, id, channels] : this->tasks) {
 		/** Create File */
 		auto file = dir.getChildFile(name + "_" + juce::String(id) + extension);
 		if (file.exists()) {
@@ -282,40 +572,84 @@ void Renderer::saveFile(const juce::File& dir,
 			metaData, bitDepth, quality);
 		if (!writer) { continue; }
 
-		/** Write Data */
-		writer->writeFromAudioSampleBuffer(buffer, 0, buffer.getNumSamples());
+		/** Ring Buffer */
+		auto stem = std::make_unique<StemWriter>(file, std::move(writer),
+			channels.size(), Renderer::stemRingSize);
+		stem->setStartPosition(this->renderStart);
+		stem->setTotalLength(this->renderLength);
+		this->stems.insert(std::make_pair(ptr, std::move(stem)));
+		this->stemIds.insert(std::make_pair(ptr, id));
+	}
+
+	/** One Encoder Job For Each Stem */
+	this->encodeFinishing = false;
+	this->encodeEvent.reset();
+	this->encoderPool = std::make_unique<juce::ThreadPool>(std::max(1,
+		std::min(juce::SystemStats::getNumCpus(), (int)this->stems.size())));
+	for (auto& [ptr, stem] : this->stems) {
+		this->encoderPool->addJob(
+			new StemEncodeJob{ this, stem.get(), this->stemIds[ptr] }, true);
+	}
+}
+
+bool Renderer::saveFile() {
+	if (!this->encoderPool) { return true; }
+
+	/** Encode The Rest */
+	this->encodeFinishing = true;
+	for (auto& [ptr, stem] : this->stems) {
+		stem->notifyData();
+	}
+
+	/** Wait For Encoders */
+	while (this->encoderPool->getNumJobs() > 0) {
+		/** Stop */
+		if (juce::Thread::currentThreadShouldExit()) {
+			this->abortFiles();
+			return false;
+		}
+
+		this->encodeEvent.wait(50);
+	}
+
+	return true;
+}
+
+void Renderer::abortFiles() {
+	/** Stop Encoders */
+	if (this->encoderPool) {
+		this->encoderPool->removeAllJobs(true, 3000);
+	}
+
+	/** Lock */
+	juce::GenericScopedLock locker(this->lock);
+
+	/** Remove Unfinished Files */
+	for (auto& [ptr, stem] : this->stems) {
+		stem->abort();
 	}
 }
 
 void Renderer::releaseBuffer() {
 	juce::GenericScopedLock locker(this->lock);
-	this->buffers.clear();
+	this->encoderPool = nullptr;
+	this->stems.clear();
+	this->stemIds.clear();
+	this->tasks.clear();
+	this->fingerprints.clear();
 }
 
 void Renderer::writeData(const Track* trackPtr,
-	const juce::AudioBuffer<float>& buffer, int offset) {
+	const juce::AudioBuffer<float>& buffer, int64_t offset) {
 	/** Check Rendering State */
 	if (!this->rendering) { return; }
 
-	/** Lock */
-	juce::GenericScopedLock locker(this->lock);
+	/** Stems Only Change While Not Rendering, So Tracks Don't Lock Each Other */
+	auto stemIt = this->stems.find(trackPtr);
+	if (stemIt == this->stems.end()) { return; }
 
-	/** Find Buffer */
-	auto bufferIt = this->buffers.find(trackPtr);
-	if (bufferIt == this->buffers.end()) { return; }
-	auto& dstBuffer = std::get<2>(bufferIt->second);
-
-	/** Increase Buffer Size */
-	if (dstBuffer.getNumSamples() - buffer.getNumSamples() < offset) {
-		dstBuffer.setSize(dstBuffer.getNumChannels(),
-			offset + buffer.getNumSamples(), true, false, true);
-	}
-
-	/** Copy Data */
-	for (int i = 0; i < dstBuffer.getNumChannels(); i++) {
-		vMath::copyAudioData(dstBuffer, buffer,
-			offset, 0, i, i, buffer.getNumSamples());
-	}
+	/** Push Data */
+	stemIt->second->write(buffer, offset);
 }
 
 Renderer* Renderer::getInstance() {
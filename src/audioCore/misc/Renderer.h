@@ -1,6 +1,8 @@
 ﻿#pragma once
 
 #include <JuceHeader.h>
+#include "StemWriter.h"
+#include "RenderCache.h"
 
 class Track;
 
@@ -12,9 +14,14 @@ public:
 	using RenderTask = std::tuple<const Track*, int, juce::AudioChannelSet>;
 	using RenderTaskList = juce::Array<RenderTask>;
 
+	/**
+	 * @brief	Render the tracks between startTime and endTime, or to the project end when endTime is negative.
+	 * @attention	Rendering starts preRollTime earlier so plugins settle, only the range is written.
+	 */
 	bool start(const juce::Array<int>& tracks, const juce::String& path,
 		const juce::String& name, const juce::String& extension,
-		const juce::StringPairArray& metaData, int bitDepth, int quality);
+		const juce::StringPairArray& metaData, int bitDepth, int quality,
+		double startTime = 0, double endTime = -1, double preRollTime = 0, bool snapToBlocks = false);
 	/**
 	 * For internal use only.
 	 */
@@ -24,21 +31,65 @@ public:
 
 	void updateSampleRateAndBufferSize(double sampleRate, int bufferSize);
 
+	/**
+	 * @brief	Set the block size of offline rendering, 0 to use the device buffer size.
+	 */
+	void setRenderBlockSize(int size);
+	int getRenderBlockSize() const;
+
+	/** Rendered Audio Length, Time Spent In Seconds */
+	const std::tuple<double, double> getLastRenderTime() const;
+	double getLastRealtimeFactor() const;
+	int getLastRenderBlockSize() const;
+	int getLastRenderThreadNum() const;
+	int getLastCachedStemNum() const;
+
+	/**
+	 * @brief	Copy stems of tracks whose inputs didn't change since the last render instead of encoding them again.
+	 */
+	void setRenderCacheEnabled(bool enabled);
+	bool getRenderCacheEnabled() const;
+
+	static constexpr int maxRenderBlockSize = 16384;
+	/** Samples Each Stem Holds Before The Track Waits For The Writer Thread */
+	static constexpr int stemRingSize = 262144;
+
 private:
 	friend class RenderThread;
+	friend class StemEncodeJob;
 
 	void setRendering(bool rendering);
+	int getCurrentRenderBlockSize() const;
+	void setLastRenderTime(double length, double cost);
 
 	void prepareToRender(const RenderTaskList& tasks);
-	void saveFile(const juce::File& dir,
+	/**
+	 * @brief	Limit the range to the project, extended to the source blocks it cuts when snapping.
+	 */
+	static const std::tuple<double, double> getRenderRange(
+		double startTime, double endTime, bool snapToBlocks);
+	void prepareCache(const juce::String& extension,
+		const juce::StringPairArray& metaData, int bitDepth, int quality);
+	/**
+	 * @brief	Copy the cached stems and keep only the tasks that must be rendered. False if none is left.
+	 */
+	bool restoreCachedStems(const juce::File& dir,
+		const juce::String& name, const juce::String& extension);
+	void storeCachedStems();
+	void openFiles(const juce::File& dir,
 		const juce::String& name, const juce::String& extension,
 		const juce::StringPairArray& metaData, int bitDepth, int quality);
+	/**
+	 * @brief	Wait for every stem to be encoded, or delete unfinished files when the render thread is stopped.
+	 */
+	bool saveFile();
+	void abortFiles();
 	void releaseBuffer();
 
 private:
 	friend class Track;
 	void writeData(const Track* trackPtr,
-		const juce::AudioBuffer<float>& buffer, int offset);
+		const juce::AudioBuffer<float>& buffer, int64_t offset);
 
 private:
 	std::atomic_bool rendering = false;
@@ -46,9 +97,25 @@ private:
 	const double audioBufferArea = 2;
 	double sampleRate = 0;
 	int bufferSize = 0;
-	std::map<const Track*, std::tuple<
-		int, juce::AudioChannelSet, juce::AudioBuffer<float>>> buffers;
+	std::atomic_int renderBlockSize = 4096;
+	double rangeStartTime = 0, rangeEndTime = 0, preRollTime = 0;
+	int64_t renderStart = 0;
+	int renderLength = 0;
+	int lastParallelThreadNum = 0;
+	std::atomic<double> lastRenderLength = 0, lastRenderCost = 0;
+	std::atomic_int lastRenderBlockSize = 0, lastRenderThreadNum = 0;
+	std::atomic_int lastCachedStemNum = 0;
+	std::atomic_bool renderCacheEnabled = true;
+	RenderCache cache;
+	juce::File cacheDir;
+	std::map<const Track*, juce::String> fingerprints;
+	RenderTaskList tasks;
+	std::map<const Track*, std::unique_ptr<StemWriter>> stems;
+	std::map<const Track*, int> stemIds;
 	std::unique_ptr<juce::Thread> renderThread = nullptr;
+	std::unique_ptr<juce::ThreadPool> encoderPool = nullptr;
+	std::atomic_bool encodeFinishing = false;
+	juce::WaitableEvent encodeEvent;
 
 public:
 	static Renderer* getInstance();
@@ -0,0 +1,126 @@
+﻿#include "StemWriter.h"
+
+#include "VMath.h"
+
+StemWriter::StemWriter(const juce::File& file, std::unique_ptr<juce::AudioFormatWriter> writer,
+	int channels, int ringSize)
+	: file(file), writer(std::move(writer)), ring(channels, ringSize),
+	fifo(ringSize) {}
+
+void StemWriter::setTotalLength(int64_t length) {
+	this->totalLength = std::max(length, (int64_t)0);
+}
+
+int64_t StemWriter::getTotalLength() const {
+	return this->totalLength;
+}
+
+void StemWriter::setStartPosition(int64_t position) {
+	this->startPosition = position;
+}
+
+const juce::File& StemWriter::getFile() const {
+	return this->file;
+}
+
+void StemWriter::write(const juce::AudioBuffer<float>& buffer, int64_t offset) {
+	int64_t total = this->totalLength;
+	offset -= this->startPosition;
+
+	/** Silence Between The Last Block And This One */
+	while (this->pushedNum < std::min(offset, total) && !this->aborted) {
+		int length = (int)std::min(std::min(offset, total) - this->pushedNum,
+			(int64_t)this->ring.getNumSamples());
+		this->push(nullptr, 0, length);
+	}
+
+	/** Skip Samples Already Pushed And Cut At The End */
+	int64_t start = std::max(offset, this->pushedNum);
+	int64_t end = std::min(offset + buffer.getNumSamples(), total);
+	if (end > start) {
+		this->push(&buffer, (int)(start - offset), (int)(end - start));
+	}
+}
+
+void StemWriter::push(const juce::AudioBuffer<float>* buffer, int startSample, int length) {
+	while (length > 0 && !this->aborted) {
+		/** Wait For The Writer Thread */
+		int freeNum = this->fifo.getFreeSpace();
+		if (freeNum <= 0) {
+			this->spaceEvent.wait(5);
+			continue;
+		}
+
+		int start1 = 0, size1 = 0, start2 = 0, size2 = 0;
+		this->fifo.prepareToWrite(std::min(length, freeNum), start1, size1, start2, size2);
+
+		for (int i = 0; i < this->ring.getNumChannels(); i++) {
+			if (buffer && i < buffer->getNumChannels()) {
+				vMath::copyAudioData(this->ring, *buffer, start1, startSample, i, i, size1);
+				vMath::copyAudioData(this->ring, *buffer, start2, startSample + size1, i, i, size2);
+			}
+			else {
+				vMath::zeroAudioData(this->ring, start1, i, size1);
+				vMath::zeroAudioData(this->ring, start2, i, size2);
+			}
+		}
+
+		this->fifo.finishedWrite(size1 + size2);
+		this->pushedNum += size1 + size2;
+		startSample += size1 + size2;
+		length -= size1 + size2;
+
+		this->dataEvent.signal();
+	}
+}
+
+int StemWriter::drain() {
+	int readyNum = this->fifo.getNumReady();
+	if (readyNum <= 0) { return 0; }
+
+	int start1 = 0, size1 = 0, start2 = 0, size2 = 0;
+	this->fifo.prepareToRead(readyNum, start1, size1, start2, size2);
+
+	if (this->writer) {
+		this->writer->writeFromAudioSampleBuffer(this->ring, start1, size1);
+		if (size2 > 0) {
+			this->writer->writeFromAudioSampleBuffer(this->ring, start2, size2);
+		}
+	}
+
+	this->fifo.finishedRead(size1 + size2);
+	this->writtenNum += size1 + size2;
+	this->spaceEvent.signal();
+
+	return size1 + size2;
+}
+
+bool StemWriter::isDrained() const {
+	return this->fifo.getNumReady() <= 0;
+}
+
+void StemWriter::waitForData(int timeOutMilliseconds) {
+	this->dataEvent.wait(timeOutMilliseconds);
+}
+
+void StemWriter::notifyData() {
+	this->dataEvent.signal();
+}
+
+int64_t StemWriter::getWrittenNum() const {
+	return this->writtenNum;
+}
+
+void StemWriter::close() {
+	this->writer = nullptr;
+}
+
+void StemWriter::abort() {
+	this->aborted = true;
+	this->spaceEvent.signal();
+
+	if (this->writer) {
+		this->writer = nullptr;
+		this->file.deleteFile();
+	}
+}
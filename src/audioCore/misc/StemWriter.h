@@ -0,0 +1,73 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+
+/**
+ * Streams one rendered stem to its audio file through a fixed size ring buffer.
+ * The track pushes blocks while rendering and the writer thread encodes them, so memory use
+ * is bounded by the ring size instead of the project length.
+ */
+class StemWriter final {
+public:
+	StemWriter() = delete;
+	StemWriter(const juce::File& file, std::unique_ptr<juce::AudioFormatWriter> writer,
+		int channels, int ringSize);
+
+	/**
+	 * @brief	Set the number of samples written to the file. Blocks past it are cut.
+	 * @attention	Don't call this while rendering.
+	 */
+	void setTotalLength(int64_t length);
+	int64_t getTotalLength() const;
+	/**
+	 * @brief	Set the transport position of the first sample in the file. Samples before it are skipped.
+	 * @attention	Don't call this while rendering.
+	 */
+	void setStartPosition(int64_t position);
+	const juce::File& getFile() const;
+
+	/**
+	 * @brief	Push the block at the transport position, filling gaps with silence.
+	 * @attention	Call this only on the rendering track's thread. Waits for the writer when the ring is full.
+	 */
+	void write(const juce::AudioBuffer<float>& buffer, int64_t offset);
+
+	/**
+	 * @brief	Encode every sample in the ring and return the number of samples encoded.
+	 * @attention	Call this only on the writer thread.
+	 */
+	int drain();
+	bool isDrained() const;
+	/**
+	 * @brief	Wait until the track pushes more samples or the time runs out.
+	 */
+	void waitForData(int timeOutMilliseconds);
+	void notifyData();
+	int64_t getWrittenNum() const;
+
+	/**
+	 * @brief	Flush and close the file.
+	 */
+	void close();
+	/**
+	 * @brief	Close and delete the unfinished file, the producer stops waiting.
+	 */
+	void abort();
+
+private:
+	const juce::File file;
+	std::unique_ptr<juce::AudioFormatWriter> writer;
+	juce::AudioBuffer<float> ring;
+	juce::AbstractFifo fifo;
+	juce::WaitableEvent spaceEvent, dataEvent;
+
+	std::atomic_int64_t totalLength = 0;
+	int64_t startPosition = 0;
+	int64_t pushedNum = 0;
+	std::atomic_int64_t writtenNum = 0;
+	std::atomic_bool aborted = false;
+
+	void push(const juce::AudioBuffer<float>* buffer, int startSample, int length);
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StemWriter)
+};
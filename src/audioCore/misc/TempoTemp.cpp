@@ -282,43 +282,46 @@ void TempoTemp::update(
 }
 
 int TempoTemp::selectBySec(double time) const {
-	if (this->lastIndex >= 0 && this->lastIndex < this->temp.size()) {
+	/** The Cache Is Shared By Every Thread Reading This Temp */
+	int lastIndex = this->lastIndex.load(std::memory_order_relaxed);
+
+	if (lastIndex >= 0 && lastIndex < this->temp.size()) {
 		/** Get Temp */
 		auto& [timeInSec, timeInQuarter, timeInBar,
-			secPerQuarter, quarterPerBar, numerator, denominator] = this->temp.getReference(this->lastIndex);
+			secPerQuarter, quarterPerBar, numerator, denominator] = this->temp.getReference(lastIndex);
 
 		/** Hit Temp */
-		if (this->lastIndex == this->temp.size() - 1) {
+		if (lastIndex == this->temp.size() - 1) {
 			if (time >= timeInSec) {
-				return this->lastIndex;
+				return lastIndex;
 			}
 		}
 		else {
 			auto& [timeInSecNext, timeInQuarterNext, timeInBarNext,
-				secPerQuarterNext, quarterPerBarNext, numeratorNext, denominatorNext] = this->temp.getReference(this->lastIndex + 1);
+				secPerQuarterNext, quarterPerBarNext, numeratorNext, denominatorNext] = this->temp.getReference(lastIndex + 1);
 			if ((time >= timeInSec) && (time < timeInSecNext)) {
-				return this->lastIndex;
+				return lastIndex;
 			}
 		}
 	}
 	
 	/** Get Next Temp */
-	if (this->lastIndex >= -1 && this->lastIndex < this->temp.size() - 1) {
+	if (lastIndex >= -1 && lastIndex < this->temp.size() - 1) {
 		/** Get Next */
 		auto& [timeInSec, timeInQuarter, timeInBar,
-			secPerQuarter, quarterPerBar, numerator, denominator] = this->temp.getReference(this->lastIndex + 1);
+			secPerQuarter, quarterPerBar, numerator, denominator] = this->temp.getReference(lastIndex + 1);
 		
 		/** Check Hit */
-		if (this->lastIndex < this->temp.size() - 2) {
+		if (lastIndex < this->temp.size() - 2) {
 			auto& [timeInSecNext, timeInQuarterNext, timeInBarNext,
-				secPerQuarterNext, quarterPerBarNext, numeratorNext, denominatorNext] = this->temp.getReference(this->lastIndex + 2);
+				secPerQuarterNext, quarterPerBarNext, numeratorNext, denominatorNext] = this->temp.getReference(lastIndex + 2);
 			if ((time >= timeInSec) && (time < timeInSecNext)) {
-				return ++(this->lastIndex);
+				return this->cacheIndex(lastIndex + 1);
 			}
 		}
 		else {
 			if (time >= timeInSec) {
-				return ++(this->lastIndex);
+				return this->cacheIndex(lastIndex + 1);
 			}
 		}
 	}
@@ -328,7 +331,7 @@ int TempoTemp::selectBySec(double time) const {
 		auto& [timeInSec, timeInQuarter, timeInBar,
 			secPerQuarter, quarterPerBar, numerator, denominator] = this->temp.getReference(this->temp.size() - 1);
 		if (time >= timeInSec) {
-			return this->lastIndex = (this->temp.size() - 1);
+			return this->cacheIndex(this->temp.size() - 1);
 		}
 	}
 
@@ -346,7 +349,7 @@ int TempoTemp::selectBySec(double time) const {
 		};
 
 	/** Binary Search */
-	return this->lastIndex = this->search(0, this->temp.size() - 2, time, cFunc);
+	return this->cacheIndex(this->search(0, this->temp.size() - 2, time, cFunc));
 }
 
 int TempoTemp::selectByTick(double timeTick, short timeFormat) const {
@@ -362,43 +365,46 @@ int TempoTemp::selectByTick(double timeTick, short timeFormat) const {
 }
 
 int TempoTemp::selectByQuarter(double timeQuarter) const {
-	if (this->lastIndex >= 0 && this->lastIndex < this->temp.size()) {
+	/** The Cache Is Shared By Every Thread Reading This Temp */
+	int lastIndex = this->lastIndex.load(std::memory_order_relaxed);
+
+	if (lastIndex >= 0 && lastIndex < this->temp.size()) {
 		/** Get Temp */
 		auto& [timeInSec, timeInQuarter, timeInBar,
-			secPerQuarter, quarterPerBar, numerator, denominator] = this->temp.getReference(this->lastIndex);
+			secPerQuarter, quarterPerBar, numerator, denominator] = this->temp.getReference(lastIndex);
 
 		/** Hit Temp */
-		if (this->lastIndex == this->temp.size() - 1) {
+		if (lastIndex == this->temp.size() - 1) {
 			if (timeQuarter >= timeInQuarter) {
-				return this->lastIndex;
+				return lastIndex;
 			}
 		}
 		else {
 			auto& [timeInSecNext, timeInQuarterNext, timeInBarNext,
-				secPerQuarterNext, quarterPerBarNext, numeratorNext, denominatorNext] = this->temp.getReference(this->lastIndex + 1);
+				secPerQuarterNext, quarterPerBarNext, numeratorNext, denominatorNext] = this->temp.getReference(lastIndex + 1);
 			if ((timeQuarter >= timeInQuarter) && (timeQuarter < timeInQuarterNext)) {
-				return this->lastIndex;
+				return lastIndex;
 			}
 		}
 	}
 
 	/** Get Next Temp */
-	if (this->lastIndex >= -1 && this->lastIndex < this->temp.size() - 1) {
+	if (lastIndex >= -1 && lastIndex < this->temp.size() - 1) {
 		/** Get Next */
 		auto& [timeInSec, timeInQuarter, timeInBar,
-			secPerQuarter, quarterPerBar, numerator, denominator] = this->temp.getReference(this->lastIndex + 1);
+			secPerQuarter, quarterPerBar, numerator, denominator] = this->temp.getReference(lastIndex + 1);
 
 		/** Check Hit */
-		if (this->lastIndex < this->temp.size() - 2) {
+		if (lastIndex < this->temp.size() - 2) {
 			auto& [timeInSecNext, timeInQuarterNext, timeInBarNext,
-				secPerQuarterNext, quarterPerBarNext, numeratorNext, denominatorNext] = this->temp.getReference(this->lastIndex + 2);
+				secPerQuarterNext, quarterPerBarNext, numeratorNext, denominatorNext] = this->temp.getReference(lastIndex + 2);
 			if ((timeQuarter >= timeInQuarter) && (timeQuarter < timeInQuarterNext)) {
-				return ++(this->lastIndex);
+				return this->cacheIndex(lastIndex + 1);
 			}
 		}
 		else {
 			if (timeQuarter >= timeInQuarter) {
-				return ++(this->lastIndex);
+				return this->cacheIndex(lastIndex + 1);
 			}
 		}
 	}
@@ -408,7 +414,7 @@ int TempoTemp::selectByQuarter(double timeQuarter) const {
 		auto& [timeInSec, timeInQuarter, timeInBar,
 			secPerQuarter, quarterPerBar, numerator, denominator] = this->temp.getReference(this->temp.size() - 1);
 		if (timeQuarter >= timeInQuarter) {
-			return this->lastIndex = (this->temp.size() - 1);
+			return this->cacheIndex(this->temp.size() - 1);
 		}
 	}
 
@@ -426,47 +432,50 @@ int TempoTemp::selectByQuarter(double timeQuarter) const {
 		};
 
 	/** Binary Search */
-	return this->lastIndex = this->search(0, this->temp.size() - 2, timeQuarter, cFunc);
+	return this->cacheIndex(this->search(0, this->temp.size() - 2, timeQuarter, cFunc));
 }
 
 int TempoTemp::selectByBar(double timeBar) const {
-	if (this->lastIndex >= 0 && this->lastIndex < this->temp.size()) {
+	/** The Cache Is Shared By Every Thread Reading This Temp */
+	int lastIndex = this->lastIndex.load(std::memory_order_relaxed);
+
+	if (lastIndex >= 0 && lastIndex < this->temp.size()) {
 		/** Get Temp */
 		auto& [timeInSec, timeInQuarter, timeInBar,
-			secPerQuarter, quarterPerBar, numerator, denominator] = this->temp.getReference(this->lastIndex);
+			secPerQuarter, quarterPerBar, numerator, denominator] = this->temp.getReference(lastIndex);
 
 		/** Hit Temp */
-		if (this->lastIndex == this->temp.size() - 1) {
+		if (lastIndex == this->temp.size() - 1) {
 			if (timeBar >= timeInBar) {
-				return this->lastIndex;
+				return lastIndex;
 			}
 		}
 		else {
 			auto& [timeInSecNext, timeInQuarterNext, timeInBarNext,
-				secPerQuarterNext, quarterPerBarNext, numeratorNext, denominatorNext] = this->temp.getReference(this->lastIndex + 1);
+				secPerQuarterNext, quarterPerBarNext, numeratorNext, denominatorNext] = this->temp.getReference(lastIndex + 1);
 			if ((timeBar >= timeInBar) && (timeBar < timeInBarNext)) {
-				return this->lastIndex;
+				return lastIndex;
 			}
 		}
 	}
 
 	/** Get Next Temp */
-	if (this->lastIndex >= -1 && this->lastIndex < this->temp.size() - 1) {
+	if (lastIndex >= -1 && lastIndex < this->temp.size() - 1) {
 		/** Get Next */
 		auto& [timeInSec, timeInQuarter, timeInBar,
-			secPerQuarter, quarterPerBar, numerator, denominator] = this->temp.getReference(this->lastIndex + 1);
+			secPerQuarter, quarterPerBar, numerator, denominator] = this->temp.getReference(lastIndex + 1);
 
 		/** Check Hit */
-		if (this->lastIndex < this->temp.size() - 2) {
+		if (lastIndex < this->temp.size() - 2) {
 			auto& [timeInSecNext, timeInQuarterNext, timeInBarNext,
-				secPerQuarterNext, quarterPerBarNext, numeratorNext, denominatorNext] = this->temp.getReference(this->lastIndex + 2);
+				secPerQuarterNext, quarterPerBarNext, numeratorNext, denominatorNext] = this->temp.getReference(lastIndex + 2);
 			if ((timeBar >= timeInBar) && (timeBar < timeInBarNext)) {
-				return ++(this->lastIndex);
+				return this->cacheIndex(lastIndex + 1);
 			}
 		}
 		else {
 			if (timeBar >= timeInBar) {
-				return ++(this->lastIndex);
+				return this->cacheIndex(lastIndex + 1);
 			}
 		}
 	}
@@ -476,7 +485,7 @@ int TempoTemp::selectByBar(double timeBar) const {
 		auto& [timeInSec, timeInQuarter, timeInBar,
 			secPerQuarter, quarterPerBar, numerator, denominator] = this->temp.getReference(this->temp.size() - 1);
 		if (timeBar >= timeInBar) {
-			return this->lastIndex = (this->temp.size() - 1);
+			return this->cacheIndex(this->temp.size() - 1);
 		}
 	}
 
@@ -494,7 +503,7 @@ int TempoTemp::selectByBar(double timeBar) const {
 		};
 
 	/** Binary Search */
-	return this->lastIndex = this->search(0, this->temp.size() - 2, timeBar, cFunc);
+	return this->cacheIndex(this->search(0, this->temp.size() - 2, timeBar, cFunc));
 }
 
 double TempoTemp::secToQuarter(double timeSec, int tempIndex) const {
@@ -585,6 +594,11 @@ TempoTemp::TempoDataMini TempoTemp::getTempoDataMini(int tempIndex) const {
 	return { timeInSec, timeInQuarter, timeInBar, secPerQuarter, numerator, denominator };
 }
 
+int TempoTemp::cacheIndex(int index) const {
+	this->lastIndex.store(index, std::memory_order_relaxed);
+	return index;
+}
+
 template<typename Func, typename T>
 int TempoTemp::search(int low, int high, T value, Func func) const {
 	if (high < low) { return -1; }
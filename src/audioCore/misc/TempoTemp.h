@@ -35,13 +35,14 @@ private:
 	using TempoTempItem = std::tuple<double, double, double, double, double, int, int>;
 
 	juce::Array<TempoTempItem> temp;
-	mutable int lastIndex = -1;
+	mutable std::atomic_int lastIndex = -1;
 
 	enum class CompareResult {
 		EQ, GTR, LSS
 	};
 	template<typename Func, typename T>
 	int search(int low, int high, T value, Func func) const;
+	int cacheIndex(int index) const;
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TempoTemp)
 };
@@ -27,219 +27,1118 @@ namespace vMath {
 		}
 	}
 
+	static void scaleDataNormal(float* dst, float gain, int length) {
+		for (int i = 0; i < length; i++) {
+			dst[i] = dst[i] * gain;
+		}
+	}
+
+	static void rampDataNormal(float* dst, float start, float step, int length) {
+		for (int i = 0; i < length; i++) {
+			dst[i] = dst[i] * (start + step * i);
+		}
+	}
+
+	static void mulAddDataNormal(float* dst, const float* src, float gain, int length) {
+		for (int i = 0; i < length; i++) {
+			dst[i] = dst[i] + src[i] * gain;
+		}
+	}
+
+	static void mulAddRampDataNormal(float* dst, const float* src, float start, float step, int length) {
+		for (int i = 0; i < length; i++) {
+			dst[i] = dst[i] + src[i] * (start + step * i);
+		}
+	}
+
+	static void panDataNormal(float* dstL, float* dstR, const float* src, float gainL, float gainR, int length) {
+		for (int i = 0; i < length; i++) {
+			dstL[i] = dstL[i] + src[i] * gainL;
+			dstR[i] = dstR[i] + src[i] * gainR;
+		}
+	}
+
+	static void rangeDataNormal(const float* src, int length, float& minV, float& maxV) {
+		for (int i = 0; i < length; i++) {
+			minV = std::min(minV, src[i]);
+			maxV = std::max(maxV, src[i]);
+		}
+	}
+
+	static void clampDataNormal(float* dst, float minV, float maxV, int length) {
+		for (int i = 0; i < length; i++) {
+			dst[i] = std::min(std::max(dst[i], minV), maxV);
+		}
+	}
+
+	constexpr float int16Scale = 1.f / 32768.f;
+	constexpr float int24Scale = 1.f / 8388608.f;
+
+	static void int16DataNormal(float* dst, const int16_t* src, int length) {
+		for (int i = 0; i < length; i++) {
+			dst[i] = src[i] * int16Scale;
+		}
+	}
+
+	/** Little Endian Packed 24 Bit, Sign Extended Through The Top Byte */
+	static int32_t getInt24(const uint8_t* src, int index) {
+		auto ptr = &(src[index * 3]);
+		return (int32_t)(((uint32_t)ptr[0] << 8) | ((uint32_t)ptr[1] << 16) | ((uint32_t)ptr[2] << 24)) >> 8;
+	}
+
+	static void int24DataNormal(float* dst, const uint8_t* src, int length) {
+		for (int i = 0; i < length; i++) {
+			dst[i] = getInt24(src, i) * int24Scale;
+		}
+	}
+
+	static void interleaveDataNormal(float* dst, const float* srcL, const float* srcR, int length) {
+		for (int i = 0; i < length; i++) {
+			dst[i * 2 + 0] = srcL[i];
+			dst[i * 2 + 1] = srcR[i];
+		}
+	}
+
+	static void deinterleaveDataNormal(float* dstL, float* dstR, const float* src, int length) {
+		for (int i = 0; i < length; i++) {
+			dstL[i] = src[i * 2 + 0];
+			dstR[i] = src[i * 2 + 1];
+		}
+	}
+
+	static void levelDataNormal(const float* src, int length, float& sumSquare, float& peak) {
+		for (int i = 0; i < length; i++) {
+			sumSquare += src[i] * src[i];
+			peak = std::max(peak, std::abs(src[i]));
+		}
+	}
+
+	/** 4x Polyphase Windowed Sinc, Coefficients Stored As [Tap][Phase] */
+	constexpr int truePeakTaps = truePeakHistorySize + 1;
+	constexpr int truePeakPhases = 4;
+	static const std::array<float, truePeakTaps * truePeakPhases>& getTruePeakCoefficients() {
+		static const auto coefficients = [] {
+			std::array<float, truePeakTaps * truePeakPhases> result{};
+			constexpr int size = truePeakTaps * truePeakPhases;
+			constexpr double center = (size - 1) / 2.0;
+
+			for (int p = 0; p < truePeakPhases; p++) {
+				double sum = 0;
+				for (int t = 0; t < truePeakTaps; t++) {
+					int n = t * truePeakPhases + p;
+					double x = (n - center) / truePeakPhases;
+					double sinc = juce::approximatelyEqual(x, 0.0)
+						? 1.0 : std::sin(juce::MathConstants<double>::pi * x) / (juce::MathConstants<double>::pi * x);
+					double window = 0.42 - 0.5 * std::cos(2 * juce::MathConstants<double>::pi * n / (size - 1))
+						+ 0.08 * std::cos(4 * juce::MathConstants<double>::pi * n / (size - 1));
+					result[t * truePeakPhases + p] = (float)(sinc * window);
+					sum += sinc * window;
+				}
+
+				/** Unity Gain On Every Phase */
+				for (int t = 0; t < truePeakTaps; t++) {
+					result[t * truePeakPhases + p] = (float)(result[t * truePeakPhases + p] / sum);
+				}
+			}
+
+			return result;
+			}();
+		return coefficients;
+	}
+
+	static float getTruePeakSample(const float* src, int index, const float* history) {
+		return (index >= 0) ? src[index] : history[truePeakHistorySize + index];
+	}
+
+	static void updateTruePeakHistory(const float* src, int length, float* history) {
+		if (length >= truePeakHistorySize) {
+			std::memcpy(history, &(src[length - truePeakHistorySize]), truePeakHistorySize * sizeof(float));
+			return;
+		}
+
+		std::memmove(history, &(history[length]), (truePeakHistorySize - length) * sizeof(float));
+		std::memcpy(&(history[truePeakHistorySize - length]), src, length * sizeof(float));
+	}
+
+	static float truePeakNormal(const float* src, int length, float* history) {
+		auto& coefficients = getTruePeakCoefficients();
+
+		float peak = 0.f;
+		for (int i = 0; i < length; i++) {
+			for (int p = 0; p < truePeakPhases; p++) {
+				float result = 0.f;
+				for (int t = 0; t < truePeakTaps; t++) {
+					result += coefficients[t * truePeakPhases + p] * getTruePeakSample(src, i - t, history);
+				}
+				peak = std::max(peak, std::abs(result));
+			}
+		}
+
+		updateTruePeakHistory(src, length, history);
+		return peak;
+	}
+
 #if __SSE3__ || JUCE_MSVC
 	static void copyDataSSE3(float* dst, const float* src, int length) {
 		int clipSize = sizeof(__m128) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
-		for (int i = 0; i < clipMax; i+= clipSize) {
-			__m128 data = _mm_loadu_ps(&(src[i]));
-			_mm_storeu_ps(&(dst[i]), data);
+		for (int i = 0; i < clipMax; i+= clipSize) {
+			__m128 data = _mm_loadu_ps(&(src[i]));
+			_mm_storeu_ps(&(dst[i]), data);
+		}
+
+		copyDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+	}
+
+	static void addDataSSE3(float* dst, const float* src, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data0 = _mm_loadu_ps(&(dst[i]));
+			__m128 data1 = _mm_loadu_ps(&(src[i]));
+			__m128 result = _mm_add_ps(data0, data1);
+			_mm_storeu_ps(&(dst[i]), result);
+		}
+
+		addDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+	}
+
+	static void fillDataSSE3(float* dst, float data, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m128 dataV = _mm_set1_ps(data);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			_mm_storeu_ps(&(dst[i]), dataV);
+		}
+
+		fillDataNormal(&(dst[clipMax]), data, length - clipMax);
+	}
+
+	static void averageDataSSE3(float* dst, const float* src, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m128 averV = _mm_set1_ps(0.5f);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data0 = _mm_loadu_ps(&(dst[i]));
+			__m128 data1 = _mm_loadu_ps(&(src[i]));
+			__m128 sum = _mm_add_ps(data0, data1);
+			__m128 result = _mm_mul_ps(sum, averV);
+			_mm_storeu_ps(&(dst[i]), result);
+		}
+
+		averageDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+	}
+
+	static void scaleDataSSE3(float* dst, float gain, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m128 gainV = _mm_set1_ps(gain);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data = _mm_loadu_ps(&(dst[i]));
+			_mm_storeu_ps(&(dst[i]), _mm_mul_ps(data, gainV));
+		}
+
+		scaleDataNormal(&(dst[clipMax]), gain, length - clipMax);
+	}
+
+	static void rampDataSSE3(float* dst, float start, float step, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		/** Gain Comes From The Sample Index So Long Ramps Don't Drift */
+		__m128 laneV = _mm_mul_ps(_mm_set1_ps(step), _mm_set_ps(3.f, 2.f, 1.f, 0.f));
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data = _mm_loadu_ps(&(dst[i]));
+			__m128 gain = _mm_add_ps(_mm_set1_ps(start + step * i), laneV);
+			_mm_storeu_ps(&(dst[i]), _mm_mul_ps(data, gain));
+		}
+
+		rampDataNormal(&(dst[clipMax]), start + step * clipMax, step, length - clipMax);
+	}
+
+	static void mulAddDataSSE3(float* dst, const float* src, float gain, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m128 gainV = _mm_set1_ps(gain);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data0 = _mm_loadu_ps(&(dst[i]));
+			__m128 data1 = _mm_loadu_ps(&(src[i]));
+			_mm_storeu_ps(&(dst[i]), _mm_add_ps(data0, _mm_mul_ps(data1, gainV)));
+		}
+
+		mulAddDataNormal(&(dst[clipMax]), &(src[clipMax]), gain, length - clipMax);
+	}
+
+	static void mulAddRampDataSSE3(float* dst, const float* src, float start, float step, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m128 laneV = _mm_mul_ps(_mm_set1_ps(step), _mm_set_ps(3.f, 2.f, 1.f, 0.f));
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data0 = _mm_loadu_ps(&(dst[i]));
+			__m128 data1 = _mm_loadu_ps(&(src[i]));
+			__m128 gain = _mm_add_ps(_mm_set1_ps(start + step * i), laneV);
+			_mm_storeu_ps(&(dst[i]), _mm_add_ps(data0, _mm_mul_ps(data1, gain)));
+		}
+
+		mulAddRampDataNormal(&(dst[clipMax]), &(src[clipMax]), start + step * clipMax, step, length - clipMax);
+	}
+
+	static void panDataSSE3(float* dstL, float* dstR, const float* src, float gainL, float gainR, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m128 gainLV = _mm_set1_ps(gainL);
+		__m128 gainRV = _mm_set1_ps(gainR);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data = _mm_loadu_ps(&(src[i]));
+			__m128 dataL = _mm_loadu_ps(&(dstL[i]));
+			__m128 dataR = _mm_loadu_ps(&(dstR[i]));
+			_mm_storeu_ps(&(dstL[i]), _mm_add_ps(dataL, _mm_mul_ps(data, gainLV)));
+			_mm_storeu_ps(&(dstR[i]), _mm_add_ps(dataR, _mm_mul_ps(data, gainRV)));
+		}
+
+		panDataNormal(&(dstL[clipMax]), &(dstR[clipMax]), &(src[clipMax]), gainL, gainR, length - clipMax);
+	}
+
+	static void rangeDataSSE3(const float* src, int length, float& minV, float& maxV) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m128 minVV = _mm_set1_ps(minV);
+		__m128 maxVV = _mm_set1_ps(maxV);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data = _mm_loadu_ps(&(src[i]));
+			minVV = _mm_min_ps(minVV, data);
+			maxVV = _mm_max_ps(maxVV, data);
+		}
+
+		alignas(16) std::array<float, 4> minTemp, maxTemp;
+		_mm_store_ps(minTemp.data(), minVV);
+		_mm_store_ps(maxTemp.data(), maxVV);
+		for (int i = 0; i < clipSize; i++) {
+			minV = std::min(minV, minTemp[i]);
+			maxV = std::max(maxV, maxTemp[i]);
+		}
+
+		rangeDataNormal(&(src[clipMax]), length - clipMax, minV, maxV);
+	}
+
+	static void clampDataSSE3(float* dst, float minV, float maxV, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m128 minVV = _mm_set1_ps(minV);
+		__m128 maxVV = _mm_set1_ps(maxV);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data = _mm_loadu_ps(&(dst[i]));
+			_mm_storeu_ps(&(dst[i]), _mm_min_ps(_mm_max_ps(data, minVV), maxVV));
+		}
+
+		clampDataNormal(&(dst[clipMax]), minV, maxV, length - clipMax);
+	}
+
+	static void int16DataSSE3(float* dst, const int16_t* src, int length) {
+		int clipSize = sizeof(__m128i) / sizeof(int16_t);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		/** Unpacking A Value With Itself And Shifting Back Extends The Sign */
+		__m128 scaleV = _mm_set1_ps(int16Scale);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&(src[i])));
+			__m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(data, data), 16);
+			__m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(data, data), 16);
+			_mm_storeu_ps(&(dst[i]), _mm_mul_ps(_mm_cvtepi32_ps(low), scaleV));
+			_mm_storeu_ps(&(dst[i + 4]), _mm_mul_ps(_mm_cvtepi32_ps(high), scaleV));
+		}
+
+		int16DataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+	}
+
+	static void int24DataSSE3(float* dst, const uint8_t* src, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		/** Without Byte Shuffles The Samples Are Gathered One By One */
+		__m128 scaleV = _mm_set1_ps(int24Scale);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128i data = _mm_set_epi32(getInt24(src, i + 3), getInt24(src, i + 2),
+				getInt24(src, i + 1), getInt24(src, i));
+			_mm_storeu_ps(&(dst[i]), _mm_mul_ps(_mm_cvtepi32_ps(data), scaleV));
+		}
+
+		int24DataNormal(&(dst[clipMax]), &(src[clipMax * 3]), length - clipMax);
+	}
+
+	static void interleaveDataSSE3(float* dst, const float* srcL, const float* srcR, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 dataL = _mm_loadu_ps(&(srcL[i]));
+			__m128 dataR = _mm_loadu_ps(&(srcR[i]));
+			_mm_storeu_ps(&(dst[i * 2]), _mm_unpacklo_ps(dataL, dataR));
+			_mm_storeu_ps(&(dst[i * 2 + 4]), _mm_unpackhi_ps(dataL, dataR));
+		}
+
+		interleaveDataNormal(&(dst[clipMax * 2]), &(srcL[clipMax]), &(srcR[clipMax]), length - clipMax);
+	}
+
+	static void deinterleaveDataSSE3(float* dstL, float* dstR, const float* src, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data0 = _mm_loadu_ps(&(src[i * 2]));
+			__m128 data1 = _mm_loadu_ps(&(src[i * 2 + 4]));
+			_mm_storeu_ps(&(dstL[i]), _mm_shuffle_ps(data0, data1, _MM_SHUFFLE(2, 0, 2, 0)));
+			_mm_storeu_ps(&(dstR[i]), _mm_shuffle_ps(data0, data1, _MM_SHUFFLE(3, 1, 3, 1)));
+		}
+
+		deinterleaveDataNormal(&(dstL[clipMax]), &(dstR[clipMax]), &(src[clipMax * 2]), length - clipMax);
+	}
+
+	static void levelDataSSE3(const float* src, int length, float& sumSquare, float& peak) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m128 sumV = _mm_setzero_ps();
+		__m128 peakV = _mm_setzero_ps();
+		__m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128 data = _mm_loadu_ps(&(src[i]));
+			sumV = _mm_add_ps(sumV, _mm_mul_ps(data, data));
+			peakV = _mm_max_ps(peakV, _mm_and_ps(data, absMask));
+		}
+
+		alignas(16) std::array<float, 4> sumTemp, peakTemp;
+		_mm_store_ps(sumTemp.data(), sumV);
+		_mm_store_ps(peakTemp.data(), peakV);
+		for (int i = 0; i < clipSize; i++) {
+			sumSquare += sumTemp[i];
+			peak = std::max(peak, peakTemp[i]);
+		}
+
+		levelDataNormal(&(src[clipMax]), length - clipMax, sumSquare, peak);
+	}
+
+	static float truePeakSSE3(const float* src, int length, float* history) {
+		auto& coefficients = getTruePeakCoefficients();
+
+		/** All Four Phases Of One Input Sample In One Register */
+		__m128 peakV = _mm_setzero_ps();
+		__m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+		for (int i = 0; i < length; i++) {
+			__m128 result = _mm_setzero_ps();
+			for (int t = 0; t < truePeakTaps; t++) {
+				__m128 coefficient = _mm_loadu_ps(&(coefficients[t * truePeakPhases]));
+				__m128 data = _mm_set1_ps(getTruePeakSample(src, i - t, history));
+				result = _mm_add_ps(result, _mm_mul_ps(coefficient, data));
+			}
+			peakV = _mm_max_ps(peakV, _mm_and_ps(result, absMask));
+		}
+
+		alignas(16) std::array<float, 4> peakTemp;
+		_mm_store_ps(peakTemp.data(), peakV);
+		float peak = std::max({ peakTemp[0], peakTemp[1], peakTemp[2], peakTemp[3] });
+
+		updateTruePeakHistory(src, length, history);
+		return peak;
+	}
+
+#else //__SSE3__ || JUCE_MSVC
+	static void copyDataSSE3(float* dst, const float* src, int length) {
+		copyDataNormal(dst, src, length);
+	}
+
+	static void addDataSSE3(float* dst, const float* src, int length) {
+		addDataNormal(dst, src, length);
+	}
+
+	static void fillDataSSE3(float* dst, float data, int length) {
+		fillDataNormal(dst, data, length);
+	}
+
+	static void averageDataSSE3(float* dst, const float* src, int length) {
+		averageDataNormal(dst, src, length);
+	}
+
+	static void scaleDataSSE3(float* dst, float gain, int length) {
+		scaleDataNormal(dst, gain, length);
+	}
+
+	static void rampDataSSE3(float* dst, float start, float step, int length) {
+		rampDataNormal(dst, start, step, length);
+	}
+
+	static void mulAddDataSSE3(float* dst, const float* src, float gain, int length) {
+		mulAddDataNormal(dst, src, gain, length);
+	}
+
+	static void mulAddRampDataSSE3(float* dst, const float* src, float start, float step, int length) {
+		mulAddRampDataNormal(dst, src, start, step, length);
+	}
+
+	static void panDataSSE3(float* dstL, float* dstR, const float* src, float gainL, float gainR, int length) {
+		panDataNormal(dstL, dstR, src, gainL, gainR, length);
+	}
+
+	static void rangeDataSSE3(const float* src, int length, float& minV, float& maxV) {
+		rangeDataNormal(src, length, minV, maxV);
+	}
+
+	static void clampDataSSE3(float* dst, float minV, float maxV, int length) {
+		clampDataNormal(dst, minV, maxV, length);
+	}
+
+	static void int16DataSSE3(float* dst, const int16_t* src, int length) {
+		int16DataNormal(dst, src, length);
+	}
+
+	static void int24DataSSE3(float* dst, const uint8_t* src, int length) {
+		int24DataNormal(dst, src, length);
+	}
+
+	static void interleaveDataSSE3(float* dst, const float* srcL, const float* srcR, int length) {
+		interleaveDataNormal(dst, srcL, srcR, length);
+	}
+
+	static void deinterleaveDataSSE3(float* dstL, float* dstR, const float* src, int length) {
+		deinterleaveDataNormal(dstL, dstR, src, length);
+	}
+
+	static void levelDataSSE3(const float* src, int length, float& sumSquare, float& peak) {
+		levelDataNormal(src, length, sumSquare, peak);
+	}
+
+	static float truePeakSSE3(const float* src, int length, float* history) {
+		return truePeakNormal(src, length, history);
+	}
+
+#endif //__SSE3__ || JUCE_MSVC
+
+#if __AVX2__ || JUCE_MSVC
+	static void copyDataAVX2(float* dst, const float* src, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data = _mm256_loadu_ps(&(src[i]));
+			_mm256_storeu_ps(&(dst[i]), data);
+		}
+
+		copyDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+	}
+
+	static void addDataAVX2(float* dst, const float* src, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data0 = _mm256_loadu_ps(&(dst[i]));
+			__m256 data1 = _mm256_loadu_ps(&(src[i]));
+			__m256 result = _mm256_add_ps(data0, data1);
+			_mm256_storeu_ps(&(dst[i]), result);
+		}
+
+		addDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+	}
+
+	static void fillDataAVX2(float* dst, float data, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 dataV = _mm256_set1_ps(data);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			_mm256_storeu_ps(&(dst[i]), dataV);
+		}
+
+		fillDataNormal(&(dst[clipMax]), data, length - clipMax);
+	}
+
+	static void averageDataAVX2(float* dst, const float* src, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 averV = _mm256_set1_ps(0.5f);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data0 = _mm256_loadu_ps(&(dst[i]));
+			__m256 data1 = _mm256_loadu_ps(&(src[i]));
+			__m256 sum = _mm256_add_ps(data0, data1);
+			__m256 result = _mm256_mul_ps(sum, averV);
+			_mm256_storeu_ps(&(dst[i]), result);
+		}
+
+		averageDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+	}
+
+	static void scaleDataAVX2(float* dst, float gain, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 gainV = _mm256_set1_ps(gain);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data = _mm256_loadu_ps(&(dst[i]));
+			_mm256_storeu_ps(&(dst[i]), _mm256_mul_ps(data, gainV));
+		}
+
+		scaleDataNormal(&(dst[clipMax]), gain, length - clipMax);
+	}
+
+	static void rampDataAVX2(float* dst, float start, float step, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 laneV = _mm256_mul_ps(_mm256_set1_ps(step),
+			_mm256_set_ps(7.f, 6.f, 5.f, 4.f, 3.f, 2.f, 1.f, 0.f));
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data = _mm256_loadu_ps(&(dst[i]));
+			__m256 gain = _mm256_add_ps(_mm256_set1_ps(start + step * i), laneV);
+			_mm256_storeu_ps(&(dst[i]), _mm256_mul_ps(data, gain));
+		}
+
+		rampDataNormal(&(dst[clipMax]), start + step * clipMax, step, length - clipMax);
+	}
+
+	static void mulAddDataAVX2(float* dst, const float* src, float gain, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 gainV = _mm256_set1_ps(gain);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data0 = _mm256_loadu_ps(&(dst[i]));
+			__m256 data1 = _mm256_loadu_ps(&(src[i]));
+			_mm256_storeu_ps(&(dst[i]), _mm256_add_ps(data0, _mm256_mul_ps(data1, gainV)));
+		}
+
+		mulAddDataNormal(&(dst[clipMax]), &(src[clipMax]), gain, length - clipMax);
+	}
+
+	static void mulAddRampDataAVX2(float* dst, const float* src, float start, float step, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 laneV = _mm256_mul_ps(_mm256_set1_ps(step),
+			_mm256_set_ps(7.f, 6.f, 5.f, 4.f, 3.f, 2.f, 1.f, 0.f));
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data0 = _mm256_loadu_ps(&(dst[i]));
+			__m256 data1 = _mm256_loadu_ps(&(src[i]));
+			__m256 gain = _mm256_add_ps(_mm256_set1_ps(start + step * i), laneV);
+			_mm256_storeu_ps(&(dst[i]), _mm256_add_ps(data0, _mm256_mul_ps(data1, gain)));
+		}
+
+		mulAddRampDataNormal(&(dst[clipMax]), &(src[clipMax]), start + step * clipMax, step, length - clipMax);
+	}
+
+	static void panDataAVX2(float* dstL, float* dstR, const float* src, float gainL, float gainR, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 gainLV = _mm256_set1_ps(gainL);
+		__m256 gainRV = _mm256_set1_ps(gainR);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data = _mm256_loadu_ps(&(src[i]));
+			__m256 dataL = _mm256_loadu_ps(&(dstL[i]));
+			__m256 dataR = _mm256_loadu_ps(&(dstR[i]));
+			_mm256_storeu_ps(&(dstL[i]), _mm256_add_ps(dataL, _mm256_mul_ps(data, gainLV)));
+			_mm256_storeu_ps(&(dstR[i]), _mm256_add_ps(dataR, _mm256_mul_ps(data, gainRV)));
+		}
+
+		panDataNormal(&(dstL[clipMax]), &(dstR[clipMax]), &(src[clipMax]), gainL, gainR, length - clipMax);
+	}
+
+	static void rangeDataAVX2(const float* src, int length, float& minV, float& maxV) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 minVV = _mm256_set1_ps(minV);
+		__m256 maxVV = _mm256_set1_ps(maxV);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data = _mm256_loadu_ps(&(src[i]));
+			minVV = _mm256_min_ps(minVV, data);
+			maxVV = _mm256_max_ps(maxVV, data);
+		}
+
+		alignas(32) std::array<float, 8> minTemp, maxTemp;
+		_mm256_store_ps(minTemp.data(), minVV);
+		_mm256_store_ps(maxTemp.data(), maxVV);
+		for (int i = 0; i < clipSize; i++) {
+			minV = std::min(minV, minTemp[i]);
+			maxV = std::max(maxV, maxTemp[i]);
+		}
+
+		rangeDataNormal(&(src[clipMax]), length - clipMax, minV, maxV);
+	}
+
+	static void clampDataAVX2(float* dst, float minV, float maxV, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 minVV = _mm256_set1_ps(minV);
+		__m256 maxVV = _mm256_set1_ps(maxV);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data = _mm256_loadu_ps(&(dst[i]));
+			_mm256_storeu_ps(&(dst[i]), _mm256_min_ps(_mm256_max_ps(data, minVV), maxVV));
+		}
+
+		clampDataNormal(&(dst[clipMax]), minV, maxV, length - clipMax);
+	}
+
+	static void int16DataAVX2(float* dst, const int16_t* src, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 scaleV = _mm256_set1_ps(int16Scale);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&(src[i])));
+			__m256 result = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(data));
+			_mm256_storeu_ps(&(dst[i]), _mm256_mul_ps(result, scaleV));
+		}
+
+		int16DataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+	}
+
+	static void int24DataAVX2(float* dst, const uint8_t* src, int length) {
+		int clipSize = sizeof(__m128) / sizeof(float);
+		int clipNum = std::max(0, length - 2) / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		/** Move Every 3 Byte Sample Into The Top Of A 32 Bit Lane, Each Load Reads 4 Bytes Past The Clip */
+		__m128i shuffle = _mm_setr_epi8(
+			-1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11);
+		__m128 scaleV = _mm_set1_ps(int24Scale);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&(src[i * 3])));
+			__m128i result = _mm_srai_epi32(_mm_shuffle_epi8(data, shuffle), 8);
+			_mm_storeu_ps(&(dst[i]), _mm_mul_ps(_mm_cvtepi32_ps(result), scaleV));
+		}
+
+		int24DataNormal(&(dst[clipMax]), &(src[clipMax * 3]), length - clipMax);
+	}
+
+	static void interleaveDataAVX2(float* dst, const float* srcL, const float* srcR, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		/** Unpack Works Inside 128 Bit Lanes, Then The Lanes Are Put In Order */
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 dataL = _mm256_loadu_ps(&(srcL[i]));
+			__m256 dataR = _mm256_loadu_ps(&(srcR[i]));
+			__m256 low = _mm256_unpacklo_ps(dataL, dataR);
+			__m256 high = _mm256_unpackhi_ps(dataL, dataR);
+			_mm256_storeu_ps(&(dst[i * 2]), _mm256_permute2f128_ps(low, high, 0x20));
+			_mm256_storeu_ps(&(dst[i * 2 + 8]), _mm256_permute2f128_ps(low, high, 0x31));
+		}
+
+		interleaveDataNormal(&(dst[clipMax * 2]), &(srcL[clipMax]), &(srcR[clipMax]), length - clipMax);
+	}
+
+	static void deinterleaveDataAVX2(float* dstL, float* dstR, const float* src, int length) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data0 = _mm256_loadu_ps(&(src[i * 2]));
+			__m256 data1 = _mm256_loadu_ps(&(src[i * 2 + 8]));
+			__m256 low = _mm256_permute2f128_ps(data0, data1, 0x20);
+			__m256 high = _mm256_permute2f128_ps(data0, data1, 0x31);
+			_mm256_storeu_ps(&(dstL[i]), _mm256_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0)));
+			_mm256_storeu_ps(&(dstR[i]), _mm256_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1)));
+		}
+
+		deinterleaveDataNormal(&(dstL[clipMax]), &(dstR[clipMax]), &(src[clipMax * 2]), length - clipMax);
+	}
+
+	static void levelDataAVX2(const float* src, int length, float& sumSquare, float& peak) {
+		int clipSize = sizeof(__m256) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		__m256 sumV = _mm256_setzero_ps();
+		__m256 peakV = _mm256_setzero_ps();
+		__m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m256 data = _mm256_loadu_ps(&(src[i]));
+			sumV = _mm256_add_ps(sumV, _mm256_mul_ps(data, data));
+			peakV = _mm256_max_ps(peakV, _mm256_and_ps(data, absMask));
+		}
+
+		alignas(32) std::array<float, 8> sumTemp, peakTemp;
+		_mm256_store_ps(sumTemp.data(), sumV);
+		_mm256_store_ps(peakTemp.data(), peakV);
+		for (int i = 0; i < clipSize; i++) {
+			sumSquare += sumTemp[i];
+			peak = std::max(peak, peakTemp[i]);
+		}
+
+		levelDataNormal(&(src[clipMax]), length - clipMax, sumSquare, peak);
+	}
+
+	static float truePeakAVX2(const float* src, int length, float* history) {
+		return truePeakSSE3(src, length, history);
+	}
+
+#else //__AVX2__ || JUCE_MSVC
+	static void copyDataAVX2(float* dst, const float* src, int length) {
+		copyDataSSE3(dst, src, length);
+	}
+
+	static void addDataAVX2(float* dst, const float* src, int length) {
+		addDataSSE3(dst, src, length);
+	}
+
+	static void fillDataAVX2(float* dst, float data, int length) {
+		fillDataSSE3(dst, data, length);
+	}
+
+	static void averageDataAVX2(float* dst, const float* src, int length) {
+		averageDataSSE3(dst, src, length);
+	}
+
+	static void scaleDataAVX2(float* dst, float gain, int length) {
+		scaleDataSSE3(dst, gain, length);
+	}
+
+	static void rampDataAVX2(float* dst, float start, float step, int length) {
+		rampDataSSE3(dst, start, step, length);
+	}
+
+	static void mulAddDataAVX2(float* dst, const float* src, float gain, int length) {
+		mulAddDataSSE3(dst, src, gain, length);
+	}
+
+	static void mulAddRampDataAVX2(float* dst, const float* src, float start, float step, int length) {
+		mulAddRampDataSSE3(dst, src, start, step, length);
+	}
+
+	static void panDataAVX2(float* dstL, float* dstR, const float* src, float gainL, float gainR, int length) {
+		panDataSSE3(dstL, dstR, src, gainL, gainR, length);
+	}
+
+	static void rangeDataAVX2(const float* src, int length, float& minV, float& maxV) {
+		rangeDataSSE3(src, length, minV, maxV);
+	}
+
+	static void clampDataAVX2(float* dst, float minV, float maxV, int length) {
+		clampDataSSE3(dst, minV, maxV, length);
+	}
+
+	static void int16DataAVX2(float* dst, const int16_t* src, int length) {
+		int16DataSSE3(dst, src, length);
+	}
+
+	static void int24DataAVX2(float* dst, const uint8_t* src, int length) {
+		int24DataSSE3(dst, src, length);
+	}
+
+	static void interleaveDataAVX2(float* dst, const float* srcL, const float* srcR, int length) {
+		interleaveDataSSE3(dst, srcL, srcR, length);
+	}
+
+	static void deinterleaveDataAVX2(float* dstL, float* dstR, const float* src, int length) {
+		deinterleaveDataSSE3(dstL, dstR, src, length);
+	}
+
+	static void levelDataAVX2(const float* src, int length, float& sumSquare, float& peak) {
+		levelDataSSE3(src, length, sumSquare, peak);
+	}
+
+	static float truePeakAVX2(const float* src, int length, float* history) {
+		return truePeakSSE3(src, length, history);
+	}
+
+#endif //__AVX2__ || JUCE_MSVC
+
+#if __AVX512F__ || JUCE_MSVC
+	static void copyDataAVX512(float* dst, const float* src, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
+
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m512 data = _mm512_loadu_ps(&(src[i]));
+			_mm512_storeu_ps(&(dst[i]), data);
 		}
 
 		copyDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
 	}
 
-	static void addDataSSE3(float* dst, const float* src, int length) {
-		int clipSize = sizeof(__m128) / sizeof(float);
+	static void addDataAVX512(float* dst, const float* src, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
 		for (int i = 0; i < clipMax; i += clipSize) {
-			__m128 data0 = _mm_loadu_ps(&(dst[i]));
-			__m128 data1 = _mm_loadu_ps(&(src[i]));
-			__m128 result = _mm_add_ps(data0, data1);
-			_mm_storeu_ps(&(dst[i]), result);
+			__m512 data0 = _mm512_loadu_ps(&(dst[i]));
+			__m512 data1 = _mm512_loadu_ps(&(src[i]));
+			__m512 result = _mm512_add_ps(data0, data1);
+			_mm512_storeu_ps(&(dst[i]), result);
 		}
 
 		addDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
 	}
 
-	static void fillDataSSE3(float* dst, float data, int length) {
-		int clipSize = sizeof(__m128) / sizeof(float);
+	static void fillDataAVX512(float* dst, float data, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
-		__m128 dataV = _mm_set1_ps(data);
+		__m512 dataV = _mm512_set1_ps(data);
 		for (int i = 0; i < clipMax; i += clipSize) {
-			_mm_storeu_ps(&(dst[i]), dataV);
+			_mm512_storeu_ps(&(dst[i]), dataV);
 		}
 
 		fillDataNormal(&(dst[clipMax]), data, length - clipMax);
 	}
 
-	static void averageDataSSE3(float* dst, const float* src, int length) {
-		int clipSize = sizeof(__m128) / sizeof(float);
+	static void averageDataAVX512(float* dst, const float* src, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
-		__m128 averV = _mm_set1_ps(0.5f);
+		__m512 averV = _mm512_set1_ps(0.5f);
 		for (int i = 0; i < clipMax; i += clipSize) {
-			__m128 data0 = _mm_loadu_ps(&(dst[i]));
-			__m128 data1 = _mm_loadu_ps(&(src[i]));
-			__m128 sum = _mm_add_ps(data0, data1);
-			__m128 result = _mm_mul_ps(sum, averV);
-			_mm_storeu_ps(&(dst[i]), result);
+			__m512 data0 = _mm512_loadu_ps(&(dst[i]));
+			__m512 data1 = _mm512_loadu_ps(&(src[i]));
+			__m512 sum = _mm512_add_ps(data0, data1);
+			__m512 result = _mm512_mul_ps(sum, averV);
+			_mm512_storeu_ps(&(dst[i]), result);
 		}
 
 		averageDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
 	}
 
-#else //__SSE3__ || JUCE_MSVC
-	static void copyDataSSE3(float* dst, const float* src, int length) {
-		copyDataNormal(dst, src, length);
-	}
+	static void scaleDataAVX512(float* dst, float gain, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
 
-	static void addDataSSE3(float* dst, const float* src, int length) {
-		addDataNormal(dst, src, length);
-	}
+		__m512 gainV = _mm512_set1_ps(gain);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m512 data = _mm512_loadu_ps(&(dst[i]));
+			_mm512_storeu_ps(&(dst[i]), _mm512_mul_ps(data, gainV));
+		}
 
-	static void fillDataSSE3(float* dst, float data, int length) {
-		fillDataNormal(dst, data, length);
+		scaleDataNormal(&(dst[clipMax]), gain, length - clipMax);
 	}
 
-	static void averageDataSSE3(float* dst, const float* src, int length) {
-		averageDataNormal(dst, src, length);
-	}
+	static void rampDataAVX512(float* dst, float start, float step, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
 
-#endif //__SSE3__ || JUCE_MSVC
+		__m512 laneV = _mm512_mul_ps(_mm512_set1_ps(step),
+			_mm512_set_ps(15.f, 14.f, 13.f, 12.f, 11.f, 10.f, 9.f, 8.f,
+				7.f, 6.f, 5.f, 4.f, 3.f, 2.f, 1.f, 0.f));
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m512 data = _mm512_loadu_ps(&(dst[i]));
+			__m512 gain = _mm512_add_ps(_mm512_set1_ps(start + step * i), laneV);
+			_mm512_storeu_ps(&(dst[i]), _mm512_mul_ps(data, gain));
+		}
 
-#if __AVX2__ || JUCE_MSVC
-	static void copyDataAVX2(float* dst, const float* src, int length) {
-		int clipSize = sizeof(__m256) / sizeof(float);
+		rampDataNormal(&(dst[clipMax]), start + step * clipMax, step, length - clipMax);
+	}
+
+	static void mulAddDataAVX512(float* dst, const float* src, float gain, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
+		__m512 gainV = _mm512_set1_ps(gain);
 		for (int i = 0; i < clipMax; i += clipSize) {
-			__m256 data = _mm256_loadu_ps(&(src[i]));
-			_mm256_storeu_ps(&(dst[i]), data);
+			__m512 data0 = _mm512_loadu_ps(&(dst[i]));
+			__m512 data1 = _mm512_loadu_ps(&(src[i]));
+			_mm512_storeu_ps(&(dst[i]), _mm512_add_ps(data0, _mm512_mul_ps(data1, gainV)));
 		}
 
-		copyDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+		mulAddDataNormal(&(dst[clipMax]), &(src[clipMax]), gain, length - clipMax);
 	}
 
-	static void addDataAVX2(float* dst, const float* src, int length) {
-		int clipSize = sizeof(__m256) / sizeof(float);
+	static void mulAddRampDataAVX512(float* dst, const float* src, float start, float step, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
+		__m512 laneV = _mm512_mul_ps(_mm512_set1_ps(step),
+			_mm512_set_ps(15.f, 14.f, 13.f, 12.f, 11.f, 10.f, 9.f, 8.f,
+				7.f, 6.f, 5.f, 4.f, 3.f, 2.f, 1.f, 0.f));
 		for (int i = 0; i < clipMax; i += clipSize) {
-			__m256 data0 = _mm256_loadu_ps(&(dst[i]));
-			__m256 data1 = _mm256_loadu_ps(&(src[i]));
-			__m256 result = _mm256_add_ps(data0, data1);
-			_mm256_storeu_ps(&(dst[i]), result);
+			__m512 data0 = _mm512_loadu_ps(&(dst[i]));
+			__m512 data1 = _mm512_loadu_ps(&(src[i]));
+			__m512 gain = _mm512_add_ps(_mm512_set1_ps(start + step * i), laneV);
+			_mm512_storeu_ps(&(dst[i]), _mm512_add_ps(data0, _mm512_mul_ps(data1, gain)));
 		}
 
-		addDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+		mulAddRampDataNormal(&(dst[clipMax]), &(src[clipMax]), start + step * clipMax, step, length - clipMax);
 	}
 
-	static void fillDataAVX2(float* dst, float data, int length) {
-		int clipSize = sizeof(__m256) / sizeof(float);
+	static void panDataAVX512(float* dstL, float* dstR, const float* src, float gainL, float gainR, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
-		__m256 dataV = _mm256_set1_ps(data);
+		__m512 gainLV = _mm512_set1_ps(gainL);
+		__m512 gainRV = _mm512_set1_ps(gainR);
 		for (int i = 0; i < clipMax; i += clipSize) {
-			_mm256_storeu_ps(&(dst[i]), dataV);
+			__m512 data = _mm512_loadu_ps(&(src[i]));
+			__m512 dataL = _mm512_loadu_ps(&(dstL[i]));
+			__m512 dataR = _mm512_loadu_ps(&(dstR[i]));
+			_mm512_storeu_ps(&(dstL[i]), _mm512_add_ps(dataL, _mm512_mul_ps(data, gainLV)));
+			_mm512_storeu_ps(&(dstR[i]), _mm512_add_ps(dataR, _mm512_mul_ps(data, gainRV)));
 		}
 
-		fillDataNormal(&(dst[clipMax]), data, length - clipMax);
+		panDataNormal(&(dstL[clipMax]), &(dstR[clipMax]), &(src[clipMax]), gainL, gainR, length - clipMax);
 	}
 
-	static void averageDataAVX2(float* dst, const float* src, int length) {
-		int clipSize = sizeof(__m256) / sizeof(float);
+	static void rangeDataAVX512(const float* src, int length, float& minV, float& maxV) {
+		int clipSize = sizeof(__m512) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
-		__m256 averV = _mm256_set1_ps(0.5f);
+		__m512 minVV = _mm512_set1_ps(minV);
+		__m512 maxVV = _mm512_set1_ps(maxV);
 		for (int i = 0; i < clipMax; i += clipSize) {
-			__m256 data0 = _mm256_loadu_ps(&(dst[i]));
-			__m256 data1 = _mm256_loadu_ps(&(src[i]));
-			__m256 sum = _mm256_add_ps(data0, data1);
-			__m256 result = _mm256_mul_ps(sum, averV);
-			_mm256_storeu_ps(&(dst[i]), result);
+			__m512 data = _mm512_loadu_ps(&(src[i]));
+			minVV = _mm512_min_ps(minVV, data);
+			maxVV = _mm512_max_ps(maxVV, data);
 		}
 
-		averageDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
-	}
+		minV = std::min(minV, _mm512_reduce_min_ps(minVV));
+		maxV = std::max(maxV, _mm512_reduce_max_ps(maxVV));
 
-#else //__AVX2__ || JUCE_MSVC
-	static void copyDataAVX2(float* dst, const float* src, int length) {
-		copyDataSSE3(dst, src, length);
+		rangeDataNormal(&(src[clipMax]), length - clipMax, minV, maxV);
 	}
 
-	static void addDataAVX2(float* dst, const float* src, int length) {
-		addDataSSE3(dst, src, length);
-	}
+	static void clampDataAVX512(float* dst, float minV, float maxV, int length) {
+		int clipSize = sizeof(__m512) / sizeof(float);
+		int clipNum = length / clipSize;
+		int clipMax = clipNum * clipSize;
 
-	static void fillDataAVX2(float* dst, float data, int length) {
-		fillDataSSE3(dst, data, length);
-	}
+		__m512 minVV = _mm512_set1_ps(minV);
+		__m512 maxVV = _mm512_set1_ps(maxV);
+		for (int i = 0; i < clipMax; i += clipSize) {
+			__m512 data = _mm512_loadu_ps(&(dst[i]));
+			_mm512_storeu_ps(&(dst[i]), _mm512_min_ps(_mm512_max_ps(data, minVV), maxVV));
+		}
 
-	static void averageDataAVX2(float* dst, const float* src, int length) {
-		averageDataSSE3(dst, src, length);
+		clampDataNormal(&(dst[clipMax]), minV, maxV, length - clipMax);
 	}
 
-#endif //__AVX2__ || JUCE_MSVC
-
-#if __AVX512F__ || JUCE_MSVC
-	static void copyDataAVX512(float* dst, const float* src, int length) {
+	static void int16DataAVX512(float* dst, const int16_t* src, int length) {
 		int clipSize = sizeof(__m512) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
+		__m512 scaleV = _mm512_set1_ps(int16Scale);
 		for (int i = 0; i < clipMax; i += clipSize) {
-			__m512 data = _mm512_loadu_ps(&(src[i]));
-			_mm512_storeu_ps(&(dst[i]), data);
+			__m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&(src[i])));
+			__m512 result = _mm512_cvtepi32_ps(_mm512_cvtepi16_epi32(data));
+			_mm512_storeu_ps(&(dst[i]), _mm512_mul_ps(result, scaleV));
 		}
 
-		copyDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+		int16DataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
 	}
 
-	static void addDataAVX512(float* dst, const float* src, int length) {
+	static void int24DataAVX512(float* dst, const uint8_t* src, int length) {
+		int24DataAVX2(dst, src, length);
+	}
+
+	static void interleaveDataAVX512(float* dst, const float* srcL, const float* srcR, int length) {
 		int clipSize = sizeof(__m512) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
+		/** Index 16 And Above Picks From The Right Channel */
+		__m512i lowIndex = _mm512_setr_epi32(
+			0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+		__m512i highIndex = _mm512_setr_epi32(
+			8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
 		for (int i = 0; i < clipMax; i += clipSize) {
-			__m512 data0 = _mm512_loadu_ps(&(dst[i]));
-			__m512 data1 = _mm512_loadu_ps(&(src[i]));
-			__m512 result = _mm512_add_ps(data0, data1);
-			_mm512_storeu_ps(&(dst[i]), result);
+			__m512 dataL = _mm512_loadu_ps(&(srcL[i]));
+			__m512 dataR = _mm512_loadu_ps(&(srcR[i]));
+			_mm512_storeu_ps(&(dst[i * 2]), _mm512_permutex2var_ps(dataL, lowIndex, dataR));
+			_mm512_storeu_ps(&(dst[i * 2 + 16]), _mm512_permutex2var_ps(dataL, highIndex, dataR));
 		}
 
-		addDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+		interleaveDataNormal(&(dst[clipMax * 2]), &(srcL[clipMax]), &(srcR[clipMax]), length - clipMax);
 	}
 
-	static void fillDataAVX512(float* dst, float data, int length) {
+	static void deinterleaveDataAVX512(float* dstL, float* dstR, const float* src, int length) {
 		int clipSize = sizeof(__m512) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
-		__m512 dataV = _mm512_set1_ps(data);
+		__m512i leftIndex = _mm512_setr_epi32(
+			0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+		__m512i rightIndex = _mm512_setr_epi32(
+			1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
 		for (int i = 0; i < clipMax; i += clipSize) {
-			_mm512_storeu_ps(&(dst[i]), dataV);
+			__m512 data0 = _mm512_loadu_ps(&(src[i * 2]));
+			__m512 data1 = _mm512_loadu_ps(&(src[i * 2 + 16]));
+			_mm512_storeu_ps(&(dstL[i]), _mm512_permutex2var_ps(data0, leftIndex, data1));
+			_mm512_storeu_ps(&(dstR[i]), _mm512_permutex2var_ps(data0, rightIndex, data1));
 		}
 
-		fillDataNormal(&(dst[clipMax]), data, length - clipMax);
+		deinterleaveDataNormal(&(dstL[clipMax]), &(dstR[clipMax]), &(src[clipMax * 2]), length - clipMax);
 	}
 
-	static void averageDataAVX512(float* dst, const float* src, int length) {
+	static void levelDataAVX512(const float* src, int length, float& sumSquare, float& peak) {
 		int clipSize = sizeof(__m512) / sizeof(float);
 		int clipNum = length / clipSize;
 		int clipMax = clipNum * clipSize;
 
-		__m512 averV = _mm512_set1_ps(0.5f);
+		__m512 sumV = _mm512_setzero_ps();
+		__m512 peakV = _mm512_setzero_ps();
 		for (int i = 0; i < clipMax; i += clipSize) {
-			__m512 data0 = _mm512_loadu_ps(&(dst[i]));
-			__m512 data1 = _mm512_loadu_ps(&(src[i]));
-			__m512 sum = _mm512_add_ps(data0, data1);
-			__m512 result = _mm512_mul_ps(sum, averV);
-			_mm512_storeu_ps(&(dst[i]), result);
+			__m512 data = _mm512_loadu_ps(&(src[i]));
+			sumV = _mm512_add_ps(sumV, _mm512_mul_ps(data, data));
+			peakV = _mm512_max_ps(peakV, _mm512_abs_ps(data));
 		}
 
-		averageDataNormal(&(dst[clipMax]), &(src[clipMax]), length - clipMax);
+		sumSquare += _mm512_reduce_add_ps(sumV);
+		peak = std::max(peak, _mm512_reduce_max_ps(peakV));
+
+		levelDataNormal(&(src[clipMax]), length - clipMax, sumSquare, peak);
+	}
+
+	static float truePeakAVX512(const float* src, int length, float* history) {
+		return truePeakAVX2(src, length, history);
 	}
 
 #else //__AVX512F__ || JUCE_MSVC
@@ -259,6 +1158,58 @@ namespace vMath {
 		averageDataAVX2(dst, src, length);
 	}
 
+	static void scaleDataAVX512(float* dst, float gain, int length) {
+		scaleDataAVX2(dst, gain, length);
+	}
+
+	static void rampDataAVX512(float* dst, float start, float step, int length) {
+		rampDataAVX2(dst, start, step, length);
+	}
+
+	static void mulAddDataAVX512(float* dst, const float* src, float gain, int length) {
+		mulAddDataAVX2(dst, src, gain, length);
+	}
+
+	static void mulAddRampDataAVX512(float* dst, const float* src, float start, float step, int length) {
+		mulAddRampDataAVX2(dst, src, start, step, length);
+	}
+
+	static void panDataAVX512(float* dstL, float* dstR, const float* src, float gainL, float gainR, int length) {
+		panDataAVX2(dstL, dstR, src, gainL, gainR, length);
+	}
+
+	static void rangeDataAVX512(const float* src, int length, float& minV, float& maxV) {
+		rangeDataAVX2(src, length, minV, maxV);
+	}
+
+	static void clampDataAVX512(float* dst, float minV, float maxV, int length) {
+		clampDataAVX2(dst, minV, maxV, length);
+	}
+
+	static void int16DataAVX512(float* dst, const int16_t* src, int length) {
+		int16DataAVX2(dst, src, length);
+	}
+
+	static void int24DataAVX512(float* dst, const uint8_t* src, int length) {
+		int24DataAVX2(dst, src, length);
+	}
+
+	static void interleaveDataAVX512(float* dst, const float* srcL, const float* srcR, int length) {
+		interleaveDataAVX2(dst, srcL, srcR, length);
+	}
+
+	static void deinterleaveDataAVX512(float* dstL, float* dstR, const float* src, int length) {
+		deinterleaveDataAVX2(dstL, dstR, src, length);
+	}
+
+	static void levelDataAVX512(const float* src, int length, float& sumSquare, float& peak) {
+		levelDataAVX2(src, length, sumSquare, peak);
+	}
+
+	static float truePeakAVX512(const float* src, int length, float* history) {
+		return truePeakAVX2(src, length, history);
+	}
+
 #endif //__AVX512F__ || JUCE_MSVC
 
 	static InsType type = InsType::Normal;
@@ -266,6 +1217,19 @@ namespace vMath {
 	static auto addData = addDataNormal;
 	static auto fillData = fillDataNormal;
 	static auto averageData = averageDataNormal;
+	static auto scaleData = scaleDataNormal;
+	static auto rampData = rampDataNormal;
+	static auto mulAddData = mulAddDataNormal;
+	static auto mulAddRampData = mulAddRampDataNormal;
+	static auto panData = panDataNormal;
+	static auto rangeData = rangeDataNormal;
+	static auto clampData = clampDataNormal;
+	static auto int16Data = int16DataNormal;
+	static auto int24Data = int24DataNormal;
+	static auto interleaveData = interleaveDataNormal;
+	static auto deinterleaveData = deinterleaveDataNormal;
+	static auto levelData = levelDataNormal;
+	static auto truePeak = truePeakNormal;
 
 	void setInsType(InsType type) {
 		/** Check And Fallback */
@@ -289,11 +1253,50 @@ namespace vMath {
 			= { vMath::fillDataNormal, vMath::fillDataSSE3, vMath::fillDataAVX2, vMath::fillDataAVX512 };
 		constexpr std::array<decltype(vMath::averageData), InsType::MaxNum> averageDataList
 			= { vMath::averageDataNormal, vMath::averageDataSSE3, vMath::averageDataAVX2, vMath::averageDataAVX512 };
+		constexpr std::array<decltype(vMath::scaleData), InsType::MaxNum> scaleDataList
+			= { vMath::scaleDataNormal, vMath::scaleDataSSE3, vMath::scaleDataAVX2, vMath::scaleDataAVX512 };
+		constexpr std::array<decltype(vMath::rampData), InsType::MaxNum> rampDataList
+			= { vMath::rampDataNormal, vMath::rampDataSSE3, vMath::rampDataAVX2, vMath::rampDataAVX512 };
+		constexpr std::array<decltype(vMath::mulAddData), InsType::MaxNum> mulAddDataList
+			= { vMath::mulAddDataNormal, vMath::mulAddDataSSE3, vMath::mulAddDataAVX2, vMath::mulAddDataAVX512 };
+		constexpr std::array<decltype(vMath::mulAddRampData), InsType::MaxNum> mulAddRampDataList
+			= { vMath::mulAddRampDataNormal, vMath::mulAddRampDataSSE3, vMath::mulAddRampDataAVX2, vMath::mulAddRampDataAVX512 };
+		constexpr std::array<decltype(vMath::panData), InsType::MaxNum> panDataList
+			= { vMath::panDataNormal, vMath::panDataSSE3, vMath::panDataAVX2, vMath::panDataAVX512 };
+		constexpr std::array<decltype(vMath::rangeData), InsType::MaxNum> rangeDataList
+			= { vMath::rangeDataNormal, vMath::rangeDataSSE3, vMath::rangeDataAVX2, vMath::rangeDataAVX512 };
+		constexpr std::array<decltype(vMath::clampData), InsType::MaxNum> clampDataList
+			= { vMath::clampDataNormal, vMath::clampDataSSE3, vMath::clampDataAVX2, vMath::clampDataAVX512 };
+		constexpr std::array<decltype(vMath::int16Data), InsType::MaxNum> int16DataList
+			= { vMath::int16DataNormal, vMath::int16DataSSE3, vMath::int16DataAVX2, vMath::int16DataAVX512 };
+		constexpr std::array<decltype(vMath::int24Data), InsType::MaxNum> int24DataList
+			= { vMath::int24DataNormal, vMath::int24DataSSE3, vMath::int24DataAVX2, vMath::int24DataAVX512 };
+		constexpr std::array<decltype(vMath::interleaveData), InsType::MaxNum> interleaveDataList
+			= { vMath::interleaveDataNormal, vMath::interleaveDataSSE3, vMath::interleaveDataAVX2, vMath::interleaveDataAVX512 };
+		constexpr std::array<decltype(vMath::deinterleaveData), InsType::MaxNum> deinterleaveDataList
+			= { vMath::deinterleaveDataNormal, vMath::deinterleaveDataSSE3, vMath::deinterleaveDataAVX2, vMath::deinterleaveDataAVX512 };
+		constexpr std::array<decltype(vMath::levelData), InsType::MaxNum> levelDataList
+			= { vMath::levelDataNormal, vMath::levelDataSSE3, vMath::levelDataAVX2, vMath::levelDataAVX512 };
+		constexpr std::array<decltype(vMath::truePeak), InsType::MaxNum> truePeakList
+			= { vMath::truePeakNormal, vMath::truePeakSSE3, vMath::truePeakAVX2, vMath::truePeakAVX512 };
 		
 		vMath::copyData = copyDataList[type];
 		vMath::addData = addDataList[type];
 		vMath::fillData = fillDataList[type];
 		vMath::averageData = averageDataList[type];
+		vMath::scaleData = scaleDataList[type];
+		vMath::rampData = rampDataList[type];
+		vMath::mulAddData = mulAddDataList[type];
+		vMath::mulAddRampData = mulAddRampDataList[type];
+		vMath::panData = panDataList[type];
+		vMath::rangeData = rangeDataList[type];
+		vMath::clampData = clampDataList[type];
+		vMath::int16Data = int16DataList[type];
+		vMath::int24Data = int24DataList[type];
+		vMath::interleaveData = interleaveDataList[type];
+		vMath::deinterleaveData = deinterleaveDataList[type];
+		vMath::levelData = levelDataList[type];
+		vMath::truePeak = truePeakList[type];
 	}
 
 	InsType getInsType() {
@@ -359,4 +1362,167 @@ namespace vMath {
 			zeroAllAudioDataOnChannel(dst, i);
 		}
 	}
+
+	void applyGainRamp(juce::AudioSampleBuffer& dst, float startGain, float endGain,
+		int dstStartSample, int dstChannel, int length) {
+		auto wPtr = dst.getWritePointer(dstChannel);
+		if (!wPtr || length <= 0) { return; }
+
+		rampData(&(wPtr[dstStartSample]), startGain, (endGain - startGain) / length, length);
+	}
+
+	void applyChannelGains(juce::AudioSampleBuffer& dst, const float* startGains, const float* endGains,
+		int dstStartSample, int channels, int length) {
+		if (length <= 0) { return; }
+
+		channels = std::min(channels, dst.getNumChannels());
+		for (int i = 0; i < channels; i++) {
+			auto wPtr = dst.getWritePointer(i);
+			if (!wPtr) { continue; }
+
+			/** Steady Gains Skip The Ramp, Unity Skips The Channel */
+			float startGain = startGains[i], endGain = endGains[i];
+			if (startGain != endGain) {
+				rampData(&(wPtr[dstStartSample]), startGain, (endGain - startGain) / length, length);
+			}
+			else if (startGain == 0.f) {
+				fillData(&(wPtr[dstStartSample]), 0.f, length);
+			}
+			else if (startGain != 1.f) {
+				scaleData(&(wPtr[dstStartSample]), startGain, length);
+			}
+		}
+	}
+
+	void addAudioDataWithGain(juce::AudioSampleBuffer& dst, const juce::AudioSampleBuffer& src,
+		int dstStartSample, int srcStartSample, int dstChannel, int srcChannel, int length, float gain) {
+		auto wPtr = dst.getWritePointer(dstChannel);
+		auto rPtr = src.getReadPointer(srcChannel);
+		if (!wPtr || !rPtr || length <= 0) { return; }
+
+		mulAddData(&(wPtr[dstStartSample]), &(rPtr[srcStartSample]), gain, length);
+	}
+
+	void addAudioDataWithGainRamp(juce::AudioSampleBuffer& dst, const juce::AudioSampleBuffer& src,
+		int dstStartSample, int srcStartSample, int dstChannel, int srcChannel, int length,
+		float startGain, float endGain) {
+		auto wPtr = dst.getWritePointer(dstChannel);
+		auto rPtr = src.getReadPointer(srcChannel);
+		if (!wPtr || !rPtr || length <= 0) { return; }
+
+		mulAddRampData(&(wPtr[dstStartSample]), &(rPtr[srcStartSample]),
+			startGain, (endGain - startGain) / length, length);
+	}
+
+	void addAudioDataWithPan(juce::AudioSampleBuffer& dst, const juce::AudioSampleBuffer& src,
+		int dstStartSample, int srcStartSample, int srcChannel, int length, float pan) {
+		if (dst.getNumChannels() < 2) { return; }
+		auto wPtrL = dst.getWritePointer(0);
+		auto wPtrR = dst.getWritePointer(1);
+		auto rPtr = src.getReadPointer(srcChannel);
+		if (!wPtrL || !wPtrR || !rPtr || length <= 0) { return; }
+
+		pan = juce::jlimit(-1.f, 1.f, pan);
+		panData(&(wPtrL[dstStartSample]), &(wPtrR[dstStartSample]), &(rPtr[srcStartSample]),
+			std::min(1.f, 1.f - pan), std::min(1.f, 1.f + pan), length);
+	}
+
+	void clampAudioData(juce::AudioSampleBuffer& dst, float minValue, float maxValue,
+		int dstStartSample, int dstChannel, int length) {
+		auto wPtr = dst.getWritePointer(dstChannel);
+		if (!wPtr || length <= 0) { return; }
+
+		clampData(&(wPtr[dstStartSample]), minValue, maxValue, length);
+	}
+
+	const std::tuple<float, float> getAudioDataRange(const juce::AudioSampleBuffer& src,
+		int srcStartSample, int srcChannel, int length) {
+		auto rPtr = src.getReadPointer(srcChannel);
+		if (!rPtr || length <= 0) { return { 0.f, 0.f }; }
+
+		float minV = rPtr[srcStartSample], maxV = rPtr[srcStartSample];
+		rangeData(&(rPtr[srcStartSample]), length, minV, maxV);
+		return { minV, maxV };
+	}
+
+	float getAudioDataRMS(const juce::AudioSampleBuffer& src,
+		int srcStartSample, int srcChannel, int length) {
+		auto data = getLevelData(src, srcStartSample, srcChannel, length);
+		return (length > 0) ? std::sqrt(data.sumSquare / length) : 0.f;
+	}
+
+	float getAudioDataPeak(const juce::AudioSampleBuffer& src,
+		int srcStartSample, int srcChannel, int length) {
+		return getLevelData(src, srcStartSample, srcChannel, length).peak;
+	}
+
+	void copyInt16AudioData(juce::AudioSampleBuffer& dst, const int16_t* src,
+		int dstStartSample, int dstChannel, int length) {
+		auto wPtr = dst.getWritePointer(dstChannel);
+		if (!wPtr || !src || length <= 0) { return; }
+
+		int16Data(&(wPtr[dstStartSample]), src, length);
+	}
+
+	void copyInt24AudioData(juce::AudioSampleBuffer& dst, const void* src,
+		int dstStartSample, int dstChannel, int length) {
+		auto wPtr = dst.getWritePointer(dstChannel);
+		if (!wPtr || !src || length <= 0) { return; }
+
+		int24Data(&(wPtr[dstStartSample]), static_cast<const uint8_t*>(src), length);
+	}
+
+	void interleaveAudioData(float* dst, const juce::AudioSampleBuffer& src,
+		int srcStartSample, int length) {
+		int channels = src.getNumChannels();
+		if (!dst || channels <= 0 || length <= 0) { return; }
+
+		/** Stereo Goes Through The Vector Kernel */
+		if (channels == 2) {
+			interleaveData(dst, &(src.getReadPointer(0)[srcStartSample]),
+				&(src.getReadPointer(1)[srcStartSample]), length);
+			return;
+		}
+
+		for (int c = 0; c < channels; c++) {
+			auto rPtr = src.getReadPointer(c);
+			for (int i = 0; i < length; i++) {
+				dst[i * channels + c] = rPtr[srcStartSample + i];
+			}
+		}
+	}
+
+	void deinterleaveAudioData(juce::AudioSampleBuffer& dst, const float* src,
+		int dstStartSample, int length) {
+		int channels = dst.getNumChannels();
+		if (!src || channels <= 0 || length <= 0) { return; }
+
+		if (channels == 2) {
+			deinterleaveData(&(dst.getWritePointer(0)[dstStartSample]),
+				&(dst.getWritePointer(1)[dstStartSample]), src, length);
+			return;
+		}
+
+		for (int c = 0; c < channels; c++) {
+			auto wPtr = dst.getWritePointer(c);
+			for (int i = 0; i < length; i++) {
+				wPtr[dstStartSample + i] = src[i * channels + c];
+			}
+		}
+	}
+
+	const LevelData getLevelData(const juce::AudioSampleBuffer& src,
+		int srcStartSample, int srcChannel, int length, float* truePeakHistory) {
+		LevelData result;
+		auto rPtr = src.getReadPointer(srcChannel);
+		if (!rPtr || length <= 0) { return result; }
+
+		levelData(&(rPtr[srcStartSample]), length, result.sumSquare, result.peak);
+		if (truePeakHistory) {
+			result.truePeak = std::max(result.peak,
+				truePeak(&(rPtr[srcStartSample]), length, truePeakHistory));
+		}
+
+		return result;
+	}
 }
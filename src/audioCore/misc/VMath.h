@@ -25,4 +25,70 @@ namespace vMath {
 		int dstStartSample, int length);
 	void zeroAllAudioDataOnChannel(juce::AudioSampleBuffer& dst, int dstChannel);
 	void zeroAllAudioData(juce::AudioSampleBuffer& dst);
+
+	/**
+	 * @brief	Multiply samples by a linear gain ramp, reaching endGain one sample past the range.
+	 */
+	void applyGainRamp(juce::AudioSampleBuffer& dst, float startGain, float endGain,
+		int dstStartSample, int dstChannel, int length);
+	/**
+	 * @brief	Apply a gain to each of the first channels in a single pass, ramping like applyGainRamp when start and end differ.
+	 */
+	void applyChannelGains(juce::AudioSampleBuffer& dst, const float* startGains, const float* endGains,
+		int dstStartSample, int channels, int length);
+
+	void addAudioDataWithGain(juce::AudioSampleBuffer& dst, const juce::AudioSampleBuffer& src,
+		int dstStartSample, int srcStartSample, int dstChannel, int srcChannel, int length, float gain);
+	/**
+	 * @brief	Add samples multiplied by a linear gain ramp, reaching endGain one sample past the range.
+	 */
+	void addAudioDataWithGainRamp(juce::AudioSampleBuffer& dst, const juce::AudioSampleBuffer& src,
+		int dstStartSample, int srcStartSample, int dstChannel, int srcChannel, int length,
+		float startGain, float endGain);
+	/**
+	 * @brief	Add a mono channel onto the first two channels with the balanced pan rule.
+	 */
+	void addAudioDataWithPan(juce::AudioSampleBuffer& dst, const juce::AudioSampleBuffer& src,
+		int dstStartSample, int srcStartSample, int srcChannel, int length, float pan);
+	void clampAudioData(juce::AudioSampleBuffer& dst, float minValue, float maxValue,
+		int dstStartSample, int dstChannel, int length);
+
+	/** Min, Max */
+	const std::tuple<float, float> getAudioDataRange(const juce::AudioSampleBuffer& src,
+		int srcStartSample, int srcChannel, int length);
+	float getAudioDataRMS(const juce::AudioSampleBuffer& src,
+		int srcStartSample, int srcChannel, int length);
+	float getAudioDataPeak(const juce::AudioSampleBuffer& src,
+		int srcStartSample, int srcChannel, int length);
+
+	void copyInt16AudioData(juce::AudioSampleBuffer& dst, const int16_t* src,
+		int dstStartSample, int dstChannel, int length);
+	/**
+	 * @brief	Convert little endian packed 24 bit samples, 3 bytes per sample.
+	 */
+	void copyInt24AudioData(juce::AudioSampleBuffer& dst, const void* src,
+		int dstStartSample, int dstChannel, int length);
+
+	/**
+	 * @brief	Interleave every channel of the buffer into dst, which holds length * channels samples.
+	 */
+	void interleaveAudioData(float* dst, const juce::AudioSampleBuffer& src,
+		int srcStartSample, int length);
+	void deinterleaveAudioData(juce::AudioSampleBuffer& dst, const float* src,
+		int dstStartSample, int length);
+
+	struct LevelData final {
+		float sumSquare = 0.f;
+		float peak = 0.f;
+		float truePeak = 0.f;
+	};
+	/** Samples Kept Between Blocks By The 4x Oversampling True Peak Filter */
+	constexpr int truePeakHistorySize = 11;
+
+	/**
+	 * @brief	Get sum of squares and sample peak, plus the 4x oversampled true peak when a history is given.
+	 * @attention	The history holds truePeakHistorySize samples and is updated with the end of this block.
+	 */
+	const LevelData getLevelData(const juce::AudioSampleBuffer& src,
+		int srcStartSample, int srcChannel, int length, float* truePeakHistory = nullptr);
 }
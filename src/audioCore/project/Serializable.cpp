@@ -1,7 +1,7 @@
 ﻿#include "Serializable.h"
 #include "../Utils.h"
 
-SerializeConfig Serializable::createSerializeConfigQuickly() {
+SerializeConfig Serializable::createSerializeConfigQuickly(const juce::String& sidecarID) {
 	SerializeConfig config{};
 
 	config.projectDir = utils::getProjectDir().getFullPathName();
@@ -9,11 +9,19 @@ SerializeConfig Serializable::createSerializeConfigQuickly() {
 	config.projectFilePath = juce::File{ config.projectDir }
 		.getChildFile("./" + config.projectFileName).getFullPathName();
 	config.araDir = utils::getARADataDir(config.projectDir, config.projectFileName).getFullPathName();
+	config.freezeDir = utils::getFreezeDataDir(config.projectDir, config.projectFileName).getFullPathName();
+	config.automationDir = utils::getAutomationDataDir(config.projectDir, config.projectFileName).getFullPathName();
+
+	/** Keep Sidecar Data Of Different States Apart */
+	if (sidecarID.isNotEmpty()) {
+		config.freezeDir = juce::File{ config.freezeDir }.getChildFile("./" + sidecarID + "/").getFullPathName();
+		config.automationDir = juce::File{ config.automationDir }.getChildFile("./" + sidecarID + "/").getFullPathName();
+	}
 
 	return config;
 }
 
-ParseConfig Serializable::createParseConfigQuickly() {
+ParseConfig Serializable::createParseConfigQuickly(const juce::String& sidecarID) {
 	ParseConfig config{};
 
 	config.projectDir = utils::getProjectDir().getFullPathName();
@@ -21,6 +29,14 @@ ParseConfig Serializable::createParseConfigQuickly() {
 	config.projectFilePath = juce::File{ config.projectDir }
 	.getChildFile("./" + config.projectFileName).getFullPathName();
 	config.araDir = utils::getARADataDir(config.projectDir, config.projectFileName).getFullPathName();
+	config.freezeDir = utils::getFreezeDataDir(config.projectDir, config.projectFileName).getFullPathName();
+	config.automationDir = utils::getAutomationDataDir(config.projectDir, config.projectFileName).getFullPathName();
+
+	/** Keep Sidecar Data Of Different States Apart */
+	if (sidecarID.isNotEmpty()) {
+		config.freezeDir = juce::File{ config.freezeDir }.getChildFile("./" + sidecarID + "/").getFullPathName();
+		config.automationDir = juce::File{ config.automationDir }.getChildFile("./" + sidecarID + "/").getFullPathName();
+	}
 
 	return config;
 }
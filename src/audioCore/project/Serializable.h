@@ -9,8 +9,12 @@ public:
 	Serializable() = default;
 	virtual ~Serializable() = default;
 
-	static SerializeConfig createSerializeConfigQuickly();
-	static ParseConfig createParseConfigQuickly();
+	/**
+	 * @brief	Config in the project dir for quick state saving.
+	 * @attention	Sidecar data goes to a sub dir named by sidecarID if set. Use a unique ID for each saved state.
+	 */
+	static SerializeConfig createSerializeConfigQuickly(const juce::String& sidecarID = juce::String{});
+	static ParseConfig createParseConfigQuickly(const juce::String& sidecarID = juce::String{});
 
 public:
 	virtual bool parse(
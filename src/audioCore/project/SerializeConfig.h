@@ -7,6 +7,8 @@ struct SerializeConfig {
 	juce::String projectFileName;
 	juce::String projectDir;
 	juce::String araDir;
+	juce::String freezeDir;
+	juce::String automationDir;
 };
 
 struct ParseConfig {
@@ -14,4 +16,6 @@ struct ParseConfig {
 	juce::String projectFileName;
 	juce::String projectDir;
 	juce::String araDir;
+	juce::String freezeDir;
+	juce::String automationDir;
 };
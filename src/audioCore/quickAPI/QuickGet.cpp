@@ -4,6 +4,8 @@
 #include "../misc/Device.h"
 #include "../misc/PlayPosition.h"
 #include "../misc/VMath.h"
+#include "../misc/LevelMeter.h"
+#include "../misc/Renderer.h"
 #include "../source/SourceManager.h"
 
 namespace quickAPI {
@@ -23,6 +25,20 @@ namespace quickAPI {
 		return Device::getInstance()->getCPUUsage();
 	}
 
+	uint64_t getAudioFallbackBlockNum() {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			return graph->getFallbackBlockNum();
+		}
+		return 0;
+	}
+
+	uint64_t getMIDIEventOverflowNum() {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			return graph->getMIDIEventOverflowNum();
+		}
+		return 0;
+	}
+
 	bool getReturnToStartOnStop() {
 		return AudioCore::getInstance()->getReturnToPlayStartPosition();
 	}
@@ -62,6 +78,20 @@ namespace quickAPI {
 		return {};
 	}
 
+	const juce::Array<float> getAudioOutputPeak() {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			return graph->getOutputPeakLevels();
+		}
+		return {};
+	}
+
+	const juce::Array<float> getAudioOutputTruePeak() {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			return graph->getOutputTruePeakLevels();
+		}
+		return {};
+	}
+
 	bool isPlaying() {
 		auto pos = PlayPosition::getInstance()->getPosition();
 		return pos->getIsPlaying();
@@ -72,6 +102,16 @@ namespace quickAPI {
 		return pos->getIsRecording();
 	}
 
+	const CPUUsage getRecorderCPUUsage() {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			if (auto recorder = graph->getRecorder()) {
+				auto usage = recorder->getCPUUsage();
+				return { usage.average, usage.max, usage.percentile };
+			}
+		}
+		return { 0.f, 0.f, 0.f };
+	}
+
 	double getTotalLength() {
 		if (auto graph = AudioCore::getInstance()->getGraph()) {
 			return graph->getTailLengthSeconds();
@@ -204,6 +244,61 @@ namespace quickAPI {
 		return vMath::getAllInsTypeName();
 	}
 
+	const std::tuple<float, float> getAudioDataRange(
+		const juce::AudioSampleBuffer& data, int channel, int startSample, int length) {
+		return vMath::getAudioDataRange(data, startSample, channel, length);
+	}
+
+	int getParallelThreadNum() {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			return graph->getParallelThreadNum();
+		}
+		return 0;
+	}
+
+	const juce::StringArray getAllParallelThreadNum() {
+		juce::StringArray result;
+		for (int i = 0; i < std::max(juce::SystemStats::getNumCpus(), 1); i++) {
+			result.add(juce::String{ i });
+		}
+		return result;
+	}
+
+	int getMIDICCSplitSize() {
+		return PluginDecorator::getMIDICCSplitSize();
+	}
+
+	const juce::StringArray getAllMIDICCSplitSize() {
+		return { "0", "16", "32", "64", "128", "256" };
+	}
+
+	int getRenderAheadBlockNum() {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			return graph->getRenderAheadBlockNum();
+		}
+		return 0;
+	}
+
+	const juce::StringArray getAllRenderAheadBlockNum() {
+		return { "0", "2", "4", "8", "16" };
+	}
+
+	int getRenderBlockSize() {
+		return Renderer::getInstance()->getRenderBlockSize();
+	}
+
+	const juce::StringArray getAllRenderBlockSize() {
+		return { "0", "1024", "2048", "4096", "8192", "16384" };
+	}
+
+	bool getRenderCacheEnabled() {
+		return Renderer::getInstance()->getRenderCacheEnabled();
+	}
+
+	bool getTruePeakMeter() {
+		return LevelMeter::getTruePeakEnabled();
+	}
+
 	const std::tuple<bool, juce::Array<juce::PluginDescription>>
 		getPluginList(bool filter, bool instr) {
 		auto [result, list] = Plugin::getInstance()->getPluginList();
@@ -383,6 +478,27 @@ namespace quickAPI {
 		return false;
 	}
 
+	bool getInstrFrozen(int index) {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			if (auto track = graph->getSourceProcessor(index)) {
+				return track->getFrozen();
+			}
+		}
+		return false;
+	}
+
+	const CPUUsage getInstrCPUUsage(int index) {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			if (auto track = graph->getSourceProcessor(index)) {
+				if (auto instr = track->getInstrProcessor()) {
+					auto usage = instr->getCPUUsage();
+					return { usage.average, usage.max, usage.percentile };
+				}
+			}
+		}
+		return { 0.f, 0.f, 0.f };
+	}
+
 	EditorPointer getInstrEditor(int index) {
 		if (auto graph = AudioCore::getInstance()->getGraph()) {
 			if (auto track = graph->getSourceProcessor(index)) {
@@ -482,6 +598,33 @@ namespace quickAPI {
 		return false;
 	}
 
+	bool getEffectNeverSleep(int trackIndex, int index) {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			if (auto track = graph->getTrackProcessor(trackIndex)) {
+				if (auto pluginDock = track->getPluginDock()) {
+					if (auto effect = pluginDock->getPluginProcessor(index)) {
+						return effect->getNeverSleep();
+					}
+				}
+			}
+		}
+		return false;
+	}
+
+	const CPUUsage getEffectCPUUsage(int trackIndex, int index) {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			if (auto track = graph->getTrackProcessor(trackIndex)) {
+				if (auto pluginDock = track->getPluginDock()) {
+					if (auto effect = pluginDock->getPluginProcessor(index)) {
+						auto usage = effect->getCPUUsage();
+						return { usage.average, usage.max, usage.percentile };
+					}
+				}
+			}
+		}
+		return { 0.f, 0.f, 0.f };
+	}
+
 	const juce::String getEffectName(PluginHolder pointer) {
 		return getPluginName(pointer);
 	}
@@ -675,6 +818,24 @@ namespace quickAPI {
 		return {};
 	}
 
+	const juce::Array<float> getSeqTrackOutputPeak(int index) {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			if (auto track = graph->getSourceProcessor(index)) {
+				return track->getOutputPeakLevels();
+			}
+		}
+		return {};
+	}
+
+	const juce::Array<float> getSeqTrackOutputTruePeak(int index) {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			if (auto track = graph->getSourceProcessor(index)) {
+				return track->getOutputTruePeakLevels();
+			}
+		}
+		return {};
+	}
+
 	const juce::String getSeqTrackType(int index) {
 		if (auto graph = AudioCore::getInstance()->getGraph()) {
 			if (auto track = graph->getSourceProcessor(index)) {
@@ -684,6 +845,16 @@ namespace quickAPI {
 		return "";
 	}
 
+	const CPUUsage getSeqTrackCPUUsage(int index) {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			if (auto track = graph->getSourceProcessor(index)) {
+				auto usage = track->getCPUUsage();
+				return { usage.average, usage.max, usage.percentile };
+			}
+		}
+		return { 0.f, 0.f, 0.f };
+	}
+
 	bool isSeqTrackHasAudioData(int index) {
 		if (auto graph = AudioCore::getInstance()->getGraph()) {
 			if (auto track = graph->getSourceProcessor(index)) {
@@ -965,6 +1136,24 @@ namespace quickAPI {
 		return {};
 	}
 
+	const juce::Array<float> getMixerTrackOutputPeak(int index) {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			if (auto track = graph->getTrackProcessor(index)) {
+				return track->getOutputPeakLevels();
+			}
+		}
+		return {};
+	}
+
+	const juce::Array<float> getMixerTrackOutputTruePeak(int index) {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			if (auto track = graph->getTrackProcessor(index)) {
+				return track->getOutputTruePeakLevels();
+			}
+		}
+		return {};
+	}
+
 	const juce::String getMixerTrackType(int index) {
 		if (auto graph = AudioCore::getInstance()->getGraph()) {
 			if (auto track = graph->getTrackProcessor(index)) {
@@ -974,6 +1163,16 @@ namespace quickAPI {
 		return "";
 	}
 
+	const CPUUsage getMixerTrackCPUUsage(int index) {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			if (auto track = graph->getTrackProcessor(index)) {
+				auto usage = track->getCPUUsage();
+				return { usage.average, usage.max, usage.percentile };
+			}
+		}
+		return { 0.f, 0.f, 0.f };
+	}
+
 	int getLabelNum() {
 		return PlayPosition::getInstance()->getTempoLabelNum();
 	}
@@ -13,6 +13,8 @@ namespace quickAPI {
 	const juce::File getProjectDir();
 
 	double getCPUUsage();
+	uint64_t getAudioFallbackBlockNum();
+	uint64_t getMIDIEventOverflowNum();
 	bool getReturnToStartOnStop();
 	bool getAnonymousMode();
 	std::unique_ptr<juce::Component> createAudioDeviceSelector();
@@ -21,8 +23,13 @@ namespace quickAPI {
 	double getTimeInSecond();
 	std::tuple<double, double> getLoopTimeSec();
 	const juce::Array<float> getAudioOutputLevel();
+	const juce::Array<float> getAudioOutputPeak();
+	const juce::Array<float> getAudioOutputTruePeak();
 	bool isPlaying();
 	bool isRecording();
+	/** Average, Max, Percentile, In Percent Of Block Time */
+	using CPUUsage = std::tuple<float, float, float>;
+	const CPUUsage getRecorderCPUUsage();
 	double getTotalLength();
 	int getTempoTempIndexBySec(double timeSec);
 	/** timeInSec, timeInQuarter, timeInBar, secPerQuarter, numerator, denominator */
@@ -60,6 +67,24 @@ namespace quickAPI {
 	int getSIMDLevel();
 	const juce::String getSIMDInsName();
 	const juce::StringArray getAllSIMDInsName();
+	/** Min, Max */
+	const std::tuple<float, float> getAudioDataRange(
+		const juce::AudioSampleBuffer& data, int channel, int startSample, int length);
+
+	int getParallelThreadNum();
+	const juce::StringArray getAllParallelThreadNum();
+
+	int getMIDICCSplitSize();
+	const juce::StringArray getAllMIDICCSplitSize();
+
+	int getRenderAheadBlockNum();
+	const juce::StringArray getAllRenderAheadBlockNum();
+
+	int getRenderBlockSize();
+	const juce::StringArray getAllRenderBlockSize();
+	bool getRenderCacheEnabled();
+
+	bool getTruePeakMeter();
 
 	const std::tuple<bool, juce::Array<juce::PluginDescription>>
 		getPluginList(bool filter = false, bool instr = true);
@@ -88,6 +113,8 @@ namespace quickAPI {
 	const juce::String getInstrName(int index);
 	bool getInstrBypass(int index);
 	bool getInstrOffline(int index);
+	bool getInstrFrozen(int index);
+	const CPUUsage getInstrCPUUsage(int index);
 	EditorPointer getInstrEditor(int index);
 	const juce::String getInstrName(PluginHolder pointer);
 	bool getInstrBypass(PluginHolder pointer);
@@ -104,6 +131,8 @@ namespace quickAPI {
 	PluginHolder getEffectPointer(int trackIndex, int index);
 	const juce::String getEffectName(int trackIndex, int index);
 	bool getEffectBypass(int trackIndex, int index);
+	bool getEffectNeverSleep(int trackIndex, int index);
+	const CPUUsage getEffectCPUUsage(int trackIndex, int index);
 	const juce::String getEffectName(PluginHolder pointer);
 	bool getEffectBypass(PluginHolder pointer);
 	EditorPointer getEffectEditor(PluginHolder pointer);
@@ -133,7 +162,10 @@ namespace quickAPI {
 	bool getSeqTrackInputMonitoring(int index);
 	RecordState getSeqTrackRecording(int index);
 	const juce::Array<float> getSeqTrackOutputLevel(int index);
+	const juce::Array<float> getSeqTrackOutputPeak(int index);
+	const juce::Array<float> getSeqTrackOutputTruePeak(int index);
 	const juce::String getSeqTrackType(int index);
+	const CPUUsage getSeqTrackCPUUsage(int index);
 	bool isSeqTrackHasAudioData(int index);
 	bool isSeqTrackHasMIDIData(int index);
 	const juce::String getSeqTrackDataRefAudio(int index);
@@ -169,7 +201,10 @@ namespace quickAPI {
 	bool getMixerTrackMute(int index);
 	bool isMixerTrackPanValid(int index);
 	const juce::Array<float> getMixerTrackOutputLevel(int index);
+	const juce::Array<float> getMixerTrackOutputPeak(int index);
+	const juce::Array<float> getMixerTrackOutputTruePeak(int index);
 	const juce::String getMixerTrackType(int index);
+	const CPUUsage getMixerTrackCPUUsage(int index);
 
 	int getLabelNum();
 	bool isLabelTempo(int index);
@@ -4,6 +4,8 @@
 #include "../plugin/Plugin.h"
 #include "../misc/AudioLock.h"
 #include "../misc/VMath.h"
+#include "../misc/LevelMeter.h"
+#include "../misc/Renderer.h"
 
 namespace quickAPI {
 	void setPluginSearchPathListFilePath(const juce::String& path) {
@@ -75,6 +77,35 @@ namespace quickAPI {
 		vMath::setInsType((vMath::InsType)(level));
 	}
 
+	void setParallelThreadNum(int num) {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			juce::ScopedWriteLock locker(audioLock::getAudioLock());
+			graph->setParallelThreadNum(num);
+		}
+	}
+
+	void setMIDICCSplitSize(int size) {
+		PluginDecorator::setMIDICCSplitSize(size);
+	}
+
+	void setRenderAheadBlockNum(int num) {
+		if (auto graph = AudioCore::getInstance()->getGraph()) {
+			graph->setRenderAheadBlockNum(num);
+		}
+	}
+
+	void setRenderBlockSize(int size) {
+		Renderer::getInstance()->setRenderBlockSize(size);
+	}
+
+	void setRenderCacheEnabled(bool enabled) {
+		Renderer::getInstance()->setRenderCacheEnabled(enabled);
+	}
+
+	void setTruePeakMeter(bool enabled) {
+		LevelMeter::setTruePeakEnabled(enabled);
+	}
+
 	static void setPluginMIDICCListener(PluginHolder pointer, const MIDICCListener& listener) {
 		if (pointer) {
 			pointer->setMIDICCListener(listener);
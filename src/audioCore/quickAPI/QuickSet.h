@@ -24,6 +24,12 @@ namespace quickAPI {
 	bool removeFromPluginSearchPath(const juce::String& path);
 
 	void setSIMDLevel(int level);
+	void setParallelThreadNum(int num);
+	void setMIDICCSplitSize(int size);
+	void setRenderAheadBlockNum(int num);
+	void setRenderBlockSize(int size);
+	void setRenderCacheEnabled(bool enabled);
+	void setTruePeakMeter(bool enabled);
 
 	using MIDICCListener = std::function<void(int)>;
 	void setInstrMIDICCListener(PluginHolder pointer, const MIDICCListener& listener);
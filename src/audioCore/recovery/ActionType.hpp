@@ -84,5 +84,11 @@ enum class ActionType : unsigned int {
 	ActionSetEffect,
 	ActionSetSequencerMIDITrack,
 	ActionSetSequencerBlockTime,
-	ActionSetSequencerTrackInputMonitoring
+	ActionSetSequencerTrackInputMonitoring,
+	ActionSetInstrFrozen,
+	ActionSetEffectNeverSleep,
+	ActionAddMixerTrackAutomationPoint,
+	ActionRemoveMixerTrackAutomationPoint,
+	ActionAddEffectAutomationPoint,
+	ActionRemoveEffectAutomationPoint
 };
@@ -1,9 +1,11 @@
 ﻿#include "SourceInternalContainer.h"
 #include "../misc/VMath.h"
 
+std::atomic_uint64_t SourceInternalContainer::versionCounter = 0;
+
 SourceInternalContainer::SourceInternalContainer(
 	const SourceType type, const juce::String& name)
-	: type(type), name(name) {}
+	: type(type), name(name), version(++SourceInternalContainer::versionCounter) {}
 
 SourceInternalContainer::SourceInternalContainer(
 	const SourceInternalContainer& other)
@@ -19,6 +21,7 @@ SourceInternalContainer::SourceInternalContainer(
 
 		this->audioSampleRate = other.audioSampleRate;
 		this->savedFlag = false;
+		this->version = other.version.load();
 
 		this->format = other.format;
 		this->metaData = other.metaData;
@@ -66,6 +69,7 @@ double SourceInternalContainer::getAudioSampleRate() const {
 
 void SourceInternalContainer::changed() {
 	this->savedFlag = false;
+	this->version = ++SourceInternalContainer::versionCounter;
 }
 
 void SourceInternalContainer::saved() {
@@ -76,6 +80,10 @@ bool SourceInternalContainer::isSaved() const {
 	return this->savedFlag;
 }
 
+uint64_t SourceInternalContainer::getVersion() const {
+	return this->version;
+}
+
 const juce::String SourceInternalContainer::getFormat() const {
 	return this->format;
 }
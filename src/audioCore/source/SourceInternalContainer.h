@@ -24,6 +24,10 @@ public:
 	void changed();
 	void saved();
 	bool isSaved() const;
+	/**
+	 * @brief	Get the number identifying the current data. It changes on every edit and is unique in the process.
+	 */
+	uint64_t getVersion() const;
 
 	const juce::String getFormat() const;
 	const juce::StringPairArray getMetaData() const;
@@ -83,6 +87,7 @@ private:
 	std::unique_ptr<juce::AudioSampleBuffer> audioData = nullptr;
 	double audioSampleRate = 0;
 	std::atomic_bool savedFlag = true;
+	std::atomic_uint64_t version = 0;
 
 	juce::String format;
 	juce::StringPairArray metaData;
@@ -93,5 +98,7 @@ private:
 
 	static const juce::String getForkName(const juce::String& name);
 
+	static std::atomic_uint64_t versionCounter;
+
 	JUCE_LEAK_DETECTOR(SourceInternalContainer)
 };
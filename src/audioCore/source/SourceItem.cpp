@@ -219,6 +219,12 @@ bool SourceItem::isSaved() const {
 	return this->container->isSaved();
 }
 
+uint64_t SourceItem::getVersion() const {
+	if (!this->container) { return 0; }
+
+	return this->container->getVersion();
+}
+
 void SourceItem::prepareAudioPlay() {
 	/** Check Data */
 	if (!this->audioValid()) {
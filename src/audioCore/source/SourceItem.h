@@ -33,6 +33,7 @@ public:
 	void changed();
 	void saved();
 	bool isSaved() const;
+	uint64_t getVersion() const;
 
 	void prepareAudioPlay();
 	void prepareMIDIPlay();
@@ -57,6 +57,15 @@ bool SourceManager::isSaved(uint64_t ref, SourceType type) const {
 	return true;
 }
 
+uint64_t SourceManager::getVersion(uint64_t ref, SourceType type) const {
+	juce::ScopedReadLock locker(audioLock::getSourceLock());
+
+	if (auto ptr = this->getSource(ref, type)) {
+		return ptr->getVersion();
+	}
+	return 0;
+}
+
 bool SourceManager::isValid(uint64_t ref, SourceType type) const {
 	juce::ScopedReadLock locker(audioLock::getSourceLock());
 
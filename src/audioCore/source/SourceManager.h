@@ -15,6 +15,10 @@ public:
 	void changed(uint64_t ref, SourceType type);
 	void saved(uint64_t ref, SourceType type);
 	bool isSaved(uint64_t ref, SourceType type) const;
+	/**
+	 * @brief	Get the number identifying the current source data, 0 if the source is invalid.
+	 */
+	uint64_t getVersion(uint64_t ref, SourceType type) const;
 	bool isValid(uint64_t ref, SourceType type) const;
 
 	int getMIDITrackNum(uint64_t ref) const;
@@ -24,6 +24,7 @@ enum class UICallbackType : int {
 	PluginSearchMessage,
 	SynthStateChanged,
 	SourceRecord,
+	RenderProgress,
 
 	TypeMaxNum
 };
@@ -90,6 +90,12 @@ private:
 				quickAPI::setReturnToStartOnStop(funcVar["return-on-stop"]);
 				quickAPI::setAnonymousMode(funcVar["anonymous-mode"]);
 				quickAPI::setSIMDLevel(funcVar["simd-speed-up"]);
+				quickAPI::setParallelThreadNum(funcVar["parallel-threads"]);
+				quickAPI::setMIDICCSplitSize(funcVar["cc-split-size"].toString().getIntValue());
+				quickAPI::setRenderAheadBlockNum(funcVar["render-ahead"].toString().getIntValue());
+				quickAPI::setRenderBlockSize(funcVar["render-block-size"].toString().getIntValue());
+				quickAPI::setRenderCacheEnabled(funcVar["render-cache"]);
+				quickAPI::setTruePeakMeter(funcVar["true-peak-meter"]);
 
 				/** Output */
 				auto formats = quickAPI::getAudioFormatsSupported(true);
@@ -460,6 +460,12 @@ namespace utils {
 		return (-total) + percent * total;
 	}
 
+	const juce::String createCPUUsageString(float average, float max, float percentile) {
+		return juce::String{ average, 1 } + "% / "
+			+ juce::String{ max, 1 } + "% / "
+			+ juce::String{ percentile, 1 } + "%";
+	}
+
 	TextIntegerFilter::TextIntegerFilter(int minLimit, int maxLimit)
 		: minLimit(minLimit), maxLimit(maxLimit) {}
 
@@ -88,6 +88,8 @@ namespace utils {
 	float logRMS(float rms);
 	float getLogLevelPercent(float logLevel, float total = 60.f);
 	float getLogFromPercent(float percent, float total = 60.f);
+	/** Average / Max / Percentile */
+	const juce::String createCPUUsageString(float average, float max, float percentile);
 
 	class TextIntegerFilter : public juce::TextEditor::InputFilter {
 	public:
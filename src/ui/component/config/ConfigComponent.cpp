@@ -290,6 +290,48 @@ void ConfigComponent::createFunctionPage() {
 	auto simdValueCallback = []()->const juce::var {
 		return quickAPI::getSIMDLevel();
 		};
+	auto parallelUpdateCallback = [](const juce::var& data) {
+		quickAPI::setParallelThreadNum(data);
+		return true;
+		};
+	auto parallelValueCallback = []()->const juce::var {
+		return quickAPI::getParallelThreadNum();
+		};
+	auto ccSplitUpdateCallback = [](const juce::var& data) {
+		quickAPI::setMIDICCSplitSize(data.toString().getIntValue());
+		return true;
+		};
+	auto ccSplitValueCallback = []()->const juce::var {
+		return juce::String{ quickAPI::getMIDICCSplitSize() };
+		};
+	auto renderAheadUpdateCallback = [](const juce::var& data) {
+		quickAPI::setRenderAheadBlockNum(data.toString().getIntValue());
+		return true;
+		};
+	auto renderAheadValueCallback = []()->const juce::var {
+		return juce::String{ quickAPI::getRenderAheadBlockNum() };
+		};
+	auto renderBlockUpdateCallback = [](const juce::var& data) {
+		quickAPI::setRenderBlockSize(data.toString().getIntValue());
+		return true;
+		};
+	auto renderBlockValueCallback = []()->const juce::var {
+		return juce::String{ quickAPI::getRenderBlockSize() };
+		};
+	auto renderCacheUpdateCallback = [](const juce::var& data) {
+		quickAPI::setRenderCacheEnabled(data);
+		return true;
+		};
+	auto renderCacheValueCallback = []()->const juce::var {
+		return quickAPI::getRenderCacheEnabled();
+		};
+	auto truePeakUpdateCallback = [](const juce::var& data) {
+		quickAPI::setTruePeakMeter(data);
+		return true;
+		};
+	auto truePeakValueCallback = []()->const juce::var {
+		return quickAPI::getTruePeakMeter();
+		};
 
 	juce::Array<juce::PropertyComponent*> audioProps;
 	audioProps.add(new ConfigBooleanProp{ "function", "return-on-stop",
@@ -299,6 +341,22 @@ void ConfigComponent::createFunctionPage() {
 	audioProps.add(new ConfigChoiceProp{ "function", "simd-speed-up",
 		quickAPI::getAllSIMDInsName(), ConfigChoiceProp::ValueType::IndexVal,
 		simdUpdateCallback , simdValueCallback });
+	audioProps.add(new ConfigChoiceProp{ "function", "parallel-threads",
+		quickAPI::getAllParallelThreadNum(), ConfigChoiceProp::ValueType::IndexVal,
+		parallelUpdateCallback , parallelValueCallback });
+	audioProps.add(new ConfigChoiceProp{ "function", "cc-split-size",
+		quickAPI::getAllMIDICCSplitSize(), ConfigChoiceProp::ValueType::NameVal,
+		ccSplitUpdateCallback , ccSplitValueCallback });
+	audioProps.add(new ConfigChoiceProp{ "function", "render-ahead",
+		quickAPI::getAllRenderAheadBlockNum(), ConfigChoiceProp::ValueType::NameVal,
+		renderAheadUpdateCallback , renderAheadValueCallback });
+	audioProps.add(new ConfigChoiceProp{ "function", "render-block-size",
+		quickAPI::getAllRenderBlockSize(), ConfigChoiceProp::ValueType::NameVal,
+		renderBlockUpdateCallback , renderBlockValueCallback });
+	audioProps.add(new ConfigBooleanProp{ "function", "render-cache",
+		"Disabled", "Enabled", renderCacheUpdateCallback , renderCacheValueCallback });
+	audioProps.add(new ConfigBooleanProp{ "function", "true-peak-meter",
+		"Disabled", "Enabled", truePeakUpdateCallback , truePeakValueCallback });
 	audioProps.add(new ConfigWhiteSpaceProp{});
 	panel->addSection(TRANS("Audio Core"), audioProps);
 
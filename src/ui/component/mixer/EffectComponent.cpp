@@ -64,6 +64,9 @@ void EffectComponent::paint(juce::Graphics& g) {
 	int right = this->getWidth();
 	right -= buttonWidth;
 
+	int cpuWidth = screenSize.getWidth() * 0.015;
+	float cpuTextHeight = textHeight * 0.75;
+
 	/** Color */
 	auto& laf = this->getLookAndFeel();
 	juce::Colour backgroundColor = laf.findColour(this->editorOpened
@@ -75,11 +78,22 @@ void EffectComponent::paint(juce::Graphics& g) {
 
 	/** Font */
 	juce::Font textFont(juce::FontOptions{ textHeight });
+	juce::Font cpuFont(juce::FontOptions{ cpuTextHeight });
 
 	/** Background */
 	g.setColour(backgroundColor);
 	g.fillAll();
 
+	/** CPU Usage */
+	juce::Rectangle<int> cpuRect(
+		right - textPaddingWidth - cpuWidth, 0,
+		cpuWidth, this->getHeight());
+	g.setColour(textColor.withAlpha(0.6f));
+	g.setFont(cpuFont);
+	g.drawFittedText(juce::String{ this->cpuAverage, 1 } + "%", cpuRect,
+		juce::Justification::centredRight, 1, 0.75f);
+	right -= (cpuWidth + textPaddingWidth);
+
 	/** Text */
 	juce::Rectangle<int> textRect(
 		textPaddingWidth, 0,
@@ -107,6 +121,23 @@ void EffectComponent::update(int track, int index) {
 	}
 }
 
+void EffectComponent::updateLevelMeter() {
+	if (this->track < 0 || this->index < 0) { return; }
+
+	/** Get CPU Usage */
+	auto [average, max, percentile] = quickAPI::getEffectCPUUsage(this->track, this->index);
+	bool shouldRepaint = juce::String{ average, 1 } != juce::String{ this->cpuAverage, 1 };
+	this->cpuAverage = average;
+	this->cpuMax = max;
+	this->cpuPercentile = percentile;
+
+	/** Update */
+	if (shouldRepaint) {
+		this->repaint();
+	}
+	this->setTooltip(this->createToolTip());
+}
+
 void EffectComponent::mouseUp(const juce::MouseEvent& event) {
 	if (event.mods.isLeftButtonDown()) {
 		if (!event.mouseWasDraggedSinceMouseDown()) {
@@ -140,7 +171,7 @@ void EffectComponent::editorShow() {
 }
 
 enum EffectMenuActionType {
-	Bypass = 1, Remove
+	Bypass = 1, NeverSleep, Remove
 };
 
 void EffectComponent::showMenu() {
@@ -165,6 +196,11 @@ void EffectComponent::showMenu() {
 		this->bypass();
 		break;
 	}
+	case EffectMenuActionType::NeverSleep: {
+		CoreActions::setEffectNeverSleep(this->track, this->index,
+			!quickAPI::getEffectNeverSleep(this->track, this->index));
+		break;
+	}
 	case EffectMenuActionType::Remove: {
 		CoreActions::removeEffectGUI(this->track, this->index);
 		break;
@@ -206,7 +242,8 @@ juce::String EffectComponent::createToolTip() const {
 	juce::String result =
 		"#" + juce::String{ this->index } + "\n"
 		+ TRANS("Name:") + " " + this->name + "\n"
-		+ TRANS("Bypassed:") + " " + TRANS(this->bypassButton->getToggleState() ? "No" : "Yes") + "\n";
+		+ TRANS("Bypassed:") + " " + TRANS(this->bypassButton->getToggleState() ? "No" : "Yes") + "\n"
+		+ TRANS("CPU Usage:") + " " + utils::createCPUUsageString(this->cpuAverage, this->cpuMax, this->cpuPercentile) + "\n";
 
 	return result;
 }
@@ -219,6 +256,8 @@ juce::PopupMenu EffectComponent::createMenu(
 	menu.addSubMenu(TRANS("Add"), this->createAddMenu(addCallback));
 	menu.addSubMenu(TRANS("Replace"), this->createAddMenu(editCallback));
 	menu.addItem(EffectMenuActionType::Bypass, TRANS("Bypass"), true, !(this->bypassButton->getToggleState()));
+	menu.addItem(EffectMenuActionType::NeverSleep, TRANS("Never Sleep"), true,
+		quickAPI::getEffectNeverSleep(this->track, this->index));
 	menu.addItem(EffectMenuActionType::Remove, TRANS("Remove"));
 
 	return menu;
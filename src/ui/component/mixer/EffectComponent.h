@@ -1,9 +1,11 @@
 ﻿#pragma once
 
 #include <JuceHeader.h>
+#include "../../misc/LevelMeterHub.h"
 
 class EffectComponent final
 	: public juce::Component,
+	public LevelMeterHub::Target,
 	public juce::SettableTooltipClient {
 public:
 	EffectComponent();
@@ -12,6 +14,7 @@ public:
 	void paint(juce::Graphics& g) override;
 
 	void update(int track, int index);
+	void updateLevelMeter() override;
 
 	void mouseUp(const juce::MouseEvent& event) override;
 	void mouseDrag(const juce::MouseEvent& event) override;
@@ -20,6 +23,7 @@ private:
 	int track = -1, index = -1;
 	juce::String name;
 	bool editorOpened = false;
+	float cpuAverage = 0.f, cpuMax = 0.f, cpuPercentile = 0.f;
 
 	std::unique_ptr<juce::Drawable> bypassIcon = nullptr;
 	std::unique_ptr<juce::Drawable> bypassIconOn = nullptr;
@@ -22,14 +22,30 @@ void MixerTrackLevelMeter::updateLevelMeter() {
 		this->values.add(utils::logRMS(i));
 	}
 
+	/** Get Peak */
+	auto peaksTemp = quickAPI::getTruePeakMeter()
+		? quickAPI::getMixerTrackOutputTruePeak(this->index)
+		: quickAPI::getMixerTrackOutputPeak(this->index);
+	this->peaks.clearQuick();
+	for (auto i : peaksTemp) {
+		this->peaks.add(utils::logRMS(i));
+	}
+
 	/** Repaint */
 	this->repaint();
 
 	/** Tooltip */
 	juce::String tooltipStr;
-	for (auto i : this->values) {
-		tooltipStr += (juce::String{ i, 2 } + " dB, ");
+	for (int i = 0; i < this->values.size(); i++) {
+		tooltipStr += (juce::String{ this->values[i], 2 } + " dB");
+		if (i < this->peaks.size()) {
+			tooltipStr += (" (" + juce::String{ this->peaks[i], 2 } + " dB)");
+		}
+		tooltipStr += ", ";
 	}
+	auto [cpuAverage, cpuMax, cpuPercentile] = quickAPI::getMixerTrackCPUUsage(this->index);
+	tooltipStr += ("\n" + TRANS("CPU Usage:") + " "
+		+ utils::createCPUUsageString(cpuAverage, cpuMax, cpuPercentile));
 	this->setTooltip(tooltipStr);
 }
 
@@ -121,6 +137,24 @@ void MixerTrackLevelMeter::paint(juce::Graphics& g) {
 				g.setColour(levelColors[j]);
 				g.fillRect(barRect);
 			}
+
+			/** Peak Hold */
+			if (i < this->peaks.size()) {
+				float peakPercent = utils::getLogLevelPercent(this->peaks[i], rmsNum);
+				if (peakPercent > 0.f) {
+					float peakY = rmsArea.getBottom() - std::min(peakPercent, 1.f) * rmsArea.getHeight();
+					juce::Rectangle<float> peakRect(
+						rmsArea.getX() + (barWidth + splitWidth) * i,
+						peakY, barWidth, lineThickness);
+
+					int colorIndex = 0;
+					while (colorIndex < levelSegs.size() - 1 && peakPercent > levelSegs[colorIndex]) {
+						colorIndex++;
+					}
+					g.setColour(levelColors[colorIndex]);
+					g.fillRect(peakRect);
+				}
+			}
 		}
 	}
 
@@ -21,7 +21,7 @@ public:
 
 private:
 	int index = -1;
-	juce::Array<float> values;
+	juce::Array<float> values, peaks;
 	bool mouseHovered = false;
 	juce::Point<int> mousePos;
 
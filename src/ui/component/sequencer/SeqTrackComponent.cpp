@@ -602,8 +602,13 @@ void SeqTrackComponent::instrOffline() {
 		this->instrOfflineButton->getToggleState());
 }
 
+void SeqTrackComponent::instrFreeze() {
+	CoreActions::freezeInstr(this->index,
+		!quickAPI::getInstrFrozen(this->index));
+}
+
 enum InstrMenuActionType {
-	Bypass = 1, Offline, Remove
+	Bypass = 1, Offline, Freeze, Remove
 };
 
 void SeqTrackComponent::instrMenuShow() {
@@ -627,6 +632,10 @@ void SeqTrackComponent::instrMenuShow() {
 		this->instrOffline();
 		break;
 	}
+	case InstrMenuActionType::Freeze: {
+		this->instrFreeze();
+		break;
+	}
 	case InstrMenuActionType::Remove: {
 		CoreActions::removeInstrGUI(this->index);
 		break;
@@ -701,6 +710,9 @@ juce::PopupMenu SeqTrackComponent::createInstrMenu(
 		this->instrOfflineButton->isEnabled(),
 		this->instrOfflineButton->isEnabled() && 
 		!(this->instrOfflineButton->getToggleState()));
+	menu.addItem(InstrMenuActionType::Freeze, TRANS("Freeze"),
+		this->instrOfflineButton->isEnabled(),
+		quickAPI::getInstrFrozen(this->index));
 	menu.addItem(InstrMenuActionType::Remove, TRANS("Remove"),
 		this->instrBypassButton->isEnabled());
 
@@ -735,6 +747,7 @@ juce::String SeqTrackComponent::createToolTipString() const {
 	if (quickAPI::isInstrValid(this->index)) {
 		result += TRANS("Instrument:") + " " + quickAPI::getInstrName(this->index) + "\n";
 		result += TRANS("Instrument Offline:") + " " + juce::String{ quickAPI::getInstrOffline(this->index) ? "ON" : "OFF" } + "\n";
+		result += TRANS("Instrument Frozen:") + " " + juce::String{ quickAPI::getInstrFrozen(this->index) ? "ON" : "OFF" } + "\n";
 		result += TRANS("Instrument Bypass:") + " " + juce::String{ quickAPI::getInstrBypass(this->index) ? "ON" : "OFF" } + "\n";
 	}
 
@@ -97,6 +97,7 @@ private:
 	void instrEditorShow();
 	void instrBypass();
 	void instrOffline();
+	void instrFreeze();
 	void instrMenuShow();
 	void menuShow();
 
@@ -1,5 +1,6 @@
 ﻿#include "AudioExtractor.h"
 #include "MainThreadPool.h"
+#include "../../audioCore/AC_API.h"
 
 class AudioExtractorJob final : public juce::ThreadPoolJob {
 public:
@@ -89,10 +90,12 @@ bool AudioExtractorJob::doExtract() {
 
 			if (clipSize >= 1) {
 				/** Extract */
-				for (int k = j * clipSize; k < std::ceil((j + 1) * clipSize); k++) {
-					minV = std::min(minV, dataPtr[k]);
-					maxV = std::max(maxV, dataPtr[k]);
-				}
+				int startSample = j * clipSize;
+				int endSample = std::min(sampleNum, (int)std::ceil((j + 1) * clipSize));
+				auto [clipMin, clipMax] = quickAPI::getAudioDataRange(
+					*(this->data), i, startSample, endSample - startSample);
+				minV = std::min(minV, clipMin);
+				maxV = std::max(maxV, clipMax);
 			}
 			else {
 				/** Interpolation */
@@ -126,6 +126,12 @@ void CoreActions::offlineInstr(int index, bool offline) {
 	ActionDispatcher::getInstance()->dispatch(std::move(action));
 }
 
+void CoreActions::freezeInstr(int index, bool frozen) {
+	auto action = std::unique_ptr<ActionBase>(
+		new ActionSetInstrFrozen{ index, frozen });
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+}
+
 void CoreActions::bypassInstr(quickAPI::PluginHolder instr, bool bypass) {
 	auto action = std::unique_ptr<ActionBase>(
 		new ActionSetInstrBypassByPtr{ instr, bypass });
@@ -190,6 +196,12 @@ void CoreActions::setEffectMIDIChannel(quickAPI::PluginHolder effect, int channe
 	ActionDispatcher::getInstance()->dispatch(std::move(action));
 }
 
+void CoreActions::setEffectNeverSleep(int track, int index, bool neverSleep) {
+	auto action = std::unique_ptr<ActionBase>(
+		new ActionSetEffectNeverSleep{ track, index, neverSleep });
+	ActionDispatcher::getInstance()->dispatch(std::move(action));
+}
+
 void CoreActions::setEffectMIDICCIntercept(quickAPI::PluginHolder effect, bool intercept) {
 	auto action = std::unique_ptr<ActionBase>(
 		new ActionSetEffectMidiCCInterceptByPtr{ effect, intercept });
@@ -38,6 +38,7 @@ public:
 	static void insertInstr(int index, const juce::String& pid, bool addARA);
 	static void bypassInstr(int index, bool bypass);
 	static void offlineInstr(int index, bool offline);
+	static void freezeInstr(int index, bool frozen);
 	static void bypassInstr(quickAPI::PluginHolder instr, bool bypass);
 	static void setInstrMIDIChannel(quickAPI::PluginHolder instr, int channel);
 	static void setInstrMIDICCIntercept(quickAPI::PluginHolder instr, bool intercept);
@@ -49,6 +50,7 @@ public:
 	static void insertEffect(int track, int index, const juce::String& pid);
 	static void bypassEffect(int track, int index, bool bypass);
 	static void bypassEffect(quickAPI::PluginHolder effect, bool bypass);
+	static void setEffectNeverSleep(int track, int index, bool neverSleep);
 	static void setEffectMIDIChannel(quickAPI::PluginHolder effect, int channel);
 	static void setEffectMIDICCIntercept(quickAPI::PluginHolder effect, bool intercept);
 	static void setEffectMIDIOutput(quickAPI::PluginHolder effect, bool output);
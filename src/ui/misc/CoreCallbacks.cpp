@@ -94,6 +94,10 @@ CoreCallbacks::CoreCallbacks() {
 		[](const std::set<int>& trackList) {
 			CoreCallbacks::getInstance()->invokeSourceRecord(trackList);
 		});
+	UICallbackAPI<int, double>::set(UICallbackType::RenderProgress,
+		[](int track, double progress) {
+			CoreCallbacks::getInstance()->invokeRenderProgress(track, progress);
+		});
 }
 
 void CoreCallbacks::addError(const ErrorCallback& callback) {
@@ -192,6 +196,10 @@ void CoreCallbacks::addEditingSeqChanged(const EditingSeqChangedCallback& callba
 	this->editingSeqChanged.add(callback);
 }
 
+void CoreCallbacks::addRenderProgress(const RenderProgressCallback& callback) {
+	this->renderProgress.add(callback);
+}
+
 void CoreCallbacks::invokeError(
 	const juce::String& title, const juce::String& mes) const {
 	for (auto& i : this->error) {
@@ -337,6 +345,12 @@ void CoreCallbacks::invokeEditingSeqChanged(int index) const {
 	}
 }
 
+void CoreCallbacks::invokeRenderProgress(int track, double progress) const {
+	for (auto& i : this->renderProgress) {
+		i(track, progress);
+	}
+}
+
 CoreCallbacks* CoreCallbacks::getInstance() {
 	return CoreCallbacks::instance ? CoreCallbacks::instance
 		: (CoreCallbacks::instance = new CoreCallbacks{});
@@ -50,6 +50,8 @@ public:
 	void addSourceRecord(const SourceRecordCallback& callback);
 	using EditingSeqChangedCallback = std::function<void(int)>;
 	void addEditingSeqChanged(const EditingSeqChangedCallback& callback);
+	using RenderProgressCallback = std::function<void(int, double)>;
+	void addRenderProgress(const RenderProgressCallback& callback);
 
 	void invokeError(const juce::String& title, const juce::String& mes) const;
 	void invokePlayingStatus(bool status) const;
@@ -75,6 +77,7 @@ public:
 	void invokeSynthStatus(int index, bool status) const;
 	void invokeSourceRecord(const std::set<int>& trackList) const;
 	void invokeEditingSeqChanged(int index) const;
+	void invokeRenderProgress(int track, double progress) const;
 
 private:
 	juce::Array<ErrorCallback> error;
@@ -101,6 +104,7 @@ private:
 	juce::Array<SynthStatusCallback> synthStatus;
 	juce::Array<SourceRecordCallback> sourceRecord;
 	juce::Array<EditingSeqChangedCallback> editingSeqChanged;
+	juce::Array<RenderProgressCallback> renderProgress;
 
 public:
 	static CoreCallbacks* getInstance();
@@ -44,5 +44,19 @@ AC.echoEffectParamCC(0, 0, 0);
 AC.echoEffectCCParam(0, 0, 17);
 AC.removeEffectParamCCConnection(0, 0, 17);
 
+-- Automation
+AC.addMixerTrackAutomationPoint(0, 0, 0, 0);
+AC.addMixerTrackAutomationPoint(0, 0, 2, -12);
+AC.addMixerTrackAutomationPoint(0, 1, 1, -1);
+AC.removeMixerTrackAutomationPoint(0, 1, 0);
+AC.addEffectAutomationPoint(0, 0, 0, 0, 0);
+AC.addEffectAutomationPoint(0, 0, 0, 4, 1);
+AC.removeEffectAutomationPoint(0, 0, 0, 1);
+
+-- Effect Plugin Sleep
+AC.setEffectNeverSleep(0, 0, true);
+AC.setEffectNeverSleep(0, 0, false);
+AC.echoPluginSleep();
+
 -- Track MIDI Output
 AC.addMixerTrackMidiOutput(0);
@@ -16,6 +16,10 @@ AC.setInstrBypass(0, false);
 AC.setInstrOffline(0, true);
 AC.setInstrOffline(0, false);
 
+-- Instrument Freeze
+AC.setInstrFrozen(0, true);
+AC.setInstrFrozen(0, false);
+
 -- Instrument Plugin MIDI Channel
 AC.setInstrMIDIChannel(0, 0);
 
@@ -10,11 +10,23 @@ AC.rewind();
 AC.setPlayPosition();
 AC.startRecord();
 AC.stopRecord();
+AC.echoEngineHealth();
 
 -- Render
 AC.renderNow("./", "test", ".wav", { 0, 1, 2 }, {}, 24, 0);
+AC.echoRenderInfo();
+AC.renderNow("./", "test-range", ".wav", { 0 }, {}, 24, 0, 30, 60, 2, true);
 
 -- Project
 AC.newProject("C:/Music/vsp4/test/");
 AC.save("testProj");
 AC.load("C:/Music/vsp4/test/testProj.vsp4");
+
+-- Graph Edit
+AC.beginGraphEdit();
+AC.addMixerTrack(-1, 1);
+AC.addMixerTrack(-1, 1);
+AC.commitGraphEdit();
+AC.beginGraphEdit();
+AC.addMixerTrack(-1, 1);
+AC.abortGraphEdit();
@@ -0,0 +1,352 @@
+﻿#include "VMathBench.h"
+#include "audioCore/misc/VMath.h"
+
+namespace bench {
+	struct Context final {
+		int capacity = 0;
+		juce::AudioSampleBuffer src, dst;
+		juce::HeapBlock<int16_t> int16Src;
+		juce::HeapBlock<uint8_t> int24Src;
+		juce::HeapBlock<float> interleaved;
+		std::array<float, vMath::truePeakHistorySize> history{};
+		std::array<float, 3> scalars{};
+		int offset = 0, length = 0;
+
+		explicit Context(int capacity)
+			: capacity(capacity), src(2, capacity), dst(2, capacity),
+			int16Src(capacity), int24Src(capacity * 3), interleaved(capacity * 2) {}
+	};
+
+	enum class OutputType {
+		FirstChannel, AllChannels, Interleaved, Scalars
+	};
+
+	struct Case final {
+		const char* name;
+		/** Bytes Read And Written For Each Sample Index */
+		int bytesPerFrame;
+		/** Output Samples For Each Sample Index */
+		int samplesPerFrame;
+		/** Allowed Error Relative To The Normal Result, 0 Means Bit Exact */
+		float tolerance;
+		OutputType output;
+		std::function<void(Context&)> run;
+	};
+
+	static const std::vector<Case> createCases() {
+		static const std::array<float, 2> startGains{ 0.5f, 0.8f };
+		static const std::array<float, 2> endGains{ 1.f, 0.25f };
+
+		return {
+			{ "copyAudioData", 8, 1, 0.f, OutputType::FirstChannel,
+				[](Context& c) { vMath::copyAudioData(c.dst, c.src, c.offset, c.offset, 0, 0, c.length); } },
+			{ "addAudioData", 12, 1, 0.f, OutputType::FirstChannel,
+				[](Context& c) { vMath::addAudioData(c.dst, c.src, c.offset, c.offset, 0, 0, c.length); } },
+			{ "fillAudioData", 4, 1, 0.f, OutputType::FirstChannel,
+				[](Context& c) { vMath::fillAudioData(c.dst, 0.25f, c.offset, 0, c.length); } },
+			{ "zeroAudioData", 4, 1, 0.f, OutputType::FirstChannel,
+				[](Context& c) { vMath::zeroAudioData(c.dst, c.offset, 0, c.length); } },
+			{ "applyGainRamp", 8, 1, 1e-5f, OutputType::FirstChannel,
+				[](Context& c) { vMath::applyGainRamp(c.dst, 0.5f, 1.f, c.offset, 0, c.length); } },
+			{ "applyChannelGains", 16, 2, 1e-5f, OutputType::AllChannels,
+				[](Context& c) { vMath::applyChannelGains(c.dst, startGains.data(), endGains.data(), c.offset, 2, c.length); } },
+			{ "addAudioDataWithGain", 12, 1, 0.f, OutputType::FirstChannel,
+				[](Context& c) { vMath::addAudioDataWithGain(c.dst, c.src, c.offset, c.offset, 0, 0, c.length, 0.7f); } },
+			{ "addAudioDataWithGainRamp", 12, 1, 1e-5f, OutputType::FirstChannel,
+				[](Context& c) { vMath::addAudioDataWithGainRamp(c.dst, c.src, c.offset, c.offset, 0, 0, c.length, 0.2f, 0.9f); } },
+			{ "addAudioDataWithPan", 20, 2, 0.f, OutputType::AllChannels,
+				[](Context& c) { vMath::addAudioDataWithPan(c.dst, c.src, c.offset, c.offset, 0, c.length, -0.3f); } },
+			{ "clampAudioData", 8, 1, 0.f, OutputType::FirstChannel,
+				[](Context& c) { vMath::clampAudioData(c.dst, -0.5f, 0.5f, c.offset, 0, c.length); } },
+			{ "getAudioDataRange", 4, 1, 0.f, OutputType::Scalars,
+				[](Context& c) { std::tie(c.scalars[0], c.scalars[1]) = vMath::getAudioDataRange(c.src, c.offset, 0, c.length); } },
+			{ "getAudioDataRMS", 4, 1, 1e-4f, OutputType::Scalars,
+				[](Context& c) { c.scalars[0] = vMath::getAudioDataRMS(c.src, c.offset, 0, c.length); } },
+			{ "getAudioDataPeak", 4, 1, 0.f, OutputType::Scalars,
+				[](Context& c) { c.scalars[0] = vMath::getAudioDataPeak(c.src, c.offset, 0, c.length); } },
+			{ "getLevelData", 4, 1, 1e-4f, OutputType::Scalars,
+				[](Context& c) {
+					auto data = vMath::getLevelData(c.src, c.offset, 0, c.length, c.history.data());
+					c.scalars = { data.sumSquare, data.peak, data.truePeak };
+				} },
+			{ "copyInt16AudioData", 6, 1, 0.f, OutputType::FirstChannel,
+				[](Context& c) { vMath::copyInt16AudioData(c.dst, &(c.int16Src[c.offset]), c.offset, 0, c.length); } },
+			{ "copyInt24AudioData", 7, 1, 0.f, OutputType::FirstChannel,
+				[](Context& c) { vMath::copyInt24AudioData(c.dst, &(c.int24Src[c.offset * 3]), c.offset, 0, c.length); } },
+			{ "interleaveAudioData", 16, 2, 0.f, OutputType::Interleaved,
+				[](Context& c) { vMath::interleaveAudioData(&(c.interleaved[c.offset * 2]), c.src, c.offset, c.length); } },
+			{ "deinterleaveAudioData", 16, 2, 0.f, OutputType::AllChannels,
+				[](Context& c) { vMath::deinterleaveAudioData(c.dst, &(c.interleaved[c.offset * 2]), c.offset, c.length); } }
+		};
+	}
+
+	static void resetContext(Context& context) {
+		/** Same Seed Every Time So Each Instruction Set Sees The Same Input */
+		juce::Random random{ 0x564d };
+
+		for (int i = 0; i < context.src.getNumChannels(); i++) {
+			auto srcPtr = context.src.getWritePointer(i);
+			auto dstPtr = context.dst.getWritePointer(i);
+			for (int j = 0; j < context.capacity; j++) {
+				srcPtr[j] = random.nextFloat() * 2.f - 1.f;
+				dstPtr[j] = random.nextFloat() * 2.f - 1.f;
+			}
+		}
+		for (int i = 0; i < context.capacity; i++) {
+			context.int16Src[i] = (int16_t)random.nextInt({ -32768, 32768 });
+		}
+		for (int i = 0; i < context.capacity * 3; i++) {
+			context.int24Src[i] = (uint8_t)random.nextInt(256);
+		}
+		for (int i = 0; i < context.capacity * 2; i++) {
+			context.interleaved[i] = random.nextFloat() * 2.f - 1.f;
+		}
+
+		context.history.fill(0.f);
+		context.scalars.fill(0.f);
+	}
+
+	static const juce::Array<float> getOutput(const Context& context, OutputType type) {
+		juce::Array<float> result;
+
+		switch (type) {
+		case OutputType::FirstChannel:
+			result.addArray(context.dst.getReadPointer(0, context.offset), context.length);
+			break;
+		case OutputType::AllChannels:
+			for (int i = 0; i < context.dst.getNumChannels(); i++) {
+				result.addArray(context.dst.getReadPointer(i, context.offset), context.length);
+			}
+			break;
+		case OutputType::Interleaved:
+			result.addArray(&(context.interleaved[context.offset * 2]), context.length * 2);
+			break;
+		case OutputType::Scalars:
+			result.addArray(context.scalars.data(), (int)context.scalars.size());
+			break;
+		}
+
+		return result;
+	}
+
+	struct CheckResult final {
+		bool exact = true;
+		float maxError = 0.f;
+		bool passed = true;
+	};
+
+	static const CheckResult compareOutput(
+		const juce::Array<float>& reference, const juce::Array<float>& output, float tolerance) {
+		CheckResult result;
+		if (reference.size() != output.size()) {
+			result.exact = result.passed = false;
+			return result;
+		}
+
+		for (int i = 0; i < reference.size(); i++) {
+			float ref = reference.getUnchecked(i), out = output.getUnchecked(i);
+			if (std::memcmp(&ref, &out, sizeof(float)) != 0) {
+				result.exact = false;
+			}
+
+			float error = std::abs(ref - out);
+			result.maxError = std::max(result.maxError, error);
+			if (!(error <= tolerance * (1.f + std::abs(ref)))) {
+				result.passed = false;
+			}
+		}
+
+		return result;
+	}
+
+	/** Best Time Of The Repeats In Nanoseconds Per Call */
+	static double measure(Context& context, const Case& benchCase,
+		double minSeconds, int repeats) {
+		/** Warm Up */
+		benchCase.run(context);
+
+		double best = std::numeric_limits<double>::max();
+		int iterations = 1;
+		for (int r = 0; r < repeats;) {
+			auto startTicks = juce::Time::getHighResolutionTicks();
+			for (int i = 0; i < iterations; i++) {
+				benchCase.run(context);
+			}
+			double seconds = juce::Time::highResolutionTicksToSeconds(
+				juce::Time::getHighResolutionTicks() - startTicks);
+
+			/** Double The Iterations Until A Single Measurement Is Long Enough */
+			if (seconds < minSeconds) {
+				iterations *= 2;
+				continue;
+			}
+
+			best = std::min(best, seconds * 1e9 / iterations);
+			r++;
+		}
+
+		return best;
+	}
+
+	static const juce::var toVar(const juce::Array<int>& list) {
+		juce::Array<juce::var> result;
+		for (auto i : list) {
+			result.add(i);
+		}
+		return juce::var{ result };
+	}
+}
+
+const VMathBench::Config VMathBench::getDefaultConfig() {
+	Config config;
+	config.lengths = { 16, 64, 256, 1024, 4096, 16384, 65536 };
+	config.tails = { 0, 1, 3, 7, 15 };
+	config.offsets = { 0, 1, 2, 4, 8 };
+	return config;
+}
+
+const VMathBench::Config VMathBench::getQuickConfig() {
+	Config config;
+	config.lengths = { 64, 1024, 16384 };
+	config.tails = { 0, 7 };
+	config.offsets = { 0, 1 };
+	config.minSeconds = 0.001;
+	config.repeats = 2;
+	return config;
+}
+
+VMathBench::VMathBench(const Config& config)
+	: config(config) {}
+
+int VMathBench::run(const LogFunc& log) {
+	this->results.clear();
+	this->insTypes.clear();
+	auto lastInsType = vMath::getInsType();
+
+	/** Get Supported Instruction Sets */
+	auto insTypeNames = vMath::getAllInsTypeName();
+	juce::Array<vMath::InsType> insTypeList;
+	for (int i = 0; i < vMath::InsType::MaxNum; i++) {
+		auto type = (vMath::InsType)i;
+		vMath::setInsType(type);
+		if (vMath::getInsType() == type) {
+			insTypeList.add(type);
+			this->insTypes.add(insTypeNames[i]);
+		}
+	}
+	log("Instruction Sets: " + this->insTypes.joinIntoString(", "));
+
+	/** Prepare Buffers */
+	int maxLength = 0, maxTail = 0, maxOffset = 0;
+	for (auto i : this->config.lengths) { maxLength = std::max(maxLength, i); }
+	for (auto i : this->config.tails) { maxTail = std::max(maxTail, i); }
+	for (auto i : this->config.offsets) { maxOffset = std::max(maxOffset, i); }
+	bench::Context context{ maxLength + maxTail + maxOffset };
+
+	/** Ramps Decay Towards Zero When Repeated */
+	juce::ScopedNoDenormals noDenormals;
+
+	int failedNum = 0;
+	auto cases = bench::createCases();
+	for (auto& benchCase : cases) {
+		juce::StringArray summary;
+
+		for (auto baseLength : this->config.lengths) {
+			for (auto tail : this->config.tails) {
+				for (auto offset : this->config.offsets) {
+					context.offset = offset;
+					context.length = baseLength + tail;
+
+					/** Reference */
+					bench::resetContext(context);
+					vMath::setInsType(vMath::InsType::Normal);
+					benchCase.run(context);
+					auto reference = bench::getOutput(context, benchCase.output);
+
+					double normalTime = 0;
+					for (auto type : insTypeList) {
+						vMath::setInsType(type);
+
+						/** Check */
+						bench::resetContext(context);
+						benchCase.run(context);
+						auto check = bench::compareOutput(
+							reference, bench::getOutput(context, benchCase.output), benchCase.tolerance);
+
+						/** Time */
+						bench::resetContext(context);
+						double time = bench::measure(
+							context, benchCase, this->config.minSeconds, this->config.repeats);
+						if (type == vMath::InsType::Normal) {
+							normalTime = time;
+						}
+
+						double bytes = (double)context.length * benchCase.bytesPerFrame;
+						double samples = (double)context.length * benchCase.samplesPerFrame;
+						auto address = reinterpret_cast<uintptr_t>(context.src.getReadPointer(0, offset));
+
+						auto obj = std::make_unique<juce::DynamicObject>();
+						obj->setProperty("function", benchCase.name);
+						obj->setProperty("insType", insTypeNames[type]);
+						obj->setProperty("length", context.length);
+						obj->setProperty("tail", tail);
+						obj->setProperty("offset", offset);
+						obj->setProperty("alignBytes", (int)(address % 64));
+						obj->setProperty("nsPerCall", time);
+						obj->setProperty("gbPerSecond", bytes / time);
+						obj->setProperty("samplesPerNs", samples / time);
+						obj->setProperty("speedup", (normalTime > 0) ? (normalTime / time) : 1.0);
+						obj->setProperty("exact", check.exact);
+						obj->setProperty("maxError", check.maxError);
+						obj->setProperty("passed", check.passed);
+						this->results.add(juce::var{ obj.release() });
+
+						if (!check.passed) {
+							failedNum++;
+							log(juce::String{ "[MISMATCH] " } + benchCase.name + " " + insTypeNames[type]
+								+ " length=" + juce::String{ context.length } + " offset=" + juce::String{ offset }
+								+ " maxError=" + juce::String{ check.maxError });
+						}
+
+						/** Largest Aligned Run For The Console */
+						if (baseLength == maxLength && tail == 0 && offset == 0) {
+							summary.add(insTypeNames[type] + " " + juce::String{ bytes / time, 2 } + " GB/s");
+						}
+					}
+				}
+			}
+		}
+
+		log(juce::String{ benchCase.name } + ": " + summary.joinIntoString(", "));
+	}
+
+	vMath::setInsType(lastInsType);
+
+	return failedNum;
+}
+
+const juce::var VMathBench::getResultVar() const {
+	auto machine = std::make_unique<juce::DynamicObject>();
+	machine->setProperty("cpuVendor", juce::SystemStats::getCpuVendor());
+	machine->setProperty("cpuModel", juce::SystemStats::getCpuModel());
+	machine->setProperty("cpuNum", juce::SystemStats::getNumPhysicalCpus());
+	machine->setProperty("os", juce::SystemStats::getOperatingSystemName());
+	juce::Array<juce::var> insTypeList;
+	for (auto& s : this->insTypes) {
+		insTypeList.add(s);
+	}
+	machine->setProperty("insTypes", juce::var{ insTypeList });
+
+	auto config = std::make_unique<juce::DynamicObject>();
+	config->setProperty("lengths", bench::toVar(this->config.lengths));
+	config->setProperty("tails", bench::toVar(this->config.tails));
+	config->setProperty("offsets", bench::toVar(this->config.offsets));
+	config->setProperty("minSeconds", this->config.minSeconds);
+	config->setProperty("repeats", this->config.repeats);
+
+	auto result = std::make_unique<juce::DynamicObject>();
+	result->setProperty("machine", juce::var{ machine.release() });
+	result->setProperty("config", juce::var{ config.release() });
+	result->setProperty("results", juce::var{ this->results });
+	return juce::var{ result.release() };
+}
@@ -0,0 +1,35 @@
+﻿#pragma once
+
+#include <JuceHeader.h>
+
+class VMathBench final {
+public:
+	struct Config final {
+		juce::Array<int> lengths;
+		juce::Array<int> tails;
+		juce::Array<int> offsets;
+		double minSeconds = 0.002;
+		int repeats = 3;
+	};
+	static const Config getDefaultConfig();
+	static const Config getQuickConfig();
+
+	VMathBench() = delete;
+	explicit VMathBench(const Config& config);
+
+	using LogFunc = std::function<void(const juce::String&)>;
+	/**
+	 * @brief	Check and time every vMath function on every instruction set the machine supports.
+	 * @return	The number of results that don't match the Normal path.
+	 */
+	int run(const LogFunc& log);
+
+	const juce::var getResultVar() const;
+
+private:
+	const Config config;
+	juce::Array<juce::var> results;
+	juce::StringArray insTypes;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(VMathBench)
+};
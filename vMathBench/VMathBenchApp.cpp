@@ -0,0 +1,83 @@
+﻿#include <JuceHeader.h>
+#include "VMathBench.h"
+
+#define OUT(x) \
+	DBG(x); \
+	std::cout << (x) << std::endl
+
+class VMathBenchApp final : public juce::JUCEApplication {
+public:
+	const juce::String getApplicationName() override { return "VocalShaper.VMathBench"; };
+	const juce::String getApplicationVersion() override {
+		return juce::String{ PROJECT_VERSION_MAJOR } + "." + juce::String{ PROJECT_VERSION_MINOR } + "." + juce::String{ PROJECT_VERSION_PATCH };
+	};
+	bool moreThanOneInstanceAllowed() override { return true; };
+
+	void initialise(const juce::String& commandLine) override {
+		OUT("VocalShaper vMath Benchmark v" + this->getApplicationVersion());
+		OUT("Copyright 2023-2024 VocalSharp Org. All rights reserved.");
+		OUT("");
+
+		/** Parse Command */
+		juce::StringArray commandArray = juce::StringArray::fromTokens(commandLine, " ", "\"");
+		for (auto& s : commandArray) {
+			/** Remove Quote */
+			s = s.removeCharacters("\"");
+		}
+		commandArray.removeEmptyStrings();
+		/** Check First Arg And Remove Execute Path */
+		if (commandArray.size() > 0) {
+			juce::File firstArgFile(commandArray[0]);
+			juce::File execFile = juce::File::getSpecialLocation(juce::File::hostApplicationPath);
+			if (firstArgFile == execFile) {
+				commandArray.remove(0);
+			}
+		}
+
+		/** Get Command */
+		bool quick = false;
+		juce::File outputFile = juce::File::getCurrentWorkingDirectory().getChildFile("VMathBench.json");
+		for (int i = 0; i < commandArray.size(); i++) {
+			if (commandArray[i] == "--quick") {
+				quick = true;
+			}
+			else if (commandArray[i] == "-o" && i + 1 < commandArray.size()) {
+				outputFile = juce::File::getCurrentWorkingDirectory().getChildFile(commandArray[++i]);
+			}
+			else {
+				OUT("\033[31m[ERROR]\033[0m Bad Command! Usage: VMathBench [--quick] [-o <result.json>]");
+				this->setApplicationReturnValue(2);
+				juce::JUCEApplication::quit();
+				return;
+			}
+		}
+
+		/** Run */
+		VMathBench bench{ quick ? VMathBench::getQuickConfig() : VMathBench::getDefaultConfig() };
+		int failedNum = bench.run([](const juce::String& s) { OUT(s); });
+		OUT("");
+
+		/** Save Result */
+		if (!outputFile.replaceWithText(juce::JSON::toString(bench.getResultVar()))) {
+			OUT("\033[31m[ERROR]\033[0m Can't Write Result: " + outputFile.getFullPathName());
+			this->setApplicationReturnValue(3);
+			juce::JUCEApplication::quit();
+			return;
+		}
+		OUT("\033[36mResult:\033[0m " + outputFile.getFullPathName());
+
+		/** Return */
+		if (failedNum > 0) {
+			OUT("\033[31m[ERROR]\033[0m " + juce::String{ failedNum } + " Results Don't Match The Normal Path!");
+			this->setApplicationReturnValue(1);
+		}
+		else {
+			OUT("\033[32m[OK]\033[0m All Results Match The Normal Path!");
+		}
+		juce::JUCEApplication::quit();
+	};
+
+	void shutdown() override {};
+};
+
+START_JUCE_APPLICATION(VMathBenchApp)